@@ -13,6 +13,7 @@ help:
 	@echo "Configuration:"
 	@echo "  BOARD              - Device name from device_db.yaml (default: $(BOARD))"
 	@echo "  DEVICE_TYPE        - Extracted from database (current: $(DEVICE_TYPE))"
+	@echo "  EXACT_CAPACITIES   - 1 to size tables exactly for config_str, even below generic sizes"
 	@echo ""
 	@echo "Generated Files:"
 	@echo "  OTA Files          - Standard, Tuya migration, and force upgrade variants"
@@ -79,6 +80,15 @@ BOARD_DIR := $(BOARD)$(if $(filter end_device,$(DEVICE_TYPE)),_END_DEVICE)
 BIN_PATH := bin/$(DEVICE_TYPE)/$(BOARD_DIR)
 HELPERS_PATH := ./helper_scripts
 
+# Static tables grow past the generic sizes for boards whose config needs it,
+# but never shrink, so any config that fits a generic build can still be
+# written at runtime. EXACT_CAPACITIES=1 sizes them exactly for the config.
+EXACT_CAPACITIES ?= 0
+ifneq ($(CONFIG_STR),null)
+CAPACITIES := $(shell python3 $(HELPERS_PATH)/config_capacities.py \
+	$(if $(filter 1,$(EXACT_CAPACITIES)),--exact) "$(CONFIG_STR)")
+endif
+
 # OTA Files
 ifeq ($(PLATFORM_PREFIX),silabs)
 BIN_FILE := $(BIN_PATH)/$(PROJECT_NAME)-$(VERSION_STR).s37
@@ -105,6 +115,7 @@ ifeq ($(PLATFORM_PREFIX),silabs)
 		FILE_VERSION=$(FILE_VERSION) \
 		DEVICE_TYPE=$(DEVICE_TYPE) \
 		CONFIG_STR="$(CONFIG_STR)" \
+		CAPACITIES="$(CAPACITIES)" \
 		IMAGE_TYPE=$(FIRMWARE_IMAGE_TYPE) \
 		BIN_FILE=../../$(BIN_FILE) \
 		MCU=$(MCU) 
@@ -118,6 +129,7 @@ endif
 		FILE_VERSION=$(FILE_VERSION) \
 		DEVICE_TYPE=$(DEVICE_TYPE) \
 		CONFIG_STR="$(CONFIG_STR)" \
+		CAPACITIES="$(CAPACITIES)" \
 		IMAGE_TYPE=$(FIRMWARE_IMAGE_TYPE) \
 		BIN_FILE=../../$(BIN_FILE) \
 		 -j32
@@ -0,0 +1,69 @@
+import argparse
+import csv
+import sys
+from typing import Iterable, TextIO
+
+
+def csv_to_trace(
+    rows: Iterable[list[str]], channels: dict[str, str], time_scale: float
+) -> list[str]:
+    """Stub trace records (see src/stub/trace_replay.h) for the level changes
+    of the given analyzer channels. First column is the sample time."""
+    rows = iter(rows)
+    header = next(rows)
+    columns = {}
+    for name, pin in channels.items():
+        if name not in header:
+            raise ValueError(f"Channel '{name}' not in CSV header {header}")
+        columns[header.index(name)] = pin
+
+    records = []
+    levels: dict[int, str] = {}
+    start = None
+    for row in rows:
+        if not row:
+            continue
+        t = float(row[0]) * time_scale
+        start = t if start is None else start
+        for column, pin in columns.items():
+            level = "1" if float(row[column]) >= 0.5 else "0"
+            if levels.get(column) != level:
+                levels[column] = level
+                records.append(f"{round(t - start)} gpio {pin} {level}")
+    return records
+
+
+def write_trace(records: list[str], out: TextIO) -> None:
+    out.write("# Converted from logic analyzer CSV\n")
+    for record in records:
+        out.write(record + "\n")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Convert a logic analyzer CSV export (Saleae, sigrok) to "
+        "a stub trace for `replay`. Only level changes are kept, times are "
+        "relative to the first sample.",
+    )
+    parser.add_argument("csv_file", type=str, help="Analyzer CSV export")
+    parser.add_argument(
+        "--channel",
+        action="append",
+        required=True,
+        metavar="COLUMN=PIN",
+        help="Map a CSV column to a device pin, e.g. 'Channel 0=A0'",
+    )
+    parser.add_argument(
+        "--time-unit",
+        choices=["s", "ms", "us"],
+        default="s",
+        help="Unit of the time column (default: s)",
+    )
+
+    args = parser.parse_args()
+
+    channels = dict(mapping.rsplit("=", 1) for mapping in args.channel)
+    scale = {"s": 1e6, "ms": 1e3, "us": 1.0}[args.time_unit]
+    with open(args.csv_file, newline="") as f:
+        records = csv_to_trace(csv.reader(f), channels, scale)
+    write_trace(records, sys.stdout)
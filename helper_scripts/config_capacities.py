@@ -0,0 +1,64 @@
+import argparse
+
+# Smallest size of each table, keeps arrays non-empty
+MIN_CAPACITY = 1
+
+# Defaults from src/device_config/capacities.h
+GENERIC_CAPACITIES = {
+    "DEVICE_CONFIG_MAX_BUTTONS": 5,
+    "DEVICE_CONFIG_MAX_LEDS": 5,
+    "DEVICE_CONFIG_MAX_SWITCHES": 4,
+    "DEVICE_CONFIG_MAX_RELAYS": 4,
+}
+
+
+def config_capacities(config_str: str, exact: bool = False) -> dict[str, int]:
+    """Table sizes for config_str, same rules as config_compiler.c
+
+    Never smaller than the generic sizes unless exact is set, so any config
+    that fits a generic build can still be written at runtime.
+    """
+    buttons = leds = switches = relays = 0
+    # First two fields are manufacturer and model, entries end at first empty
+    for entry in config_str.split(";")[2:]:
+        if not entry:
+            break
+        if entry == "SLP":
+            continue
+        if entry[0] in "BS":
+            buttons += 1
+            switches += entry[0] == "S"
+        elif entry[0] in "LI":
+            leds += 1
+        elif entry[0] == "R":
+            relays += 1
+
+    needed = {
+        "DEVICE_CONFIG_MAX_BUTTONS": buttons,
+        "DEVICE_CONFIG_MAX_LEDS": leds,
+        "DEVICE_CONFIG_MAX_SWITCHES": switches,
+        "DEVICE_CONFIG_MAX_RELAYS": relays,
+    }
+    floor = {} if exact else GENERIC_CAPACITIES
+    return {
+        name: max(count, floor.get(name, MIN_CAPACITY), MIN_CAPACITY)
+        for name, count in needed.items()
+    }
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Print table capacities for a device config string, "
+        "as NAME=VALUE pairs for the firmware build",
+    )
+    parser.add_argument("config_str", type=str, help="Device config string")
+    parser.add_argument(
+        "--exact",
+        action="store_true",
+        help="Size exactly for config_str, even below the generic sizes",
+    )
+
+    args = parser.parse_args()
+
+    capacities = config_capacities(args.config_str, args.exact)
+    print(" ".join(f"{name}={value}" for name, value in capacities.items()))
@@ -80,6 +80,7 @@ if __name__ == "__main__":
             "relayNames": relay_names,
             "relayIndicatorNames": relay_names[:indicators_cnt],
             "has_dedicated_net_led": has_dedicated_net_led,
+            "is_end_device": device.get("device_type") == "end_device",
         })
 
     template = env.get_template("switch_custom.js.jinja")
@@ -5,6 +5,14 @@ from pathlib import Path
 import yaml
 import subprocess
 
+from ota_compress import (
+    ALGORITHM_DELTA,
+    is_compressed,
+    parse_container,
+    upgrade_payload,
+)
+from ota_delta import patch_base_info
+
 
 BOARD_TO_MANUFACTURER_NAMES = {
     "TS0011": [
@@ -73,6 +81,15 @@ def make_ota_index_entry(file: Path, base_url: str, manufacturer_names: list[str
         "sha512": hashlib.sha512(data).hexdigest(),
         "otaHeaderString": data[20:52].decode('unicode_escape'), 
     }
+    if is_compressed(data):
+        # fileSize is what goes over the air, this is what lands in the slot
+        algorithm, size, _, block = parse_container(upgrade_payload(data))
+        res["uncompressedSize"] = size
+        if algorithm == ALGORITHM_DELTA:
+            # A patch only applies to the firmware it was made against
+            base_version = patch_base_info(block)[2]
+            res["minFileVersion"] = base_version
+            res["maxFileVersion"] = base_version
     if manufacturer_names:
         res["manufacturerName"] = manufacturer_names
     return res
@@ -159,9 +176,15 @@ if __name__ == "__main__":
             it.get("manufacturerName") != entry.get("manufacturerName")
             or it["manufacturerCode"] != entry["manufacturerCode"]    
             or it["imageType"] != entry["imageType"]
+            # Full and delta images are kept side by side
+            or ("minFileVersion" in it) != ("minFileVersion" in entry)
         ) 
     ]
-    index_data.append(entry)
+    if "minFileVersion" in entry:
+        # Before the full image, devices on the base take the smaller file
+        index_data.insert(0, entry)
+    else:
+        index_data.append(entry)
     index_file.write_text(json.dumps(
         index_data,
         indent=2,
@@ -26,6 +26,7 @@ if __name__ == "__main__":
     db = yaml.safe_load(db_str)
 
     configs = []
+    max_switches = 0
 
     for device in db.values():
         
@@ -34,6 +35,9 @@ if __name__ == "__main__":
             continue
         
         fields = device["config_str"].split(";")
+        max_switches = max(
+            max_switches, sum(1 for field in fields[2:] if field.startswith("S"))
+        )
         current_mf_name = fields[0]
         current_zb_model = fields[1]
 
@@ -54,7 +58,7 @@ if __name__ == "__main__":
 
     template = env.get_template("zha_quirk.py.jinja")
 
-    print(template.render(configs=configs))
+    print(template.render(configs=configs, max_switches=max_switches))
 
     exit(0)
 
@@ -0,0 +1,264 @@
+"""Compresses the upgrade image of a Telink .zigbee OTA file.
+
+The firmware is replaced by a container (src/zigbee/ota_image.h): a 32 byte
+header with the firmware size and CRC32, then the firmware as an LZ4 block.
+Field control bit 3 of the OTA header marks the file, the device itself only
+looks at the container magic.
+
+    python3 helper_scripts/ota_compress.py INPUT.zigbee OUTPUT.zigbee
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+OTA_MAGIC = 0x0BEEF11E
+OTA_HEADER_LENGTH_OFFSET = 6
+OTA_FIELD_CONTROL_OFFSET = 8
+OTA_TOTAL_SIZE_OFFSET = 52
+OTA_FIELD_CONTROL_COMPRESSED = 0x0008
+SUB_ELEMENT_HDR = struct.Struct("<HI")
+UPGRADE_IMAGE_TAG = 0x0000
+
+CONTAINER_MAGIC = 0x504D435A  # "ZCMP"
+CONTAINER_VERSION = 1
+ALGORITHM_LZ4 = 1
+ALGORITHM_DELTA = 2  # helper_scripts/ota_delta.py
+CONTAINER_HEADER_SIZE = 32
+# Offsets 6, 8 and 24 hold the magic, boot flag and size of a Telink image,
+# they stay invalid so that older firmware rejects the container
+CONTAINER_HEADER = struct.Struct("<IBBHIIIIII")
+INVALID = 0xFFFFFFFF
+
+MIN_MATCH = 4
+MAX_OFFSET = 0xFFFF
+# LZ4 block end rules: the last 5 bytes are literals, the last match starts
+# 12 bytes before the end at the latest
+LAST_LITERALS = 5
+MF_LIMIT = 12
+HASH_CHAIN_DEPTH = 32
+
+
+def _write_length(out: bytearray, length: int) -> None:
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def _write_sequence(
+    out: bytearray, literals: bytes, offset: int = 0, match_len: int = 0
+) -> None:
+    lit_nibble = min(len(literals), 15)
+    match_nibble = min(match_len - MIN_MATCH, 15) if match_len else 0
+    out.append(lit_nibble << 4 | match_nibble)
+    if lit_nibble == 15:
+        _write_length(out, len(literals) - 15)
+    out += literals
+    if match_len:
+        out += offset.to_bytes(2, "little")
+        if match_nibble == 15:
+            _write_length(out, match_len - MIN_MATCH - 15)
+
+
+def lz4_compress(data: bytes) -> bytes:
+    """LZ4 block, greedy matching over hash chains of 4 byte prefixes."""
+    out = bytearray()
+    heads: dict[bytes, int] = {}
+    prev = [-1] * len(data)
+    match_limit = len(data) - MF_LIMIT
+    anchor = pos = 0
+    while pos < match_limit:
+        key = data[pos : pos + MIN_MATCH]
+        best_len = best_off = 0
+        candidate = heads.get(key, -1)
+        depth = 0
+        while candidate >= 0 and pos - candidate <= MAX_OFFSET:
+            if depth == HASH_CHAIN_DEPTH:
+                break
+            length = 0
+            end = len(data) - LAST_LITERALS
+            while pos + length < end and data[candidate + length] == data[pos + length]:
+                length += 1
+            if length > best_len:
+                best_len, best_off = length, pos - candidate
+            candidate = prev[candidate]
+            depth += 1
+        prev[pos] = heads.get(key, -1)
+        heads[key] = pos
+        if best_len < MIN_MATCH:
+            pos += 1
+            continue
+        _write_sequence(out, data[anchor:pos], best_off, best_len)
+        for i in range(pos + 1, min(pos + best_len, match_limit)):
+            k = data[i : i + MIN_MATCH]
+            prev[i] = heads.get(k, -1)
+            heads[k] = i
+        pos += best_len
+        anchor = pos
+    _write_sequence(out, data[anchor:])
+    return bytes(out)
+
+
+def lz4_decompress(block: bytes) -> bytes:
+    out = bytearray()
+    pos = 0
+    while pos < len(block):
+        token = block[pos]
+        pos += 1
+        length = token >> 4
+        if length == 15:
+            while True:
+                byte = block[pos]
+                pos += 1
+                length += byte
+                if byte != 255:
+                    break
+        out += block[pos : pos + length]
+        pos += length
+        if pos == len(block):
+            break
+        offset = int.from_bytes(block[pos : pos + 2], "little")
+        pos += 2
+        length = (token & 0x0F) + MIN_MATCH
+        if token & 0x0F == 15:
+            while True:
+                byte = block[pos]
+                pos += 1
+                length += byte
+                if byte != 255:
+                    break
+        for _ in range(length):
+            out.append(out[-offset])
+    return bytes(out)
+
+
+def make_container(
+    firmware: bytes, algorithm: int = ALGORITHM_LZ4, block: bytes | None = None
+) -> bytes:
+    """Container of firmware, block is the encoded firmware for algorithm."""
+    if block is None:
+        block = lz4_compress(firmware)
+    header = CONTAINER_HEADER.pack(
+        CONTAINER_MAGIC,
+        CONTAINER_VERSION,
+        algorithm,
+        0,
+        INVALID,
+        len(firmware),
+        zlib.crc32(firmware),
+        len(block),
+        INVALID,
+        0,
+    )
+    return header + block
+
+
+def parse_container(container: bytes) -> tuple[int, int, int, bytes]:
+    """Returns the algorithm, firmware size, its CRC32 and the encoded block."""
+    magic, version, algorithm, _, _, size, crc, data_size, _, _ = (
+        CONTAINER_HEADER.unpack_from(container)
+    )
+    if magic != CONTAINER_MAGIC or version != CONTAINER_VERSION:
+        raise ValueError("not a compressed OTA container")
+    if algorithm not in (ALGORITHM_LZ4, ALGORITHM_DELTA):
+        raise ValueError(f"unknown algorithm {algorithm}")
+    block = container[CONTAINER_HEADER_SIZE : CONTAINER_HEADER_SIZE + data_size]
+    return algorithm, size, crc, block
+
+
+def split_ota_file(data: bytes) -> tuple[bytes, list[tuple[int, bytes]]]:
+    """Returns the OTA header and the (tag, payload) sub-elements."""
+    if int.from_bytes(data[0:4], "little") != OTA_MAGIC:
+        raise ValueError("not a Zigbee OTA file")
+    header_length = int.from_bytes(
+        data[OTA_HEADER_LENGTH_OFFSET : OTA_HEADER_LENGTH_OFFSET + 2], "little"
+    )
+    elements = []
+    pos = header_length
+    while pos < len(data):
+        tag, length = SUB_ELEMENT_HDR.unpack_from(data, pos)
+        pos += SUB_ELEMENT_HDR.size
+        elements.append((tag, data[pos : pos + length]))
+        pos += length
+    return data[:header_length], elements
+
+
+def _field_control(header: bytes) -> int:
+    offset = OTA_FIELD_CONTROL_OFFSET
+    return int.from_bytes(header[offset : offset + 2], "little")
+
+
+def is_compressed(data: bytes) -> bool:
+    return bool(_field_control(data) & OTA_FIELD_CONTROL_COMPRESSED)
+
+
+def upgrade_payload(data: bytes) -> bytes:
+    """Upgrade image sub-element of an OTA file, as sent."""
+    _, elements = split_ota_file(data)
+    return next(p for tag, p in elements if tag == UPGRADE_IMAGE_TAG)
+
+
+def upgrade_image(data: bytes, base: bytes | None = None) -> bytes:
+    """Firmware of an OTA file, decoded if needed. Delta files need the
+    firmware they were made against."""
+    payload = upgrade_payload(data)
+    if not is_compressed(data):
+        return payload
+    algorithm, size, crc, block = parse_container(payload)
+    if algorithm == ALGORITHM_DELTA:
+        if base is None:
+            raise ValueError("delta image needs its base firmware")
+        from ota_delta import apply_patch
+
+        firmware = apply_patch(base, block)
+    else:
+        firmware = lz4_decompress(block)
+    if len(firmware) != size or zlib.crc32(firmware) != crc:
+        raise ValueError("container does not match its firmware")
+    return firmware
+
+
+def replace_upgrade_image(data: bytes, container: bytes) -> bytes:
+    """OTA file with container as upgrade image, marked as compressed."""
+    header, elements = split_ota_file(data)
+    body = b""
+    for tag, payload in elements:
+        if tag == UPGRADE_IMAGE_TAG:
+            payload = container
+        body += SUB_ELEMENT_HDR.pack(tag, len(payload)) + payload
+    header = bytearray(header)
+    field_control = _field_control(header) | OTA_FIELD_CONTROL_COMPRESSED
+    struct.pack_into("<H", header, OTA_FIELD_CONTROL_OFFSET, field_control)
+    struct.pack_into("<I", header, OTA_TOTAL_SIZE_OFFSET, len(header) + len(body))
+    return bytes(header) + body
+
+
+def compress_ota_file(data: bytes) -> bytes:
+    if is_compressed(data):
+        raise ValueError("already compressed")
+    return replace_upgrade_image(data, make_container(upgrade_payload(data)))
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="Plain .zigbee OTA file")
+    parser.add_argument("output", help="Compressed .zigbee OTA file")
+    args = parser.parse_args()
+
+    data = Path(args.input).read_bytes()
+    compressed = compress_ota_file(data)
+    # Cheap enough to never publish a file that does not unpack
+    if upgrade_image(compressed) != upgrade_image(data):
+        sys.exit("Error: compressed image does not round trip")
+    Path(args.output).write_bytes(compressed)
+    print(
+        f"{args.output}: {len(data)} -> {len(compressed)} bytes "
+        f"({100 * len(compressed) // len(data)}%)"
+    )
+
+
+if __name__ == "__main__":
+    main()
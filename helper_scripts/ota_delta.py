@@ -0,0 +1,231 @@
+"""Builds a delta OTA file that turns one Telink firmware into the next one.
+
+The upgrade image is a container (src/zigbee/ota_image.h) of algorithm 2.
+Its block starts with the size, CRC32 and file version of the base firmware,
+then come ops that copy ranges of the base, copy earlier output or insert
+literals. The device reads the base from the slot it runs from and writes
+the new firmware into the other one, so the patch only applies to exactly
+that base.
+
+    python3 helper_scripts/ota_delta.py OLD.zigbee NEW.zigbee OUT.zigbee
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+import ota_compress
+
+BASE_INFO = struct.Struct("<III")  # size, CRC32, file version
+
+OP_LITERALS = 0
+OP_COPY_BASE = 1
+OP_COPY_OUTPUT = 2
+# Low 6 bits of an op are the length - 1, 63 means a varint of length - 64
+# follows
+OP_SHORT_LEN_MAX = 63
+OP_LONG_LEN_BASE = 64
+
+# Shortest copies worth an op, a base copy at the cursor is the cheapest
+MIN_CURSOR_COPY = 3
+MIN_BASE_COPY = 8
+MIN_OUTPUT_COPY = 6
+HASH_LEN = 6
+HASH_CHAIN_DEPTH = 16
+
+
+def _varint(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def _read_varint(data: bytes, pos: int) -> tuple[int, int]:
+    value = shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def _zigzag(value: int) -> int:
+    return value * 2 if value >= 0 else -value * 2 - 1
+
+
+def _unzigzag(value: int) -> int:
+    return value >> 1 if not value & 1 else -(value >> 1) - 1
+
+
+def _op(kind: int, length: int) -> bytes:
+    if length <= OP_SHORT_LEN_MAX:
+        return bytes([kind << 6 | (length - 1)])
+    return bytes([kind << 6 | OP_SHORT_LEN_MAX]) + _varint(length - OP_LONG_LEN_BASE)
+
+
+def _match_len(a: bytes, a_pos: int, b: bytes, b_pos: int) -> int:
+    length = 0
+    limit = min(len(a) - a_pos, len(b) - b_pos)
+    while length < limit and a[a_pos + length] == b[b_pos + length]:
+        length += 1
+    return length
+
+
+class _Index:
+    """Hash chains of HASH_LEN byte prefixes."""
+
+    def __init__(self) -> None:
+        self.heads: dict[bytes, int] = {}
+        self.prev: dict[int, int] = {}
+
+    def add(self, data: bytes, pos: int) -> None:
+        key = data[pos : pos + HASH_LEN]
+        if len(key) == HASH_LEN:
+            self.prev[pos] = self.heads.get(key, -1)
+            self.heads[key] = pos
+
+    def candidates(self, key: bytes):
+        pos = self.heads.get(key, -1)
+        for _ in range(HASH_CHAIN_DEPTH):
+            if pos < 0:
+                return
+            yield pos
+            pos = self.prev[pos]
+
+
+def make_patch(base: bytes, new: bytes, base_version: int) -> bytes:
+    """Greedy patch: at each position the longest copy, literals otherwise."""
+    base_index = _Index()
+    for pos in range(len(base)):
+        base_index.add(base, pos)
+    out_index = _Index()
+
+    out = bytearray(BASE_INFO.pack(len(base), zlib.crc32(base), base_version))
+    literals = bytearray()
+    cursor = 0  # Base offset base copies are relative to
+    pos = 0
+
+    def flush_literals() -> None:
+        if literals:
+            out.extend(_op(OP_LITERALS, len(literals)) + literals)
+            literals.clear()
+
+    while pos < len(new):
+        best = (0, OP_LITERALS, 0)
+        if cursor < len(base):
+            length = _match_len(base, cursor, new, pos)
+            if length >= MIN_CURSOR_COPY:
+                best = (length, OP_COPY_BASE, cursor)
+        key = new[pos : pos + HASH_LEN]
+        for candidate in base_index.candidates(key):
+            length = _match_len(base, candidate, new, pos)
+            if length >= MIN_BASE_COPY and length > best[0]:
+                best = (length, OP_COPY_BASE, candidate)
+        for candidate in out_index.candidates(key):
+            length = _match_len(new, candidate, new, pos)
+            if length >= MIN_OUTPUT_COPY and length > best[0] + 2:
+                best = (length, OP_COPY_OUTPUT, candidate)
+
+        length, kind, source = best
+        if kind == OP_LITERALS:
+            literals.append(new[pos])
+            out_index.add(new, pos)
+            pos += 1
+            # Literals usually replace base bytes one for one
+            cursor += 1
+            continue
+        flush_literals()
+        out += _op(kind, length)
+        if kind == OP_COPY_BASE:
+            out += _varint(_zigzag(source - cursor))
+            cursor = source + length
+        else:
+            out += _varint(pos - source)
+        for i in range(pos, pos + length):
+            out_index.add(new, i)
+        pos += length
+    flush_literals()
+    return bytes(out)
+
+
+def patch_base_info(block: bytes) -> tuple[int, int, int]:
+    """Returns the size, CRC32 and file version of the base firmware."""
+    return BASE_INFO.unpack_from(block)
+
+
+def apply_patch(base: bytes, block: bytes) -> bytes:
+    size, crc, _ = patch_base_info(block)
+    if len(base) != size or zlib.crc32(base) != crc:
+        raise ValueError("patch made for another base firmware")
+    out = bytearray()
+    cursor = 0
+    pos = BASE_INFO.size
+    while pos < len(block):
+        kind, length = block[pos] >> 6, (block[pos] & 0x3F) + 1
+        pos += 1
+        if length > OP_SHORT_LEN_MAX:
+            extra, pos = _read_varint(block, pos)
+            length = OP_LONG_LEN_BASE + extra
+        if kind == OP_LITERALS:
+            out += block[pos : pos + length]
+            pos += length
+            cursor += length
+        elif kind == OP_COPY_BASE:
+            delta, pos = _read_varint(block, pos)
+            cursor += _unzigzag(delta)
+            out += base[cursor : cursor + length]
+            cursor += length
+        elif kind == OP_COPY_OUTPUT:
+            distance, pos = _read_varint(block, pos)
+            for _ in range(length):
+                out.append(out[-distance])
+        else:
+            raise ValueError(f"bad op {kind}")
+    return bytes(out)
+
+
+def make_delta_ota_file(old: bytes, new: bytes) -> bytes:
+    """OTA file with the header of new and a patch against old."""
+    base = ota_compress.upgrade_image(old)
+    firmware = ota_compress.upgrade_image(new)
+    base_version = int.from_bytes(old[14:18], "little")
+    block = make_patch(base, firmware, base_version)
+    container = ota_compress.make_container(
+        firmware, ota_compress.ALGORITHM_DELTA, block
+    )
+    return ota_compress.replace_upgrade_image(new, container)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("old", help="OTA file of the firmware devices run now")
+    parser.add_argument("new", help="OTA file of the firmware to update to")
+    parser.add_argument("output", help="Delta .zigbee OTA file")
+    args = parser.parse_args()
+
+    old = Path(args.old).read_bytes()
+    new = Path(args.new).read_bytes()
+    delta = make_delta_ota_file(old, new)
+    # Never publish a patch that does not rebuild the new firmware
+    base = ota_compress.upgrade_image(old)
+    if ota_compress.upgrade_image(delta, base) != ota_compress.upgrade_image(new):
+        sys.exit("Error: patch does not round trip")
+    Path(args.output).write_bytes(delta)
+    print(
+        f"{args.output}: {len(new)} -> {len(delta)} bytes "
+        f"({100 * len(delta) // len(new)}%)"
+    )
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,116 @@
+"""Decodes tokenized UART logs of a Telink debug build (src/hal/tlog.h).
+
+Frames are 0xFE, nargs, token (u32), args (u32 each), little endian. The
+token is the flash address of the format string, looked up in the ELF the
+firmware was built from. Plain printf text between frames is passed through.
+
+    python3 helper_scripts/tlog_decode.py build/tlsr8258/<device>.elf /dev/ttyUSB0
+"""
+
+import argparse
+import re
+import struct
+import sys
+from typing import BinaryIO, Callable, Iterator
+
+FRAME_START = 0xFE
+DROPPED_TOKEN = 0
+MAX_ARGS = 6
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+_CONVERSION = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(hh|h|ll|l|z|t)?([diuxXcp%])")
+
+
+class Elf:
+    """Reads NUL-terminated strings at load addresses of a 32-bit LE ELF."""
+
+    def __init__(self, path: str) -> None:
+        with open(path, "rb") as f:
+            data = f.read()
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            raise ValueError(f"{path}: not a 32-bit little endian ELF")
+        shoff, _, _, _, _, shentsize, shnum = struct.unpack_from("<IIHHHHH", data, 32)
+        self.sections = []
+        for i in range(shnum):
+            (_, sh_type, flags, addr, offset, size) = struct.unpack_from(
+                "<IIIIII", data, shoff + i * shentsize
+            )
+            if flags & SHF_ALLOC and sh_type != SHT_NOBITS and size:
+                self.sections.append((addr, data[offset : offset + size]))
+
+    def string_at(self, addr: int) -> str | None:
+        for start, body in self.sections:
+            if start <= addr < start + len(body):
+                end = body.find(b"\0", addr - start)
+                return body[addr - start : end].decode(errors="replace")
+        return None
+
+
+def format_message(fmt: str, args: list[int]) -> str:
+    """printf with the raw u32 arguments of a frame."""
+    values = iter(args)
+
+    def convert(match: re.Match) -> str:
+        flags, _, kind = match.groups()
+        if kind == "%":
+            return "%"
+        value = next(values, 0)
+        if kind in "di":
+            value = value - (1 << 32) if value & 0x80000000 else value
+            kind = "d"
+        elif kind == "u":
+            kind = "d"
+        elif kind == "p":
+            return f"0x{value:08x}"
+        return f"%{flags}{kind}" % value
+
+    return _CONVERSION.sub(convert, fmt)
+
+
+def decode(stream: BinaryIO, lookup: Callable[[int], str | None]) -> Iterator[str]:
+    """Yields text chunks: passed through text and decoded frames."""
+    while True:
+        byte = stream.read(1)
+        if not byte:
+            return
+        if byte[0] != FRAME_START:
+            yield byte.decode(errors="replace")
+            continue
+        header = stream.read(5)
+        if len(header) < 5 or header[0] > MAX_ARGS:
+            yield "<tlog: bad frame>\r\n"
+            continue
+        nargs, token = struct.unpack("<BI", header)
+        body = stream.read(4 * nargs)
+        if len(body) < 4 * nargs:
+            return
+        args = list(struct.unpack(f"<{nargs}I", body))
+        if token == DROPPED_TOKEN:
+            yield f"<tlog: {args[0] if args else '?'} messages dropped>\r\n"
+            continue
+        fmt = lookup(token)
+        if fmt is None:
+            yield f"<tlog: unknown token 0x{token:08x} {args}>\r\n"
+        else:
+            yield format_message(fmt, args)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("elf", help="ELF of the flashed firmware")
+    parser.add_argument(
+        "input", nargs="?", help="Capture file or serial port, stdin by default"
+    )
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    stream = open(args.input, "rb", buffering=0) if args.input else sys.stdin.buffer
+    for text in decode(stream, elf.string_at):
+        sys.stdout.write(text)
+        sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
@@ -1,13 +1,21 @@
+#include "base_components/diagnostics.h"
 #include "device_config/config_parser.h"
 #include "device_config/device_type.h"
+#include "device_config/nvm_cache.h"
 #include "device_config/nvm_items.h"
 #include "device_config/reset.h"
-#include "hal/nvm.h"
 #include "hal/printf_selector.h"
 #include "hal/system.h"
 #include "hal/zigbee.h"
 #include "hal/zigbee_ota.h"
+#include "zigbee/device_random.h"
+#include "zigbee/fast_rejoin.h"
 #include "zigbee/general_commands.h"
+#include "zigbee/network_steering.h"
+#include "zigbee/ota_image.h"
+#include "zigbee/ota_resume.h"
+#include "zigbee/poll_control.h"
+#include "zigbee/startup_traffic.h"
 
 void process_device_type_change() {
   // If device was updated from router to end device or vice versa,
@@ -16,13 +24,13 @@ void process_device_type_change() {
   // Read device type from NVM and compare with current configuration.
   enum device_type_t stored_device_type;
   hal_nvm_status_t st =
-      hal_nvm_read(NV_ITEM_DEVICE_TYPE, sizeof(stored_device_type),
-                   (uint8_t *)&stored_device_type);
+      nvm_cache_read(NV_ITEM_DEVICE_TYPE, sizeof(stored_device_type),
+                     (uint8_t *)&stored_device_type);
   if (st != HAL_NVM_SUCCESS) {
     // Unable to read device type from NVM, possibly first boot.
     stored_device_type = CURRENT_DEVICE_TYPE;
-    hal_nvm_write(NV_ITEM_DEVICE_TYPE, sizeof(stored_device_type),
-                  (uint8_t *)&stored_device_type);
+    nvm_cache_write(NV_ITEM_DEVICE_TYPE, sizeof(stored_device_type),
+                    (uint8_t *)&stored_device_type);
     return;
   }
   if (stored_device_type != CURRENT_DEVICE_TYPE) {
@@ -30,8 +38,8 @@ void process_device_type_change() {
            CURRENT_DEVICE_TYPE);
     // Device type has changed, update NVM and reset device.
     stored_device_type = CURRENT_DEVICE_TYPE;
-    hal_nvm_write(NV_ITEM_DEVICE_TYPE, sizeof(stored_device_type),
-                  (uint8_t *)&stored_device_type);
+    nvm_cache_write(NV_ITEM_DEVICE_TYPE, sizeof(stored_device_type),
+                    (uint8_t *)&stored_device_type);
     // Perform a factory reset to clear incompatible network settings.
     hal_factory_reset();
     schedule_reboot(2000);
@@ -39,6 +47,9 @@ void process_device_type_change() {
 }
 
 void app_init(void) {
+  diagnostics_init();
+  // Items read several times below hit flash only once
+  nvm_cache_start();
   handle_version_changes();
   parse_config(); // Does most of the setup, including all callbacks
                   // registration
@@ -46,19 +57,30 @@ void app_init(void) {
   init_global_attr_write_callback();
 
   process_device_type_change();
+  poll_control_init();
+  device_random_init();
+  fast_rejoin_init(); // Reads its NVM item
+  nvm_cache_release();
+  ota_resume_init(); // Read once, no need to cache it
+  network_steering_init();
+  startup_traffic_init();
 }
 
-static bool boot_announce_sent = false;
-
 void app_task() {
-  // TODO: add jitter to avoid all devices trying to join at once
-  if (hal_zigbee_get_network_status() != HAL_ZIGBEE_NETWORK_JOINED &&
-      hal_zigbee_get_network_status() != HAL_ZIGBEE_NETWORK_JOINING) {
-    hal_zigbee_start_network_steering();
-  }
-  if (!boot_announce_sent &&
-      hal_zigbee_get_network_status() == HAL_ZIGBEE_NETWORK_JOINED) {
-    hal_zigbee_send_announce();
-    boot_announce_sent = true;
-  }
-}
\ No newline at end of file
+  diagnostics_update();
+  poll_control_update();
+  ota_resume_update();
+}
+
+#ifdef HAL_STUB
+void app_reset_state(void) {
+  device_config_reset_state();
+  device_random_reset_state();
+  fast_rejoin_reset_state();
+  network_steering_reset_state();
+  ota_image_reset_state();
+  ota_resume_reset_state();
+  poll_control_reset_state();
+  startup_traffic_reset_state();
+}
+#endif
\ No newline at end of file
@@ -4,4 +4,10 @@
 void app_init(void);
 void app_task(void);
 
+#ifdef HAL_STUB
+// Host simulator only: returns all firmware globals to their boot values, so
+// app_init() can run again in the same process
+void app_reset_state(void);
+#endif
+
 #endif // APP_H
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "button.h"
+#include "diagnostics.h"
 #include "hal/printf_selector.h"
 #include "hal/tasks.h"
 #include "hal/timer.h"
+#include "hal/tlog.h"
 #include <stdbool.h>
 #include <stddef.h>
 
@@ -28,6 +30,7 @@ void btn_init(button_t *button) {
 
 void _btn_gpio_callback(hal_gpio_pin_t pin, void *arg) {
   button_t *button = (button_t *)arg;
+  diagnostics.gpio_interrupts++;
   uint8_t new_state = hal_gpio_read(button->pin);
   if (new_state == button->debounce_last_state) {
     return;
@@ -37,7 +40,7 @@ void _btn_gpio_callback(hal_gpio_pin_t pin, void *arg) {
   button->debounce_last_state = new_state;
   button->debounce_last_change = hal_millis();
   hal_tasks_schedule(&button->update_task, DEBOUNCE_DELAY_MS);
-  printf("Button value changed to %d\r\n", button->debounce_last_state);
+  TLOG("Button value changed to %d\r\n", button->debounce_last_state);
 }
 
 void _btn_update_callback(void *arg) {
@@ -46,10 +49,12 @@ void _btn_update_callback(void *arg) {
                        button->debounce_last_state == button->pressed_when_high,
                        button->debounce_last_change);
   if (button->pressed && !button->long_pressed) {
+    // Long press needs strictly more than the duration, check again on the
+    // first millisecond past it
     uint32_t pressed_for = hal_millis() - button->pressed_at_ms;
     hal_tasks_schedule(&button->update_task,
-                       pressed_for < button->long_press_duration_ms
-                           ? button->long_press_duration_ms - pressed_for
+                       pressed_for <= button->long_press_duration_ms
+                           ? button->long_press_duration_ms - pressed_for + 1
                            : 0);
   }
 }
@@ -57,14 +62,14 @@ void _btn_update_callback(void *arg) {
 void btn_update_debounced(button_t *button, uint8_t is_pressed,
                           uint32_t changed_at) {
   if (!button->pressed && is_pressed) {
-    printf("Press detected\r\n");
+    TLOG("Press detected\r\n");
     button->pressed_at_ms = changed_at;
     if (button->on_press != NULL) {
       button->on_press(button->callback_param);
     }
     if (changed_at - button->released_at_ms < button->multi_press_duration_ms) {
       button->multi_press_cnt += 1;
-      printf("Multi press detected: %d\r\n", button->multi_press_cnt);
+      TLOG("Multi press detected: %d\r\n", button->multi_press_cnt);
       if (button->on_multi_press != NULL) {
         button->on_multi_press(button->callback_param, button->multi_press_cnt);
       }
@@ -72,20 +77,24 @@ void btn_update_debounced(button_t *button, uint8_t is_pressed,
       button->multi_press_cnt = 1;
     }
   } else if (button->pressed && !is_pressed) {
-    printf("Release detected\r\n");
+    TLOG("Release detected\r\n");
     button->released_at_ms = changed_at;
     button->long_pressed = false;
     if (button->on_release != NULL) {
       button->on_release(button->callback_param);
     }
   }
+  if (button->pressed != is_pressed) {
+    button->events++;
+    diagnostics.button_events++;
+  }
   button->pressed = is_pressed;
 
   uint32_t now = hal_millis();
   if (is_pressed && !button->long_pressed &&
       (button->long_press_duration_ms < (now - button->pressed_at_ms))) {
     button->long_pressed = true;
-    printf("Long press detected\r\n");
+    TLOG("Long press detected\r\n");
     if (button->on_long_press != NULL) {
       button->on_long_press(button->callback_param);
     }
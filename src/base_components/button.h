@@ -28,6 +28,7 @@ typedef struct {
   ev_button_callback_t on_release;
   ev_button_multi_press_callback_t on_multi_press;
   void *callback_param;
+  uint32_t events; // Debounced presses and releases
 } button_t;
 
 void btn_init(button_t *button);
@@ -0,0 +1,28 @@
+#include "diagnostics.h"
+#include "hal/system.h"
+#include "hal/timer.h"
+#include <string.h>
+
+diagnostics_t diagnostics;
+
+static uint32_t last_update_ms;
+static uint16_t uptime_ms;
+
+void diagnostics_init(void) {
+  memset(&diagnostics, 0, sizeof(diagnostics));
+  diagnostics.reset_reason = hal_system_get_reset_reason();
+  last_update_ms = hal_millis();
+  uptime_ms = 0;
+}
+
+void diagnostics_update(void) {
+  uint32_t now = hal_millis();
+  // The Telink millisecond clock wraps long before 32 bits, treat going
+  // backwards as a wrap and lose at most the part before it
+  uint32_t elapsed = now >= last_update_ms ? now - last_update_ms : now;
+  last_update_ms = now;
+
+  elapsed += uptime_ms;
+  diagnostics.uptime_s += elapsed / 1000;
+  uptime_ms = elapsed % 1000;
+}
@@ -0,0 +1,47 @@
+#ifndef _DIAGNOSTICS_H_
+#define _DIAGNOSTICS_H_
+
+#include <stdint.h>
+
+// Runtime counters since boot, exposed read-only by the diagnostics cluster.
+// Counters wrap around, readers should look at differences.
+typedef struct {
+  uint32_t uptime_s;
+  uint8_t reset_reason;   // hal_reset_reason_t
+  uint32_t button_events; // Debounced presses and releases of all buttons
+  uint32_t relay_operations;
+  uint32_t latching_pulses; // Coil pulses queued for latching relays
+  uint32_t zcl_cmds_received;
+  uint32_t zcl_cmds_sent;
+  uint32_t send_failures; // Failed hal_zigbee_send_cmd_to_bindings()
+  uint32_t reports_sent;  // Attribute changes handed to the stack reporting
+  uint32_t nvm_writes;
+  uint16_t tasks_peak; // Most tasks scheduled at the same time
+  uint32_t gpio_interrupts;
+  // Main loop timing, only filled by builds with LOOP_PROFILE
+  uint32_t loop_max_us;
+  uint32_t loop_avg_us;
+  uint32_t loop_slow_count;   // Iterations over LOOP_PROFILE_SLOW_US
+  uint8_t loop_slowest_stage; // Stage with the highest max, loop_stage_t
+  uint32_t sleep_ms;          // Time spent in power management sleep
+} diagnostics_t;
+
+extern diagnostics_t diagnostics;
+
+/** Clears all counters and records the reset reason, called once at boot */
+void diagnostics_init(void);
+
+/** Advances the uptime, called from the main loop */
+void diagnostics_update(void);
+
+/**
+ * Records the number of tasks scheduled right now, for the peak
+ * @param scheduled Currently scheduled tasks
+ */
+static inline void diagnostics_tasks_scheduled(uint16_t scheduled) {
+  if (scheduled > diagnostics.tasks_peak) {
+    diagnostics.tasks_peak = scheduled;
+  }
+}
+
+#endif
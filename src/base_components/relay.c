@@ -1,7 +1,9 @@
 #include "relay.h"
+#include "diagnostics.h"
 #include "hal/gpio.h"
 #include "hal/printf_selector.h"
 #include "hal/tasks.h"
+#include "hal/tlog.h"
 #include <stddef.h>
 
 #ifndef RELAY_PULSE_MS
@@ -38,7 +40,7 @@ static void relay_start_latching_pulse(relay_t *relay) {
     relay->latching_task.handler = (task_handler_t)relay_end_latching_pulse;
     hal_tasks_schedule(&relay->latching_task, RELAY_PULSE_MS);
   } else {
-    printf("relay_start_latching_pulse: another pulse is active\r\n");
+    TLOG("relay_start_latching_pulse: another pulse is active\r\n");
     relay->latching_task.handler = (task_handler_t)relay_start_latching_pulse;
     hal_tasks_schedule(&relay->latching_task, PULSE_WAIT_END_MS);
   }
@@ -59,7 +61,8 @@ void relay_on(relay_t *relay) {
   if (relay == NULL) {
     return;
   }
-  printf("relay_on\r\n");
+  TLOG("relay_on\r\n");
+  diagnostics.relay_operations++;
 
   relay->on = 1;
   if (!relay->is_latching) {
@@ -67,6 +70,7 @@ void relay_on(relay_t *relay) {
     hal_gpio_write(relay->pin, relay->on_high);
   } else {
     // Bi-stable relay
+    diagnostics.latching_pulses++;
     relay_end_latching_pulse(relay);
     hal_tasks_unschedule(&relay->latching_task);
     relay_start_latching_pulse(relay);
@@ -81,7 +85,8 @@ void relay_off(relay_t *relay) {
   if (relay == NULL) {
     return;
   }
-  printf("relay_off\r\n");
+  TLOG("relay_off\r\n");
+  diagnostics.relay_operations++;
 
   relay->on = 0;
   if (!relay->is_latching) {
@@ -89,6 +94,7 @@ void relay_off(relay_t *relay) {
     hal_gpio_write(relay->pin, !relay->on_high);
   } else {
     // Bi-stable relay
+    diagnostics.latching_pulses++;
     relay_end_latching_pulse(relay);
     hal_tasks_unschedule(&relay->latching_task);
     relay_start_latching_pulse(relay);
@@ -103,7 +109,7 @@ void relay_toggle(relay_t *relay) {
   if (relay == NULL) {
     return;
   }
-  printf("relay_toggle\r\n");
+  TLOG("relay_toggle\r\n");
 
   if (relay->on) {
     relay_off(relay);
@@ -111,3 +117,7 @@ void relay_toggle(relay_t *relay) {
     relay_on(relay);
   }
 }
+
+#ifdef HAL_STUB
+void relay_reset_pulse_owner(void) { pulse_relay = NULL; }
+#endif
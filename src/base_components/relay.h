@@ -46,4 +46,13 @@ void relay_off(relay_t *relay);
  */
 void relay_toggle(relay_t *relay);
 
+#ifdef HAL_STUB
+/**
+ * @brief      Forget the relay owning the latching pulse, for a state reset
+ *             of the host simulator
+ * @return     none
+ */
+void relay_reset_pulse_owner(void);
+#endif
+
 #endif
@@ -0,0 +1,49 @@
+#ifndef _CAPACITIES_H_
+#define _CAPACITIES_H_
+
+// Sizes of the static tables filled from the device config. Board builds set
+// them from the board's config_str (helper_scripts/config_capacities.py),
+// never below the defaults below unless built with EXACT_CAPACITIES=1.
+// Keep the defaults in sync with GENERIC_CAPACITIES in that script.
+
+#ifdef HAL_SILABS
+#include "silabs_config.h"
+#endif
+
+#ifndef DEVICE_CONFIG_MAX_BUTTONS
+#define DEVICE_CONFIG_MAX_BUTTONS 5
+#endif
+
+#ifndef DEVICE_CONFIG_MAX_LEDS
+#define DEVICE_CONFIG_MAX_LEDS 5
+#endif
+
+#ifndef DEVICE_CONFIG_MAX_SWITCHES
+#define DEVICE_CONFIG_MAX_SWITCHES 4
+#endif
+
+#ifndef DEVICE_CONFIG_MAX_RELAYS
+#define DEVICE_CONFIG_MAX_RELAYS 4
+#endif
+
+// Each switch and relay gets its own endpoint, endpoint 1 always exists
+#define DEVICE_CONFIG_MAX_ENDPOINTS                                            \
+  (DEVICE_CONFIG_MAX_SWITCHES + DEVICE_CONFIG_MAX_RELAYS > 0                   \
+       ? DEVICE_CONFIG_MAX_SWITCHES + DEVICE_CONFIG_MAX_RELAYS                 \
+       : 1)
+
+// Basic + Diagnostics + OTA, On/Off switch config + On/Off client +
+// Multistate + Level client per switch, On/Off + Groups per relay
+#define DEVICE_CONFIG_MAX_CLUSTERS                                             \
+  (3 + 4 * DEVICE_CONFIG_MAX_SWITCHES + 2 * DEVICE_CONFIG_MAX_RELAYS)
+
+// Buttons and switches, LEDs and indicators, relays, plus i, M and SLP
+#define DEVICE_CONFIG_MAX_ENTRIES                                              \
+  (DEVICE_CONFIG_MAX_BUTTONS + DEVICE_CONFIG_MAX_LEDS +                        \
+   DEVICE_CONFIG_MAX_RELAYS + 3)
+
+#if DEVICE_CONFIG_MAX_SWITCHES > 13 || DEVICE_CONFIG_MAX_RELAYS > 13
+#error "NVM item layout supports at most 13 switches and 13 relays"
+#endif
+
+#endif
@@ -0,0 +1,248 @@
+#include "config_compiler.h"
+#include "hal/gpio.h"
+#include "hal/printf_selector.h"
+#include "nvm_cache.h"
+#include "nvm_items.h"
+#include <stddef.h>
+#include <string.h>
+
+// Bump when the descriptor layout or the meaning of its fields changes, so
+// descriptors stored by older firmware are compiled again
+#define DEVICE_CONFIG_COMPILED_MAGIC 0xD1
+
+#define DEVICE_CONFIG_NAME_MAX_LEN 31
+#define DEVICE_CONFIG_TOKEN_MAX_LEN 15
+
+#define DEVICE_CONFIG_COMPILED_SIZE(entries_cnt)                               \
+  (offsetof(device_config_compiled_t, entries) +                               \
+   (entries_cnt) * sizeof(device_config_entry_t))
+
+static uint32_t fnv1a_hash(const uint8_t *data, uint16_t len) {
+  uint32_t hash = 2166136261u;
+  for (uint16_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+static uint32_t parse_int(const char *s) {
+  uint32_t n = 0;
+  while (*s >= '0' && *s <= '9') {
+    n = n * 10 + (uint32_t)(*s - '0');
+    s++;
+  }
+  return n;
+}
+
+static uint16_t field_len(const uint8_t *str, uint16_t size, uint16_t start) {
+  uint16_t end = start;
+  while (end < size && str[end] != ';' && str[end] != '\0') {
+    end++;
+  }
+  return end - start;
+}
+
+// Parses a single entry, token is NULL terminated. Unknown entries are
+// skipped (kind stays 0), as older firmware did.
+static bool compile_entry(const char *token, device_config_entry_t *entry) {
+  entry->kind = 0;
+  entry->arg = 0;
+  entry->pin = HAL_INVALID_PIN;
+  entry->off_pin = HAL_INVALID_PIN;
+
+  if (strcmp(token, "SLP") == 0) {
+    // Simultaneous Latching Pulses == SLP
+    entry->kind = DEVICE_CONFIG_ENTRY_SLP;
+    return true;
+  }
+
+  switch (token[0]) {
+  case 'B':
+  case 'S':
+    entry->kind = token[0] == 'B' ? DEVICE_CONFIG_ENTRY_RESET_BUTTON
+                                  : DEVICE_CONFIG_ENTRY_SWITCH;
+    entry->pin = hal_gpio_parse_pin(token + 1);
+    if (entry->pin == HAL_INVALID_PIN) {
+      return false;
+    }
+    entry->arg = hal_gpio_parse_pull(token + 3);
+    return true;
+  case 'L':
+  case 'I':
+    entry->kind = token[0] == 'L' ? DEVICE_CONFIG_ENTRY_STATUS_LED
+                                  : DEVICE_CONFIG_ENTRY_INDICATOR_LED;
+    entry->pin = hal_gpio_parse_pin(token + 1);
+    entry->arg = token[3] != 'i';
+    return entry->pin != HAL_INVALID_PIN;
+  case 'R':
+    entry->kind = DEVICE_CONFIG_ENTRY_RELAY;
+    entry->pin = hal_gpio_parse_pin(token + 1);
+    if (entry->pin == HAL_INVALID_PIN) {
+      return false;
+    }
+    if (token[3] != '\0') {
+      entry->off_pin = hal_gpio_parse_pin(token + 3);
+      return entry->off_pin != HAL_INVALID_PIN;
+    }
+    return true;
+  case 'i':
+    entry->kind = DEVICE_CONFIG_ENTRY_IMAGE_TYPE;
+    entry->pin = (uint16_t)parse_int(token + 1);
+    return true;
+  case 'M':
+    entry->kind = DEVICE_CONFIG_ENTRY_MOMENTARY;
+    return true;
+  default:
+    return true;
+  }
+}
+
+typedef struct {
+  uint8_t buttons;
+  uint8_t leds;
+  uint8_t switches;
+  uint8_t relays;
+} entry_counts_t;
+
+// Counts the entry against the table sizes, counts are left as they were if
+// it does not fit
+static bool count_entry(const device_config_entry_t *entry,
+                        entry_counts_t *counts) {
+  entry_counts_t next = *counts;
+  switch (entry->kind) {
+  case DEVICE_CONFIG_ENTRY_SWITCH:
+    next.switches++;
+    // fall through
+  case DEVICE_CONFIG_ENTRY_RESET_BUTTON:
+    next.buttons++;
+    break;
+  case DEVICE_CONFIG_ENTRY_STATUS_LED:
+  case DEVICE_CONFIG_ENTRY_INDICATOR_LED:
+    next.leds++;
+    break;
+  case DEVICE_CONFIG_ENTRY_RELAY:
+    next.relays++;
+    break;
+  }
+  if (next.buttons > DEVICE_CONFIG_MAX_BUTTONS ||
+      next.leds > DEVICE_CONFIG_MAX_LEDS ||
+      next.switches > DEVICE_CONFIG_MAX_SWITCHES ||
+      next.relays > DEVICE_CONFIG_MAX_RELAYS) {
+    return false;
+  }
+  *counts = next;
+  return true;
+}
+
+// dropped is NULL to reject configs that don't fit, otherwise entries past
+// the tables are left out and counted there
+static bool compile(const uint8_t *str, uint16_t size,
+                    device_config_compiled_t *out, uint8_t *dropped) {
+  memset(out, 0, offsetof(device_config_compiled_t, entries));
+  out->magic = DEVICE_CONFIG_COMPILED_MAGIC;
+  out->source_hash = fnv1a_hash(str, size);
+
+  uint16_t pos = 0;
+  uint16_t len = field_len(str, size, pos);
+  if (len > DEVICE_CONFIG_NAME_MAX_LEN) {
+    printf("Manufacturer too big\r\n");
+    return false;
+  }
+  out->manufacturer_len = len;
+  pos += len + 1;
+
+  len = pos < size ? field_len(str, size, pos) : 0;
+  if (len > DEVICE_CONFIG_NAME_MAX_LEN) {
+    printf("Model too big\r\n");
+    return false;
+  }
+  out->model_len = len;
+  pos += len + 1;
+
+  entry_counts_t counts = {0};
+
+  // Entries end at the end of the string or at the first empty entry
+  while (pos < size && (len = field_len(str, size, pos)) != 0) {
+    char token[DEVICE_CONFIG_TOKEN_MAX_LEN + 1];
+    device_config_entry_t entry = {0};
+
+    if (len <= DEVICE_CONFIG_TOKEN_MAX_LEN) {
+      memcpy(token, str + pos, len);
+      token[len] = '\0';
+      if (!compile_entry(token, &entry)) {
+        printf("Invalid config entry: %s\r\n", token);
+        return false;
+      }
+    }
+    pos += len + 1;
+
+    if (entry.kind == 0) {
+      continue;
+    }
+    if (out->entries_cnt >= DEVICE_CONFIG_MAX_ENTRIES ||
+        !count_entry(&entry, &counts)) {
+      if (dropped == NULL) {
+        printf("Too many config entries\r\n");
+        return false;
+      }
+      (*dropped)++;
+      continue;
+    }
+    out->entries[out->entries_cnt++] = entry;
+  }
+
+  return true;
+}
+
+bool device_config_compile(const uint8_t *str, uint16_t size,
+                           device_config_compiled_t *out) {
+  return compile(str, size, out, NULL);
+}
+
+bool device_config_compile_fitting(const uint8_t *str, uint16_t size,
+                                   device_config_compiled_t *out,
+                                   uint8_t *dropped) {
+  *dropped = 0;
+  return compile(str, size, out, dropped);
+}
+
+bool device_config_compiled_write_to_nv(device_config_compiled_t *out) {
+  if (!device_config_compile(device_config_str.data, device_config_str.size,
+                             out)) {
+    return false;
+  }
+  nvm_cache_write(NV_ITEM_DEVICE_CONFIG_COMPILED,
+                  DEVICE_CONFIG_COMPILED_SIZE(out->entries_cnt),
+                  (uint8_t *)out);
+  return true;
+}
+
+static bool device_config_read_compiled(device_config_compiled_t *out) {
+  uint16_t item_size = 0;
+  if (nvm_cache_get_size(NV_ITEM_DEVICE_CONFIG_COMPILED, &item_size) !=
+          HAL_NVM_SUCCESS ||
+      item_size < DEVICE_CONFIG_COMPILED_SIZE(0) ||
+      item_size > sizeof(device_config_compiled_t)) {
+    return false;
+  }
+  if (nvm_cache_read(NV_ITEM_DEVICE_CONFIG_COMPILED, item_size,
+                     (uint8_t *)out) != HAL_NVM_SUCCESS) {
+    return false;
+  }
+  return out->magic == DEVICE_CONFIG_COMPILED_MAGIC &&
+         out->entries_cnt <= DEVICE_CONFIG_MAX_ENTRIES &&
+         item_size == DEVICE_CONFIG_COMPILED_SIZE(out->entries_cnt) &&
+         out->source_hash ==
+             fnv1a_hash(device_config_str.data, device_config_str.size);
+}
+
+bool device_config_load_compiled(device_config_compiled_t *out) {
+  if (device_config_read_compiled(out)) {
+    printf("Using compiled config\r\n");
+    return true;
+  }
+
+  printf("Compiling config\r\n");
+  return device_config_compiled_write_to_nv(out);
+}
@@ -0,0 +1,79 @@
+#ifndef _CONFIG_COMPILER_H_
+#define _CONFIG_COMPILER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "capacities.h"
+#include "config_nv.h"
+
+typedef enum {
+  DEVICE_CONFIG_ENTRY_RESET_BUTTON = 1, // B<pin><pull>
+  DEVICE_CONFIG_ENTRY_STATUS_LED,       // L<pin>[i]
+  DEVICE_CONFIG_ENTRY_INDICATOR_LED,    // I<pin>[i]
+  DEVICE_CONFIG_ENTRY_SWITCH,           // S<pin><pull>
+  DEVICE_CONFIG_ENTRY_RELAY,            // R<pin>[<off pin>]
+  DEVICE_CONFIG_ENTRY_IMAGE_TYPE,       // i<image type>
+  DEVICE_CONFIG_ENTRY_MOMENTARY,        // M
+  DEVICE_CONFIG_ENTRY_SLP,              // SLP
+} device_config_entry_kind_t;
+
+typedef struct {
+  uint8_t kind;
+  uint8_t arg;      // Pull for buttons and switches, on_high for LEDs
+  uint16_t pin;     // Image type for DEVICE_CONFIG_ENTRY_IMAGE_TYPE
+  uint16_t off_pin; // Latching relays only, HAL_INVALID_PIN otherwise
+} device_config_entry_t;
+
+// Validated, already parsed form of device_config_str. Manufacturer and model
+// are not copied, they are the first two fields of the source string.
+typedef struct {
+  uint8_t magic;
+  uint8_t entries_cnt;
+  uint8_t manufacturer_len;
+  uint8_t model_len;
+  uint32_t source_hash;
+  device_config_entry_t entries[DEVICE_CONFIG_MAX_ENTRIES];
+} device_config_compiled_t;
+
+/**
+ * Parse and validate a config string
+ * @param str Config string, does not need to be NULL terminated
+ * @param size Length of the config string
+ * @param out Receives the compiled descriptor
+ * @return true if the config is valid
+ */
+bool device_config_compile(const uint8_t *str, uint16_t size,
+                           device_config_compiled_t *out);
+
+/**
+ * Like device_config_compile, but entries that don't fit the tables of this
+ * build are left out instead of failing. Only meant for configs stored by a
+ * build with bigger tables, the result must not be stored.
+ * @param str Config string, does not need to be NULL terminated
+ * @param size Length of the config string
+ * @param out Receives the compiled descriptor
+ * @param dropped Receives the number of entries left out
+ * @return true if the config is valid apart from its size
+ */
+bool device_config_compile_fitting(const uint8_t *str, uint16_t size,
+                                   device_config_compiled_t *out,
+                                   uint8_t *dropped);
+
+/**
+ * Load the descriptor for device_config_str. The stored descriptor is used
+ * when it was compiled from the same string, otherwise the string is compiled
+ * and the result is stored for next boot.
+ * @param out Receives the compiled descriptor
+ * @return true if device_config_str is valid
+ */
+bool device_config_load_compiled(device_config_compiled_t *out);
+
+/**
+ * Compile device_config_str and store the descriptor in NV
+ * @param out Receives the compiled descriptor
+ * @return false (and nothing stored) if the config is invalid
+ */
+bool device_config_compiled_write_to_nv(device_config_compiled_t *out);
+
+#endif
@@ -1,6 +1,6 @@
 #include "config_nv.h"
-#include "hal/nvm.h"
 #include "hal/printf_selector.h"
+#include "nvm_cache.h"
 #include "nvm_items.h"
 #include <string.h>
 
@@ -21,13 +21,56 @@ const char default_config_data[] = STRINGIFY(DEFAULT_CONFIG);
 
 device_config_str_t device_config_str;
 
+// Config is stored as a small header followed by only the used bytes of the
+// string. Older firmware stored the whole device_config_str_t, which is still
+// accepted on read (its first byte is the low byte of a size <= 128, so it
+// never matches the magic below).
+#define DEVICE_CONFIG_NV_MAGIC 0xC5
+
+typedef struct {
+  uint8_t magic;
+  uint8_t size;
+  uint16_t crc;
+} device_config_nv_header_t;
+
+typedef struct {
+  device_config_nv_header_t header;
+  uint8_t data[sizeof(device_config_str.data)];
+} device_config_nv_record_t;
+
+static device_config_nv_record_t nv_record;
+
+static uint16_t crc16_ccitt(const uint8_t *data, uint16_t len) {
+  uint16_t crc = 0xFFFF;
+  for (uint16_t i = 0; i < len; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
 void device_config_write_to_nv() {
   printf("Writing config to nv: %s\r\n", device_config_str.data);
   hal_nvm_status_t st = 0;
 
-  printf("Size: %d\r\n", sizeof(device_config_str));
-  st = hal_nvm_write(NV_ITEM_DEVICE_CONFIG, sizeof(device_config_str),
-                     (uint8_t *)&device_config_str);
+  if (device_config_str.size >= sizeof(device_config_str.data)) {
+    printf("Config too long: %d bytes\r\n", device_config_str.size);
+    return;
+  }
+
+  nv_record.header.magic = DEVICE_CONFIG_NV_MAGIC;
+  nv_record.header.size = (uint8_t)device_config_str.size;
+  nv_record.header.crc =
+      crc16_ccitt(device_config_str.data, device_config_str.size);
+  memcpy(nv_record.data, device_config_str.data, device_config_str.size);
+
+  uint16_t record_size =
+      sizeof(device_config_nv_header_t) + device_config_str.size;
+  printf("Size: %d\r\n", record_size);
+  st = nvm_cache_write(NV_ITEM_DEVICE_CONFIG, record_size,
+                       (uint8_t *)&nv_record);
 
   if (st != HAL_NVM_SUCCESS) {
     printf(
@@ -38,19 +81,57 @@ void device_config_write_to_nv() {
   }
 }
 
+static hal_nvm_status_t device_config_read_record(uint16_t item_size) {
+  hal_nvm_status_t st = nvm_cache_read(NV_ITEM_DEVICE_CONFIG, item_size,
+                                       (uint8_t *)&nv_record);
+  if (st != HAL_NVM_SUCCESS) {
+    return st;
+  }
+
+  if (nv_record.header.magic == DEVICE_CONFIG_NV_MAGIC) {
+    uint8_t size = nv_record.header.size;
+    if (size != item_size - sizeof(device_config_nv_header_t) ||
+        crc16_ccitt(nv_record.data, size) != nv_record.header.crc) {
+      printf("Stored config is corrupted\r\n");
+      return HAL_NVM_ERROR;
+    }
+    memcpy(device_config_str.data, nv_record.data, size);
+    device_config_str.size = size;
+  } else if (item_size == sizeof(device_config_str_t)) {
+    // Legacy fixed-size record, rewritten in new format on next config change
+    memcpy(&device_config_str, &nv_record, sizeof(device_config_str_t));
+    if (device_config_str.size >= sizeof(device_config_str.data)) {
+      return HAL_NVM_ERROR;
+    }
+  } else {
+    return HAL_NVM_ERROR;
+  }
+
+  device_config_str.data[device_config_str.size] = '\0';
+  return HAL_NVM_SUCCESS;
+}
+
+void device_config_load_default() {
+  memcpy(device_config_str.data, default_config_data,
+         sizeof(default_config_data));
+  device_config_str.size = strlen((const char *)default_config_data);
+}
+
 void device_config_read_from_nv() {
-  hal_nvm_status_t st = 0;
+  uint16_t item_size = 0;
+  hal_nvm_status_t st = nvm_cache_get_size(NV_ITEM_DEVICE_CONFIG, &item_size);
 
-  st = hal_nvm_read(NV_ITEM_DEVICE_CONFIG, sizeof(device_config_str),
-                    (uint8_t *)&device_config_str);
+  if (st == HAL_NVM_SUCCESS) {
+    st = item_size <= sizeof(device_config_nv_record_t)
+             ? device_config_read_record(item_size)
+             : HAL_NVM_ERROR;
+  }
 
   if (st != HAL_NVM_SUCCESS) {
     printf("Failed to read NV_ITEM_DEVICE_CONFIG, using default config "
            "instead, status: %d. (bytes: %d)\r\n",
-           st, device_config_str.size);
-    memcpy(device_config_str.data, default_config_data,
-           sizeof(default_config_data));
-    device_config_str.size = strlen((const char *)default_config_data);
+           st, item_size);
+    device_config_load_default();
   }
 
   printf("Using config: %d chars from\r\n%s\r\n", device_config_str.size,
@@ -15,6 +15,7 @@ extern device_config_str_t device_config_str;
 void device_config_write_to_nv();
 void device_config_remove_from_nv();
 void device_config_read_from_nv();
+void device_config_load_default();
 
 void handle_version_changes();
 
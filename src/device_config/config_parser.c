@@ -3,7 +3,12 @@
 #include "hal/zigbee.h"
 #include "zigbee/basic_cluster.h"
 #include "zigbee/consts.h"
+#include "zigbee/diagnostics_cluster.h"
+#include "zigbee/fast_rejoin.h"
 #include "zigbee/group_cluster.h"
+#include "zigbee/network_steering.h"
+#include "zigbee/poll_control.h"
+#include "zigbee/startup_traffic.h"
 #include "zigbee/relay_cluster.h"
 #include "zigbee/switch_cluster.h"
 
@@ -12,8 +17,10 @@
 
 #include "base_components/led.h"
 #include "base_components/network_indicator.h"
+#include "config_compiler.h"
 #include "config_nv.h"
-#include "device_config/reset.h"
+#include "nvm_cache.h"
+#include "nvm_items.h"
 #include "hal/system.h"
 #include "hal/zigbee.h"
 #include "hal/zigbee_ota.h"
@@ -29,13 +36,13 @@ network_indicator_t network_indicator = {
     .manual_state_when_connected = 1,
 };
 
-led_t leds[5];
+led_t leds[DEVICE_CONFIG_MAX_LEDS];
 uint8_t leds_cnt = 0;
 
-button_t buttons[5];
+button_t buttons[DEVICE_CONFIG_MAX_BUTTONS];
 uint8_t buttons_cnt = 0;
 
-relay_t relays[5];
+relay_t relays[DEVICE_CONFIG_MAX_RELAYS];
 uint8_t relays_cnt = 0;
 
 zigbee_basic_cluster basic_cluster = {
@@ -44,105 +51,133 @@ zigbee_basic_cluster basic_cluster = {
 
 zigbee_group_cluster group_cluster = {};
 
-zigbee_switch_cluster switch_clusters[4];
+zigbee_diagnostics_cluster diagnostics_cluster;
+
+zigbee_switch_cluster switch_clusters[DEVICE_CONFIG_MAX_SWITCHES];
 uint8_t switch_clusters_cnt = 0;
 
-zigbee_relay_cluster relay_clusters[4];
+zigbee_relay_cluster relay_clusters[DEVICE_CONFIG_MAX_RELAYS];
 uint8_t relay_clusters_cnt = 0;
 
-hal_zigbee_cluster clusters[32];
-hal_zigbee_endpoint endpoints[10];
+hal_zigbee_cluster clusters[DEVICE_CONFIG_MAX_CLUSTERS];
+hal_zigbee_endpoint endpoints[DEVICE_CONFIG_MAX_ENDPOINTS];
 
 uint8_t allow_simultaneous_latching_pulses = 0;
 
-uint32_t parse_int(const char *s);
-char *seek_until(char *cursor, char needle);
-char *extract_next_entry(char **cursor);
-
 void on_reset_clicked(void *_) { hal_factory_reset(); }
 
-void parse_config() {
-  device_config_read_from_nv();
-  char *cursor = device_config_str.data;
-
-  const char *zb_manufacturer = extract_next_entry(&cursor);
+static device_config_compiled_t compiled_config;
 
-  basic_cluster.manuName[0] = strlen(zb_manufacturer);
-  if (basic_cluster.manuName[0] > 31) {
-    printf("Manufacturer too big\r\n");
-    reset_all();
-  }
+static void config_apply_names(const device_config_compiled_t *config) {
+  const uint8_t *zb_manufacturer = device_config_str.data;
+  basic_cluster.manuName[0] = config->manufacturer_len;
   memcpy(basic_cluster.manuName + 1, zb_manufacturer,
          basic_cluster.manuName[0]);
 
-  const char *zb_model = extract_next_entry(&cursor);
-  basic_cluster.modelId[0] = strlen(zb_model);
-  if (basic_cluster.modelId[0] > 31) {
-    printf("Model too big\r\n");
-    reset_all();
-  }
+  const uint8_t *zb_model = zb_manufacturer + config->manufacturer_len + 1;
+  basic_cluster.modelId[0] = config->model_len;
   memcpy(basic_cluster.modelId + 1, zb_model, basic_cluster.modelId[0]);
+}
 
-  bool has_dedicated_status_led = false;
-  char *entry;
-  for (entry = extract_next_entry(&cursor); *entry != '\0';
-       entry = extract_next_entry(&cursor)) {
-    if (entry[0] == 'S' && entry[1] == 'L' && entry[2] == 'P') {
-      // Simultaneous Latching Pulses == SLP
-      allow_simultaneous_latching_pulses = 1;
-    } else if (entry[0] == 'B') {
-      hal_gpio_pin_t pin = hal_gpio_parse_pin(entry + 1);
-      hal_gpio_pull_t pull = hal_gpio_parse_pull(entry + 3);
-      hal_gpio_init(pin, 1, pull);
+// The compiler already rejects configs that don't fit, this only guards the
+// tables against descriptors from elsewhere
+static bool config_has_room(const device_config_entry_t *entry) {
+  switch (entry->kind) {
+  case DEVICE_CONFIG_ENTRY_RESET_BUTTON:
+    return buttons_cnt < DEVICE_CONFIG_MAX_BUTTONS;
+  case DEVICE_CONFIG_ENTRY_SWITCH:
+    return buttons_cnt < DEVICE_CONFIG_MAX_BUTTONS &&
+           switch_clusters_cnt < DEVICE_CONFIG_MAX_SWITCHES;
+  case DEVICE_CONFIG_ENTRY_STATUS_LED:
+  case DEVICE_CONFIG_ENTRY_INDICATOR_LED:
+    return leds_cnt < DEVICE_CONFIG_MAX_LEDS;
+  case DEVICE_CONFIG_ENTRY_RELAY:
+    return relays_cnt < DEVICE_CONFIG_MAX_RELAYS &&
+           relay_clusters_cnt < DEVICE_CONFIG_MAX_RELAYS;
+  default:
+    return true;
+  }
+}
 
-      buttons[buttons_cnt].pin = pin;
-      buttons[buttons_cnt].long_press_duration_ms = 2000;
-      buttons[buttons_cnt].multi_press_duration_ms = 800;
-      buttons[buttons_cnt].on_long_press = on_reset_clicked;
-      buttons_cnt++;
-    } else if (entry[0] == 'L') {
-      hal_gpio_pin_t pin = hal_gpio_parse_pin(entry + 1);
-      hal_gpio_init(pin, 0, HAL_GPIO_PULL_NONE);
-      leds[leds_cnt].pin = pin;
-      leds[leds_cnt].on_high = entry[3] != 'i';
-
-      led_init(&leds[leds_cnt]);
-
-      network_indicator.leds[0] = &leds[leds_cnt];
-      network_indicator.leds[1] = NULL;
-      network_indicator.has_dedicated_led = true;
-
-      has_dedicated_status_led = true;
-      leds_cnt++;
-    } else if (entry[0] == 'I') {
-      hal_gpio_pin_t pin = hal_gpio_parse_pin(entry + 1);
-      hal_gpio_init(pin, 0, HAL_GPIO_PULL_NONE);
-      leds[leds_cnt].pin = pin;
-      leds[leds_cnt].on_high = entry[3] != 'i';
-      led_init(&leds[leds_cnt]);
+static void config_add_led(const device_config_entry_t *entry,
+                           bool *has_dedicated_status_led) {
+  hal_gpio_init(entry->pin, 0, HAL_GPIO_PULL_NONE);
+  leds[leds_cnt].pin = entry->pin;
+  leds[leds_cnt].on_high = entry->arg;
+  led_init(&leds[leds_cnt]);
+
+  if (entry->kind == DEVICE_CONFIG_ENTRY_STATUS_LED) {
+    network_indicator.leds[0] = &leds[leds_cnt];
+    network_indicator.leds[1] = NULL;
+    network_indicator.has_dedicated_led = true;
 
+    *has_dedicated_status_led = true;
+  } else {
+    for (int index = 0; index < DEVICE_CONFIG_MAX_RELAYS; index++) {
+      if (relay_clusters[index].indicator_led == NULL) {
+        relay_clusters[index].indicator_led = &leds[leds_cnt];
+        break;
+      }
+    }
+
+    if (!*has_dedicated_status_led) {
       for (int index = 0; index < 4; index++) {
-        if (relay_clusters[index].indicator_led == NULL) {
-          relay_clusters[index].indicator_led = &leds[leds_cnt];
+        if (network_indicator.leds[index] == NULL) {
+          network_indicator.leds[index] = &leds[leds_cnt];
           break;
         }
       }
+    }
+  }
+  leds_cnt++;
+}
 
-      if (!has_dedicated_status_led) {
-        for (int index = 0; index < 4; index++) {
-          if (network_indicator.leds[index] == NULL) {
-            network_indicator.leds[index] = &leds[leds_cnt];
-            break;
-          }
-        }
-      }
-      leds_cnt++;
-    } else if (entry[0] == 'S') {
-      hal_gpio_pin_t pin = hal_gpio_parse_pin(entry + 1);
-      hal_gpio_pull_t pull = hal_gpio_parse_pull(entry + 3);
-      hal_gpio_init(pin, 1, pull);
+void parse_config() {
+  device_config_read_from_nv();
+  if (!device_config_load_compiled(&compiled_config)) {
+    uint8_t dropped = 0;
+    if (device_config_compile_fitting(device_config_str.data,
+                                      device_config_str.size, &compiled_config,
+                                      &dropped) &&
+        dropped > 0) {
+      // Stored by a build with bigger tables. The string stays in NV as is,
+      // so a build it fits runs all of it again.
+      printf("Config too big for this build, %d entries left out\r\n",
+             dropped);
+    } else {
+      printf("Invalid config, using default config instead\r\n");
+      device_config_load_default();
+      device_config_compile(device_config_str.data, device_config_str.size,
+                            &compiled_config);
+    }
+  }
+
+  config_apply_names(&compiled_config);
+
+  bool has_dedicated_status_led = false;
+  for (int i = 0; i < compiled_config.entries_cnt; i++) {
+    const device_config_entry_t *entry = &compiled_config.entries[i];
+    if (!config_has_room(entry)) {
+      printf("No room for config entry %d\r\n", i);
+      continue;
+    }
+    if (entry->kind == DEVICE_CONFIG_ENTRY_SLP) {
+      allow_simultaneous_latching_pulses = 1;
+    } else if (entry->kind == DEVICE_CONFIG_ENTRY_RESET_BUTTON) {
+      hal_gpio_init(entry->pin, 1, entry->arg);
 
-      buttons[buttons_cnt].pin = pin;
+      buttons[buttons_cnt].pin = entry->pin;
+      buttons[buttons_cnt].long_press_duration_ms = 2000;
+      buttons[buttons_cnt].multi_press_duration_ms = 800;
+      buttons[buttons_cnt].on_long_press = on_reset_clicked;
+      buttons_cnt++;
+    } else if (entry->kind == DEVICE_CONFIG_ENTRY_STATUS_LED ||
+               entry->kind == DEVICE_CONFIG_ENTRY_INDICATOR_LED) {
+      config_add_led(entry, &has_dedicated_status_led);
+    } else if (entry->kind == DEVICE_CONFIG_ENTRY_SWITCH) {
+      hal_gpio_init(entry->pin, 1, entry->arg);
+
+      buttons[buttons_cnt].pin = entry->pin;
       buttons[buttons_cnt].long_press_duration_ms = 800;
       buttons[buttons_cnt].multi_press_duration_ms = 800;
 
@@ -161,17 +196,15 @@ void parse_config() {
       switch_clusters[switch_clusters_cnt].level_move_rate = 50;
       buttons_cnt++;
       switch_clusters_cnt++;
-    } else if (entry[0] == 'R') {
-      hal_gpio_pin_t pin = hal_gpio_parse_pin(entry + 1);
-      hal_gpio_init(pin, 0, HAL_GPIO_PULL_NONE);
+    } else if (entry->kind == DEVICE_CONFIG_ENTRY_RELAY) {
+      hal_gpio_init(entry->pin, 0, HAL_GPIO_PULL_NONE);
 
-      relays[relays_cnt].pin = pin;
+      relays[relays_cnt].pin = entry->pin;
       relays[relays_cnt].on_high = 1;
 
-      if (entry[3] != '\0') {
-        pin = hal_gpio_parse_pin(entry + 3);
-        hal_gpio_init(pin, 0, HAL_GPIO_PULL_NONE);
-        relays[relays_cnt].off_pin = pin;
+      if (entry->off_pin != HAL_INVALID_PIN) {
+        hal_gpio_init(entry->off_pin, 0, HAL_GPIO_PULL_NONE);
+        relays[relays_cnt].off_pin = entry->off_pin;
         relays[relays_cnt].is_latching = 1;
       }
 
@@ -180,10 +213,9 @@ void parse_config() {
 
       relays_cnt++;
       relay_clusters_cnt++;
-    } else if (entry[0] == 'i') {
-      uint32_t image_type = parse_int(entry + 1);
-      hal_zigbee_set_image_type(image_type);
-    } else if (entry[0] == 'M') {
+    } else if (entry->kind == DEVICE_CONFIG_ENTRY_IMAGE_TYPE) {
+      hal_zigbee_set_image_type(entry->pin);
+    } else if (entry->kind == DEVICE_CONFIG_ENTRY_MOMENTARY) {
       for (int index = 0; index < switch_clusters_cnt; index++) {
         switch_clusters[index].mode =
             ZCL_ONOFF_CONFIGURATION_SWITCH_TYPE_MOMENTARY;
@@ -215,6 +247,8 @@ void parse_config() {
 
   endpoints[0].clusters = cluster_ptr;
   basic_cluster_add_to_endpoint(&basic_cluster, &endpoints[0]);
+  diagnostics_cluster_add_to_endpoint(&diagnostics_cluster, &endpoints[0],
+                                      switch_clusters, switch_clusters_cnt);
 
   hal_ota_cluster_setup(&endpoints[0].clusters[endpoints[0].cluster_count]);
   endpoints[0].cluster_count++;
@@ -237,20 +271,190 @@ void parse_config() {
   }
 
   hal_zigbee_init(endpoints, total_endpoints);
-  while (cursor != (char *)device_config_str.data) {
-    cursor--;
-    if (*cursor == '\0') {
-      *cursor = ';';
+
+  printf("Config parsed successfully\r\n");
+}
+
+// Layout is everything that shapes endpoints, clusters and attributes, or
+// registers GPIO callbacks: buttons, switches, relays, presence of a status
+// LED (Basic cluster attribute) and of relay indicators (On/Off attributes).
+typedef struct {
+  uint8_t idx;
+  uint8_t status_leds_cnt;
+  uint8_t indicators_cnt;
+} config_layout_cursor_t;
+
+static const device_config_entry_t *
+config_next_layout_entry(const device_config_compiled_t *config,
+                         config_layout_cursor_t *cursor) {
+  while (cursor->idx < config->entries_cnt) {
+    const device_config_entry_t *entry = &config->entries[cursor->idx++];
+    if (entry->kind == DEVICE_CONFIG_ENTRY_RESET_BUTTON ||
+        entry->kind == DEVICE_CONFIG_ENTRY_SWITCH ||
+        entry->kind == DEVICE_CONFIG_ENTRY_RELAY) {
+      return entry;
     }
+    cursor->status_leds_cnt += entry->kind == DEVICE_CONFIG_ENTRY_STATUS_LED;
+    cursor->indicators_cnt += entry->kind == DEVICE_CONFIG_ENTRY_INDICATOR_LED;
   }
+  return NULL;
+}
 
-  printf("Config parsed successfully\r\n");
+static bool config_same_layout(const device_config_compiled_t *a,
+                               const device_config_compiled_t *b) {
+  config_layout_cursor_t ca = {0}, cb = {0};
+  const device_config_entry_t *ea, *eb;
+  uint8_t relays_cnt = 0;
+
+  do {
+    ea = config_next_layout_entry(a, &ca);
+    eb = config_next_layout_entry(b, &cb);
+    if (ea == NULL || eb == NULL) {
+      break;
+    }
+    if (ea->kind != eb->kind || ea->pin != eb->pin ||
+        ea->off_pin != eb->off_pin) {
+      return false;
+    }
+    relays_cnt += ea->kind == DEVICE_CONFIG_ENTRY_RELAY;
+  } while (true);
+
+  if (ea != eb) {
+    return false;
+  }
+  // Indicators are handed out to relays in order, extra ones only serve as
+  // network indicators
+  if (ca.indicators_cnt > relays_cnt) {
+    ca.indicators_cnt = relays_cnt;
+  }
+  if (cb.indicators_cnt > relays_cnt) {
+    cb.indicators_cnt = relays_cnt;
+  }
+  return (ca.status_leds_cnt != 0) == (cb.status_leds_cnt != 0) &&
+         ca.indicators_cnt == cb.indicators_cnt;
+}
+
+bool device_config_apply_in_place(const device_config_compiled_t *config) {
+  if (!config_same_layout(&compiled_config, config)) {
+    return false;
+  }
+  printf("Applying config in place\r\n");
+  compiled_config = *config;
+
+  // LEDs are rebuilt from scratch, release the old pins first
+  for (int index = 0; index < leds_cnt; index++) {
+    if (leds[index].blink_times_left != 0) {
+      hal_tasks_unschedule(&leds[index].blink_task);
+    }
+    led_off(&leds[index]);
+  }
+  leds_cnt = 0;
+  for (int index = 0; index < 4; index++) {
+    network_indicator.leds[index] = NULL;
+  }
+  network_indicator.has_dedicated_led = false;
+  for (int index = 0; index < DEVICE_CONFIG_MAX_RELAYS; index++) {
+    relay_clusters[index].indicator_led = NULL;
+  }
+  allow_simultaneous_latching_pulses = 0;
+
+  config_apply_names(config);
+
+  bool has_dedicated_status_led = false;
+  uint8_t button_idx = 0;
+  uint8_t switch_idx = 0;
+  uint8_t default_modes[DEVICE_CONFIG_MAX_SWITCHES];
+  for (int i = 0; i < config->entries_cnt; i++) {
+    const device_config_entry_t *entry = &config->entries[i];
+    if (entry->kind == DEVICE_CONFIG_ENTRY_SLP) {
+      allow_simultaneous_latching_pulses = 1;
+    } else if (entry->kind == DEVICE_CONFIG_ENTRY_RESET_BUTTON ||
+               entry->kind == DEVICE_CONFIG_ENTRY_SWITCH) {
+      // Same pins as before, only the pull may differ
+      hal_gpio_init(buttons[button_idx++].pin, 1, entry->arg);
+      if (entry->kind == DEVICE_CONFIG_ENTRY_SWITCH) {
+        default_modes[switch_idx++] =
+            ZCL_ONOFF_CONFIGURATION_SWITCH_TYPE_TOGGLE;
+      }
+    } else if ((entry->kind == DEVICE_CONFIG_ENTRY_STATUS_LED ||
+                entry->kind == DEVICE_CONFIG_ENTRY_INDICATOR_LED) &&
+               config_has_room(entry)) {
+      config_add_led(entry, &has_dedicated_status_led);
+    } else if (entry->kind == DEVICE_CONFIG_ENTRY_IMAGE_TYPE) {
+      hal_zigbee_set_image_type(entry->pin);
+    } else if (entry->kind == DEVICE_CONFIG_ENTRY_MOMENTARY) {
+      for (int index = 0; index < switch_idx; index++) {
+        default_modes[index] = ZCL_ONOFF_CONFIGURATION_SWITCH_TYPE_MOMENTARY;
+      }
+    }
+  }
+
+  // Like at boot, the mode from config is only a default for switches that
+  // have no settings stored yet
+  for (int index = 0; index < switch_clusters_cnt; index++) {
+    uint16_t size;
+    if (nvm_cache_get_size(NV_ITEM_SWITCH_CLUSTER_DATA(index), &size) ==
+        HAL_NVM_NOT_FOUND) {
+      switch_clusters[index].mode = default_modes[index];
+    }
+  }
+
+  update_relay_clusters();
+  if (hal_zigbee_get_network_status() == HAL_ZIGBEE_NETWORK_JOINED) {
+    network_indicator_connected(&network_indicator);
+  } else {
+    network_indicator_not_connected(&network_indicator);
+  }
+  return true;
+}
+
+#ifdef HAL_STUB
+extern zigbee_switch_cluster
+    *switch_cluster_by_endpoint[DEVICE_CONFIG_MAX_ENDPOINTS + 1];
+extern zigbee_relay_cluster
+    *relay_cluster_by_endpoint[DEVICE_CONFIG_MAX_ENDPOINTS + 1];
+
+void device_config_reset_state(void) {
+  memset(leds, 0, sizeof(leds));
+  leds_cnt = 0;
+  memset(buttons, 0, sizeof(buttons));
+  buttons_cnt = 0;
+  memset(relays, 0, sizeof(relays));
+  relays_cnt = 0;
+  relay_reset_pulse_owner();
+
+  memset(switch_clusters, 0, sizeof(switch_clusters));
+  switch_clusters_cnt = 0;
+  memset(relay_clusters, 0, sizeof(relay_clusters));
+  relay_clusters_cnt = 0;
+  memset(switch_cluster_by_endpoint, 0, sizeof(switch_cluster_by_endpoint));
+  memset(relay_cluster_by_endpoint, 0, sizeof(relay_cluster_by_endpoint));
+  memset(clusters, 0, sizeof(clusters));
+  memset(endpoints, 0, sizeof(endpoints));
+
+  network_indicator = (network_indicator_t){
+      .leds = {NULL, NULL, NULL, NULL},
+      .has_dedicated_led = 0,
+      .manual_state_when_connected = 1,
+  };
+  basic_cluster = (zigbee_basic_cluster){
+      .deviceEnable = 1,
+  };
+  group_cluster = (zigbee_group_cluster){};
+  memset(&diagnostics_cluster, 0, sizeof(diagnostics_cluster));
+  allow_simultaneous_latching_pulses = 0;
+  memset(&compiled_config, 0, sizeof(compiled_config));
 }
+#endif
 
 void network_indicator_on_network_status_change(
     hal_zigbee_network_status_t new_status) {
   printf("Network status changed to %d\r\n", new_status);
+  fast_rejoin_on_network_status_change(new_status);
+  network_steering_on_network_status_change(new_status);
+  startup_traffic_on_network_status_change(new_status);
   if (new_status == HAL_ZIGBEE_NETWORK_JOINED) {
+    poll_control_on_activity(); // Interview and configuration follow a join
     network_indicator_connected(&network_indicator);
     update_relay_clusters();
   } else {
@@ -276,33 +480,3 @@ void periferals_init() {
   hal_register_on_network_status_change_callback(
       network_indicator_on_network_status_change);
 }
-
-// Helper functions
-
-char *seek_until(char *cursor, char needle) {
-  while (*cursor != needle && *cursor != '\0') {
-    cursor++;
-  }
-  return (cursor);
-}
-
-char *extract_next_entry(char **cursor) {
-  char *end = seek_until(*cursor, ';');
-
-  *end = '\0';
-  char *res = *cursor;
-  *cursor = end + 1;
-  return (res);
-}
-
-uint32_t parse_int(const char *s) {
-  if (!s)
-    return 0;
-
-  uint32_t n = 0;
-  while (*s >= '0' && *s <= '9') {
-    n = n * 10 + (uint32_t)(*s - '0');
-    s++;
-  }
-  return n;
-}
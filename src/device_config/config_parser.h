@@ -4,16 +4,29 @@
 #include "base_components/network_indicator.h"
 #include "hal/zigbee.h"
 
+#include "config_compiler.h"
 #include "config_nv.h"
 
 extern network_indicator_t network_indicator;
 
-extern hal_zigbee_endpoint endpoints[10];
+extern hal_zigbee_endpoint endpoints[DEVICE_CONFIG_MAX_ENDPOINTS];
 
 extern uint8_t allow_simultaneous_latching_pulses;
 
 void parse_config();
+
+/**
+ * Re-apply a changed config without rebooting
+ * @param config Compiled new config
+ * @return false if the endpoint layout differs and a reboot is needed
+ */
+bool device_config_apply_in_place(const device_config_compiled_t *config);
 void init_reporting();
+
+#ifdef HAL_STUB
+// Host simulator only, see app_reset_state()
+void device_config_reset_state(void);
+#endif
 void handle_version_changes();
 
 #endif
@@ -0,0 +1,144 @@
+#include "nvm_cache.h"
+#include "base_components/diagnostics.h"
+#include "capacities.h"
+#include "hal/printf_selector.h"
+#include "nvm_items.h"
+#include <stdbool.h>
+#include <string.h>
+
+// version, config, basic, switches, relays, device type, compiled config,
+// poll control, network restore
+#define NVM_CACHE_ITEMS                                                        \
+  (3 + DEVICE_CONFIG_MAX_SWITCHES + DEVICE_CONFIG_MAX_RELAYS + 4)
+#define NVM_CACHE_POOL_SIZE 384
+
+typedef struct {
+  uint8_t item_id;
+  uint8_t cached;
+  hal_nvm_status_t status;
+  uint16_t size;
+  uint16_t offset;
+} nvm_cache_entry_t;
+
+static nvm_cache_entry_t entries[NVM_CACHE_ITEMS];
+static uint8_t entries_cnt = 0;
+static uint8_t pool[NVM_CACHE_POOL_SIZE];
+static uint16_t pool_used = 0;
+static bool active = false;
+
+static nvm_cache_entry_t *nvm_cache_find(uint8_t item_id) {
+  if (!active) {
+    return NULL;
+  }
+  for (uint8_t i = 0; i < entries_cnt; i++) {
+    if (entries[i].item_id == item_id && entries[i].cached) {
+      return &entries[i];
+    }
+  }
+  return NULL;
+}
+
+static nvm_cache_entry_t *nvm_cache_add(uint8_t item_id, uint16_t size) {
+  if (entries_cnt == NVM_CACHE_ITEMS ||
+      size > NVM_CACHE_POOL_SIZE - pool_used) {
+    printf("NVM cache full, item %d (%d bytes) is not cached\r\n", item_id,
+           size);
+    return NULL;
+  }
+  nvm_cache_entry_t *entry = &entries[entries_cnt++];
+  entry->item_id = item_id;
+  entry->cached = 1;
+  entry->size = size;
+  entry->offset = pool_used;
+  pool_used += size;
+  return entry;
+}
+
+// Only a missing item is known to be missing at any size, read errors depend
+// on the size asked for
+static void nvm_cache_add_missing(uint8_t item_id, hal_nvm_status_t st) {
+  if (st != HAL_NVM_NOT_FOUND) {
+    return;
+  }
+  nvm_cache_entry_t *entry = nvm_cache_add(item_id, 0);
+  if (entry != NULL) {
+    entry->status = st;
+  }
+}
+
+void nvm_cache_start(void) {
+  entries_cnt = 0;
+  pool_used = 0;
+  active = true;
+}
+
+void nvm_cache_release(void) {
+  if (active) {
+    printf("NVM cache: %d items, %d bytes\r\n", entries_cnt, pool_used);
+  }
+  active = false;
+}
+
+hal_nvm_status_t nvm_cache_read(uint8_t item_id, uint16_t size,
+                                uint8_t *data) {
+  if (data == NULL) {
+    return HAL_NVM_ERROR;
+  }
+  nvm_cache_entry_t *entry = nvm_cache_find(item_id);
+  if (entry == NULL) {
+    hal_nvm_status_t st = hal_nvm_read(item_id, size, data);
+    if (!active) {
+      return st;
+    }
+    if (st != HAL_NVM_SUCCESS) {
+      nvm_cache_add_missing(item_id, st);
+      return st;
+    }
+    entry = nvm_cache_add(item_id, size);
+    if (entry != NULL) {
+      entry->status = st;
+      memcpy(pool + entry->offset, data, size);
+    }
+    return st;
+  }
+  if (entry->status != HAL_NVM_SUCCESS) {
+    return entry->status;
+  }
+  if (size > entry->size) {
+    // Only a prefix is cached
+    return hal_nvm_read(item_id, size, data);
+  }
+  memcpy(data, pool + entry->offset, size);
+  return HAL_NVM_SUCCESS;
+}
+
+hal_nvm_status_t nvm_cache_get_size(uint8_t item_id, uint16_t *size) {
+  nvm_cache_entry_t *entry = nvm_cache_find(item_id);
+  if (entry == NULL || entry->status == HAL_NVM_SUCCESS) {
+    // A cached read does not tell the stored size
+    hal_nvm_status_t st = hal_nvm_get_size(item_id, size);
+    if (active && entry == NULL) {
+      nvm_cache_add_missing(item_id, st);
+    }
+    return st;
+  }
+  return entry->status;
+}
+
+hal_nvm_status_t nvm_cache_write(uint8_t item_id, uint16_t size,
+                                 uint8_t *data) {
+  diagnostics.nvm_writes++;
+  hal_nvm_status_t st = hal_nvm_write(item_id, size, data);
+
+  nvm_cache_entry_t *entry = nvm_cache_find(item_id);
+  if (entry != NULL) {
+    if (st == HAL_NVM_SUCCESS && entry->status == HAL_NVM_SUCCESS &&
+        entry->size == size) {
+      memcpy(pool + entry->offset, data, size);
+    } else {
+      // Slot can't hold the new value, fall back to reading from NVM
+      entry->cached = 0;
+    }
+  }
+  return st;
+}
@@ -0,0 +1,24 @@
+#ifndef DEVICE_CONFIG_NVM_CACHE_H_
+#define DEVICE_CONFIG_NVM_CACHE_H_
+
+#include "hal/nvm.h"
+#include <stdint.h>
+
+/**
+ * Start caching reads. Until nvm_cache_release() is called, each item is
+ * read from NVM once, at the size its first reader asks for, and later reads
+ * are served from RAM. Missing items are remembered as well. Only the items
+ * the device actually reads during startup take space.
+ */
+void nvm_cache_start(void);
+
+/** Drop the startup cache, all further accesses go directly to NVM */
+void nvm_cache_release(void);
+
+// Same semantics as hal_nvm_* counterparts. Writes always go to NVM.
+hal_nvm_status_t nvm_cache_read(uint8_t item_id, uint16_t size, uint8_t *data);
+hal_nvm_status_t nvm_cache_get_size(uint8_t item_id, uint16_t *size);
+hal_nvm_status_t nvm_cache_write(uint8_t item_id, uint16_t size,
+                                 uint8_t *data);
+
+#endif /* DEVICE_CONFIG_NVM_CACHE_H_ */
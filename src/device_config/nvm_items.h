@@ -1,21 +1,34 @@
 #ifndef DEVICE_CONFIG_NVM_ITEMS_H_
 #define DEVICE_CONFIG_NVM_ITEMS_H_
 
-#define MAX_RELAYS 5
-#define MAX_SWITCHES 5
-
 #define NV_ITEM_CURRENT_VERSION_IN_NV 1
 #define NV_ITEM_DEVICE_CONFIG 2
 #define NV_ITEM_BASIC_CLUSTER_DATA 3
+
+// The first 5 switches and relays keep the item ids of the original layout
+// (4..8 and 9..13), so stored settings don't depend on build capacities.
+// Boards with more gangs continue in the free range 14..29.
+#define NV_ITEM_LEGACY_SLOTS 5
+#define NV_ITEM_EXTRA_SWITCH_CLUSTER_DATA 14
+#define NV_ITEM_EXTRA_RELAY_CLUSTER_DATA 22
+
 // switch_idx and relay_idx below are zero indexes, e.g. first switch has
 // switch_idx = 0
 #define NV_ITEM_SWITCH_CLUSTER_DATA(switch_idx)                                \
-  (NV_ITEM_BASIC_CLUSTER_DATA + 1 + switch_idx)
+  ((switch_idx) < NV_ITEM_LEGACY_SLOTS                                         \
+       ? NV_ITEM_BASIC_CLUSTER_DATA + 1 + (switch_idx)                         \
+       : NV_ITEM_EXTRA_SWITCH_CLUSTER_DATA + (switch_idx) -                    \
+             NV_ITEM_LEGACY_SLOTS)
 #define NV_ITEM_RELAY_CLUSTER_DATA(relay_idx)                                  \
-  (NV_ITEM_BASIC_CLUSTER_DATA + MAX_SWITCHES + 1 + relay_idx)
+  ((relay_idx) < NV_ITEM_LEGACY_SLOTS                                          \
+       ? NV_ITEM_BASIC_CLUSTER_DATA + NV_ITEM_LEGACY_SLOTS + 1 + (relay_idx)   \
+       : NV_ITEM_EXTRA_RELAY_CLUSTER_DATA + (relay_idx) -                      \
+             NV_ITEM_LEGACY_SLOTS)
 
-// 3 + 5 (relays) + 5 (switches) = 13
-// Adding room for future items, so starting from 32
 #define NV_ITEM_DEVICE_TYPE 32
+#define NV_ITEM_DEVICE_CONFIG_COMPILED 33
+#define NV_ITEM_POLL_CONTROL_DATA 34
+#define NV_ITEM_NETWORK_RESTORE_DATA 35
+#define NV_ITEM_OTA_RESUME_DATA 36
 
 #endif /* DEVICE_CONFIG_NVM_ITEMS_H_ */
@@ -1,5 +1,5 @@
-#include "hal/nvm.h"
 #include "hal/printf_selector.h"
+#include "nvm_cache.h"
 #include "nvm_items.h"
 
 #ifdef HAL_SILABS
@@ -11,8 +11,8 @@
 uint16_t read_version_in_nv() {
   uint16_t version;
 
-  hal_nvm_status_t res = hal_nvm_read(NV_ITEM_CURRENT_VERSION_IN_NV,
-                                      sizeof(version), (uint8_t *)&version);
+  hal_nvm_status_t res = nvm_cache_read(NV_ITEM_CURRENT_VERSION_IN_NV,
+                                        sizeof(version), (uint8_t *)&version);
   if (res == HAL_NVM_SUCCESS) {
     printf("read version form new location\r\n");
     return version;
@@ -23,8 +23,8 @@ uint16_t read_version_in_nv() {
 
 void write_version_to_nv(uint16_t version) {
 
-  hal_nvm_status_t res = hal_nvm_write(NV_ITEM_CURRENT_VERSION_IN_NV,
-                                       sizeof(version), (uint8_t *)&version);
+  hal_nvm_status_t res = nvm_cache_write(NV_ITEM_CURRENT_VERSION_IN_NV,
+                                         sizeof(version), (uint8_t *)&version);
   if (res != HAL_NVM_SUCCESS) {
     printf("Failed to write lastSeenVersion to NV, st: %d\r\n", res);
   }
@@ -28,6 +28,14 @@ hal_nvm_status_t hal_nvm_write(uint8_t item_id, uint16_t size, uint8_t *data);
  */
 hal_nvm_status_t hal_nvm_read(uint8_t item_id, uint16_t size, uint8_t *data);
 
+/**
+ * Get the size of a previously stored data item
+ * @param item_id Unique identifier for the data item
+ * @param size Receives the number of bytes stored for the item
+ * @return HAL_NVM_SUCCESS on success, error code if item not found
+ */
+hal_nvm_status_t hal_nvm_get_size(uint8_t item_id, uint16_t *size);
+
 /**
  * Remove stored data item from non-volatile memory
  * @param item_id Unique identifier for the data item to delete
@@ -11,6 +11,13 @@ extern int tl_printf(const char *format, ...);
 
 #include "stdio.h"
 
+#elif defined(HAL_STUB)
+
+// Firmware logs go through the leveled stub logger (stub/machine_io.c)
+extern int stub_fw_printf(const char *format, ...);
+
+#define printf stub_fw_printf
+
 #else
 #include <stdio.h>
 #endif
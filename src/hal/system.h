@@ -1,6 +1,16 @@
 #ifndef _HAL_SYSTEM_H_
 #define _HAL_SYSTEM_H_
 
+/** Cause of the last reset, values are part of the diagnostics cluster */
+typedef enum {
+  HAL_RESET_REASON_UNKNOWN = 0,
+  HAL_RESET_REASON_POWER_ON = 1,
+  HAL_RESET_REASON_SOFTWARE = 2,
+  HAL_RESET_REASON_WATCHDOG = 3,
+  HAL_RESET_REASON_EXTERNAL = 4, // Reset pin
+  HAL_RESET_REASON_CRASH = 5,    // Fault or assert
+} hal_reset_reason_t;
+
 /**
  * Reset the system/microcontroller
  */
@@ -8,4 +18,10 @@ void __attribute__((noreturn)) hal_system_reset(void);
 
 void hal_factory_reset(void);
 
-#endif /* _HAL_SYSTEM_H_ */
\ No newline at end of file
+/**
+ * Get the cause of the last reset
+ * @return Reset reason, HAL_RESET_REASON_UNKNOWN if the platform can't tell
+ */
+hal_reset_reason_t hal_system_get_reset_reason(void);
+
+#endif /* _HAL_SYSTEM_H_ */
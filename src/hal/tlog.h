@@ -0,0 +1,57 @@
+#ifndef HAL_TLOG_H
+#define HAL_TLOG_H
+
+#include "hal/printf_selector.h"
+#include <stdint.h>
+
+/*
+ * Tokenized logging for hot paths (button edges, relay changes, NVM access).
+ *
+ * TLOG() takes a printf format with integer arguments only. On Telink debug
+ * builds the call does not format anything: it queues the address of the
+ * format string (its token, fixed at link time) and the raw arguments into a
+ * RAM ring, which the main loop drains to UART when the stack is idle.
+ * helper_scripts/tlog_decode.py turns the frames back into text using the ELF.
+ *
+ * Everywhere else TLOG() is a plain printf.
+ */
+
+#define TLOG_MAX_ARGS 6
+
+#if defined(HAL_TELINK) && defined(UART_PRINTF_MODE) && UART_PRINTF_MODE
+#define TLOG_TOKENIZED
+#endif
+
+#ifdef TLOG_TOKENIZED
+
+// Leading 0 keeps the array non-empty for calls without arguments
+#define TLOG(fmt, ...)                                                         \
+  do {                                                                         \
+    const uint32_t tlog_args_[] = {0, ##__VA_ARGS__};                          \
+    hal_tlog_write(fmt, tlog_args_ + 1,                                        \
+                   sizeof(tlog_args_) / sizeof(uint32_t) - 1);                 \
+  } while (0)
+
+/**
+ * Queues one log entry, never blocks. Entries that do not fit are counted
+ * and reported as a dropped frame on the next drain
+ * @param fmt Format string in flash, its address is the token
+ * @param args Integer arguments
+ * @param nargs Number of arguments, at most TLOG_MAX_ARGS
+ */
+void hal_tlog_write(const char *fmt, const uint32_t *args, uint8_t nargs);
+
+/**
+ * Sends queued entries to UART
+ * @param max_frames Maximum number of entries to send, 0 for all
+ * @return Number of entries still queued
+ */
+uint16_t hal_tlog_drain(uint16_t max_frames);
+
+#else
+
+#define TLOG(...) printf(__VA_ARGS__)
+
+#endif
+
+#endif
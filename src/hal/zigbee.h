@@ -91,6 +91,18 @@ void hal_zigbee_leave_network(void);
 /** Start searching for and joining Zigbee networks (pairing mode) */
 void hal_zigbee_start_network_steering(void);
 
+/**
+ * Get the device IEEE (EUI-64) address
+ * @param addr Receives the 8 address bytes, least significant first
+ */
+void hal_zigbee_get_ieee_address(uint8_t addr[8]);
+
+/**
+ * Set how often an end device polls its parent for data, routers ignore it
+ * @param interval_ms Poll interval in milliseconds
+ */
+void hal_zigbee_set_poll_interval(uint32_t interval_ms);
+
 /** Set Zigbee OTA image type */
 void hal_zigbee_set_image_type(uint16_t image_type);
 
@@ -165,11 +177,60 @@ hal_zigbee_status_t
 hal_zigbee_send_report_attr(uint8_t endpoint, uint16_t cluster_id,
                             uint16_t attr_id, uint8_t zcl_type_id,
                             const void *value, uint8_t value_len);
+
+#define HAL_ZIGBEE_MAX_REPORT_ATTRS 4
+
+/** One attribute of a multi-attribute report */
+typedef struct {
+  uint16_t attr_id;
+  uint8_t zcl_type_id;
+  uint8_t value_len;
+  const void *value;
+} hal_zigbee_report_attr;
+
+/**
+ * Send several attributes of a cluster in a single report frame
+ * @param endpoint Source endpoint
+ * @param cluster_id Cluster containing the attributes
+ * @param attrs Attributes to report
+ * @param attrs_cnt Number of attributes, at most HAL_ZIGBEE_MAX_REPORT_ATTRS
+ * @return HAL_ZIGBEE_OK on success, error code otherwise
+ */
+hal_zigbee_status_t
+hal_zigbee_send_report_attrs(uint8_t endpoint, uint16_t cluster_id,
+                             const hal_zigbee_report_attr *attrs,
+                             uint8_t attrs_cnt);
+
 /** Send Zigbee "announce" command to notify other devices of our presence
  * @return HAL_ZIGBEE_OK on success, error code otherwise
  */
 hal_zigbee_status_t hal_zigbee_send_announce(void);
 
+/** Channels 11-26 of the 2.4 GHz band, bit n is channel n */
+#define HAL_ZIGBEE_ALL_CHANNELS_MASK 0x07FFF800
+
+/** Network the stack is commissioned to */
+typedef struct {
+  uint8_t channel;
+  uint16_t pan_id;
+  uint8_t ext_pan_id[8];
+} hal_zigbee_network_info;
+
+/**
+ * Get the network kept in the stack's NVM, joined to it right now or not
+ * @param info Receives the network parameters
+ * @return false if the device is factory new
+ */
+bool hal_zigbee_get_network_info(hal_zigbee_network_info *info);
+
+/**
+ * Secure rejoin of the commissioned network, reported through the network
+ * status callback: JOINING now, then JOINED or NOT_JOINED
+ * @param channel_mask Channels to scan, bit n is channel n
+ * @return HAL_ZIGBEE_OK if the rejoin started, error code otherwise
+ */
+hal_zigbee_status_t hal_zigbee_rejoin(uint32_t channel_mask);
+
 /** Find cluster definition by endpoint and cluster ID */
 static inline hal_zigbee_cluster *
 hal_zigbee_find_cluster(hal_zigbee_endpoint *endpoints, uint8_t endpoints_count,
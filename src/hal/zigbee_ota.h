@@ -12,4 +12,66 @@ void hal_ota_cluster_setup(hal_zigbee_cluster *cluster);
 /** Initialize over-the-air firmware update functionality */
 void hal_zigbee_init_ota();
 
-#endif
\ No newline at end of file
+// Partial download the OTA client kept over a reboot and continues when the
+// server offers the same image again (zigbee/ota_resume.h). Telink's client
+// keeps none, it starts every download from zero.
+
+typedef struct {
+  uint16_t manufacturer_code;
+  uint16_t image_type;
+  uint32_t file_version;
+} hal_ota_image_id_t;
+
+/**
+ * Get the partial download, if any
+ * @param id Receives the image it belongs to
+ * @param offset Receives how much of it is stored, the client goes on there
+ * @return true if a partial download is stored
+ */
+bool hal_ota_partial_get(hal_ota_image_id_t *id, uint32_t *offset);
+
+/**
+ * Reads back the stored part of the partial download
+ * @param offset Start, relative to the stored data
+ */
+void hal_ota_partial_read(uint32_t offset, uint8_t *data, uint32_t len);
+
+/** Drops the partial download, the next one starts from zero */
+void hal_ota_partial_clear(void);
+
+// Flash slot the next image is downloaded to, for images the firmware
+// unpacks itself (zigbee/ota_image.h). Only the stub implements these so
+// far. Silabs has no need, its bootloader unpacks GBL images. Telink needs
+// the SDK's OTA client to hand its slot writes over, not done yet.
+
+/** Erase unit of the OTA slot */
+#define HAL_OTA_SLOT_SECTOR_SIZE 4096
+
+/** @return Size of the OTA slot in bytes */
+uint32_t hal_ota_slot_size(void);
+
+/**
+ * Erases one sector of the OTA slot
+ * @param offset Sector start, relative to the slot
+ */
+void hal_ota_slot_erase_sector(uint32_t offset);
+
+/**
+ * Writes to erased parts of the OTA slot
+ * @param offset Start, relative to the slot
+ */
+void hal_ota_slot_write(uint32_t offset, const uint8_t *data, uint32_t len);
+
+/**
+ * Reads back from the OTA slot
+ * @param offset Start, relative to the slot
+ */
+void hal_ota_slot_read(uint32_t offset, uint8_t *data, uint32_t len);
+
+/**
+ * Reads the running firmware, the base of delta images
+ * @param offset Start, relative to the running firmware
+ */
+void hal_ota_running_read(uint32_t offset, uint8_t *data, uint32_t len);
+
+#endif
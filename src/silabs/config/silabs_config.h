@@ -5,4 +5,19 @@
 #define NVM_MIGRATIONS_VERSION 1
 
 // <o DEFAULT_CONFIG>
-#define DEFAULT_CONFIG "device;device;"
\ No newline at end of file
+#define DEFAULT_CONFIG "device;device;"
+
+// <o DEVICE_CONFIG_MAX_BUTTONS>
+#define DEVICE_CONFIG_MAX_BUTTONS 5
+
+// <o DEVICE_CONFIG_MAX_LEDS>
+#define DEVICE_CONFIG_MAX_LEDS 5
+
+// <o DEVICE_CONFIG_MAX_SWITCHES>
+#define DEVICE_CONFIG_MAX_SWITCHES 4
+
+// <o DEVICE_CONFIG_MAX_RELAYS>
+#define DEVICE_CONFIG_MAX_RELAYS 4
+
+// <o POLL_CONTROL_SHORT_INTERVAL_MS>
+#define POLL_CONTROL_SHORT_INTERVAL_MS 100
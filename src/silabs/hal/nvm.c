@@ -32,6 +32,21 @@ hal_nvm_status_t hal_nvm_write(uint8_t item_id, uint16_t size, uint8_t *data) {
   return nvm3_to_hal_status(status);
 }
 
+hal_nvm_status_t hal_nvm_get_size(uint8_t item_id, uint16_t *size) {
+  if (size == NULL) {
+    return HAL_NVM_ERROR;
+  }
+
+  uint32_t object_type;
+  size_t object_size;
+  Ecode_t status = nvm3_getObjectInfo(nvm3_defaultHandle, item_id, &object_type,
+                                      &object_size);
+  if (status == ECODE_NVM3_OK) {
+    *size = (uint16_t)object_size;
+  }
+  return nvm3_to_hal_status(status);
+}
+
 hal_nvm_status_t hal_nvm_delete(uint8_t item_id) {
   Ecode_t status = nvm3_deleteObject(nvm3_defaultHandle, item_id);
   return nvm3_to_hal_status(status);
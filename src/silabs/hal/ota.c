@@ -1,5 +1,6 @@
 #include "app/framework/include/af.h"
 #include "hal/zigbee_ota.h"
+#include <string.h>
 
 static struct OtaData {
   uint64_t upgrade_server_id;
@@ -40,4 +41,29 @@ void hal_zigbee_set_image_type(uint16_t image_type) {
   // Silabs doesn't support dynamic image type setting
   // This can be probably hacked in, but it requires patching their SDK
   // internals so it's out of scope for now
-}
\ No newline at end of file
+}
+
+bool hal_ota_partial_get(hal_ota_image_id_t *id, uint32_t *offset) {
+  uint32_t total_size = 0;
+  sl_zigbee_af_ota_image_id_t image;
+  if (sl_zigbee_af_ota_storage_check_temp_data_cb(offset, &total_size,
+                                                   &image) !=
+      SL_ZIGBEE_AF_OTA_STORAGE_PARTIAL_FILE_FOUND) {
+    return false;
+  }
+  id->manufacturer_code = image.manufacturerId;
+  id->image_type = image.imageTypeId;
+  id->file_version = image.firmwareVersion;
+  return true;
+}
+
+void hal_ota_partial_read(uint32_t offset, uint8_t *data, uint32_t len) {
+  // The storage driver keeps the file as received, from offset 0
+  if (!sl_zigbee_af_ota_storage_driver_read_cb(offset, len, data)) {
+    memset(data, 0xff, len);
+  }
+}
+
+void hal_ota_partial_clear(void) {
+  sl_zigbee_af_ota_storage_clear_temp_data_cb();
+}
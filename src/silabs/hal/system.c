@@ -10,4 +10,25 @@ void hal_system_reset(void) { halReboot(); }
 void hal_factory_reset(void) {
   hal_zigbee_leave_network();
   sl_zigbee_clear_binding_table();
-}
\ No newline at end of file
+}
+
+hal_reset_reason_t hal_system_get_reset_reason(void) {
+  switch (halGetResetInfo()) {
+  case RESET_POWERON:
+  case RESET_BROWNOUT:
+    return HAL_RESET_REASON_POWER_ON;
+  case RESET_SOFTWARE:
+  case RESET_BOOTLOADER:
+    return HAL_RESET_REASON_SOFTWARE;
+  case RESET_WATCHDOG:
+    return HAL_RESET_REASON_WATCHDOG;
+  case RESET_EXTERNAL:
+    return HAL_RESET_REASON_EXTERNAL;
+  case RESET_CRASH:
+  case RESET_FAULT:
+  case RESET_FATAL:
+    return HAL_RESET_REASON_CRASH;
+  default:
+    return HAL_RESET_REASON_UNKNOWN;
+  }
+}
@@ -1,4 +1,5 @@
 #include "hal/tasks.h"
+#include "base_components/diagnostics.h"
 #include "zigbee_app_framework_event.h"
 #include <stddef.h>
 #include <stdio.h>
@@ -7,9 +8,13 @@
 #define container_of(ptr, type, member)                                        \
   ((type *)((char *)(ptr) - offsetof(type, member)))
 
+// Events with a pending delay, for the diagnostics peak
+static uint16_t scheduled_cnt = 0;
+
 static void _af_event_handler(sl_zigbee_af_event_t *event) {
   // Get hal_task_t from embedded platform_struct event
   hal_task_t *task = container_of(event, hal_task_t, platform_struct);
+  scheduled_cnt--;
   task->handler(task->arg);
 }
 
@@ -18,9 +23,15 @@ void hal_tasks_init(hal_task_t *task) {
 }
 
 void hal_tasks_schedule(hal_task_t *task, uint32_t delay_ms) {
+  if (!sl_zigbee_af_event_is_scheduled(&task->platform_struct)) {
+    diagnostics_tasks_scheduled(++scheduled_cnt);
+  }
   sl_zigbee_af_event_set_delay_ms(&task->platform_struct, delay_ms);
 }
 
 void hal_tasks_unschedule(hal_task_t *task) {
+  if (sl_zigbee_af_event_is_scheduled(&task->platform_struct)) {
+    scheduled_cnt--;
+  }
   sl_zigbee_af_event_set_inactive(&task->platform_struct);
 }
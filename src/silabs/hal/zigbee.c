@@ -1,4 +1,7 @@
 #include "hal/zigbee.h"
+#include "base_components/diagnostics.h"
+#include "device_config/capacities.h"
+#include "zigbee/poll_control.h"
 
 #include "app/framework/include/af.h"
 #include "app/framework/plugin/ota-client/ota-client.h"
@@ -6,7 +9,7 @@
 #include <stddef.h>
 #include <string.h>
 
-#define MAX_CLUSTERS 32
+#define MAX_CLUSTERS DEVICE_CONFIG_MAX_CLUSTERS
 #define MAX_ATTRS 128
 
 sl_zigbee_af_endpoint_type_t endpoint_type_buffer[ZCL_FIXED_ENDPOINT_COUNT];
@@ -125,6 +128,7 @@ void hal_zigbee_notify_attribute_changed(uint8_t endpoint, uint8_t cluster_id,
   if (attr == NULL) {
     return;
   }
+  diagnostics.reports_sent++;
   sl_zigbee_af_reporting_attribute_change_cb(
       endpoint, cluster_id, attribute_id,
       cluster->is_server ? CLUSTER_MASK_SERVER : CLUSTER_MASK_CLIENT, 0,
@@ -176,12 +180,14 @@ sl_zigbee_af_status_t sl_zigbee_af_external_attribute_write_cb(
 }
 
 static bool network_steering_in_progress = false;
+static bool rejoin_in_progress = false; // Asked for by the app
 
 hal_zigbee_network_status_t hal_zigbee_get_network_status() {
   sl_zigbee_network_status_t ns = sl_zigbee_af_network_state();
   if (ns == SL_ZIGBEE_JOINED_NETWORK) {
     return HAL_ZIGBEE_NETWORK_JOINED;
-  } else if (ns == SL_ZIGBEE_JOINING_NETWORK || network_steering_in_progress) {
+  } else if (ns == SL_ZIGBEE_JOINING_NETWORK || network_steering_in_progress ||
+             rejoin_in_progress) {
     return HAL_ZIGBEE_NETWORK_JOINING;
   } else {
     return HAL_ZIGBEE_NETWORK_NOT_JOINED;
@@ -197,6 +203,8 @@ void hal_register_on_network_status_change_callback(
 }
 
 void sl_zigbee_af_stack_status_callback(sl_status_t status) {
+  // The outcome of a rejoin, network up or down
+  rejoin_in_progress = false;
   if (network_status_change_callback != NULL) {
     network_status_change_callback(hal_zigbee_get_network_status());
   }
@@ -213,6 +221,50 @@ void hal_zigbee_start_network_steering() {
   }
 }
 
+void hal_zigbee_get_ieee_address(uint8_t addr[8]) {
+  sl_zigbee_get_eui64(addr);
+}
+
+void hal_zigbee_set_poll_interval(uint32_t interval_ms) {
+#ifdef END_DEVICE
+  // The app does its own backoff on the long poll. The stack still switches
+  // to the short poll while it waits for a response.
+  sl_zigbee_af_set_short_poll_interval_ms_cb(poll_control.short_interval_ms);
+  sl_zigbee_af_set_long_poll_interval_ms_cb(interval_ms);
+#else
+  (void)interval_ms;
+#endif
+}
+
+bool hal_zigbee_get_network_info(hal_zigbee_network_info *info) {
+  sl_zigbee_node_type_t node_type;
+  sl_zigbee_network_parameters_t parameters;
+  if (sl_zigbee_af_network_state() == SL_ZIGBEE_NO_NETWORK ||
+      sl_zigbee_get_network_parameters(&node_type, &parameters) !=
+          SL_STATUS_OK) {
+    return false;
+  }
+  info->channel = parameters.radioChannel;
+  info->pan_id = parameters.panId;
+  memcpy(info->ext_pan_id, parameters.extendedPanId,
+         sizeof(info->ext_pan_id));
+  return true;
+}
+
+hal_zigbee_status_t hal_zigbee_rejoin(uint32_t channel_mask) {
+  if (sl_zigbee_find_and_rejoin_network(true, channel_mask,
+                                        SL_ZIGBEE_REJOIN_DUE_TO_APP_EVENT_1,
+                                        SL_ZIGBEE_UNKNOWN_DEVICE) !=
+      SL_STATUS_OK) {
+    return HAL_ZIGBEE_ERR_BAD_ARG;
+  }
+  rejoin_in_progress = true;
+  if (network_status_change_callback != NULL) {
+    network_status_change_callback(hal_zigbee_get_network_status());
+  }
+  return HAL_ZIGBEE_OK;
+}
+
 // Network steering complete callback
 void sl_zigbee_af_network_steering_complete_cb(sl_status_t status,
                                                uint8_t totalBeacons,
@@ -292,6 +344,42 @@ hal_zigbee_send_report_attr(uint8_t endpoint, uint16_t cluster_id,
   return (st == SL_STATUS_OK) ? HAL_ZIGBEE_OK : HAL_ZIGBEE_ERR_SEND_FAILED;
 }
 
+hal_zigbee_status_t
+hal_zigbee_send_report_attrs(uint8_t endpoint, uint16_t cluster_id,
+                             const hal_zigbee_report_attr *attrs,
+                             uint8_t attrs_cnt) {
+  if (attrs_cnt == 0 || attrs_cnt > HAL_ZIGBEE_MAX_REPORT_ATTRS)
+    return HAL_ZIGBEE_ERR_BAD_ARG;
+  if (sl_zigbee_af_network_state() != SL_ZIGBEE_JOINED_NETWORK)
+    return HAL_ZIGBEE_ERR_NOT_JOINED;
+
+  /* attrId(2) + type(1) + value, for each attribute */
+  uint8_t buf[HAL_ZIGBEE_MAX_REPORT_ATTRS * (2 + 1 + 8)];
+  uint8_t len = 0;
+  for (uint8_t i = 0; i < attrs_cnt; i++) {
+    if (attrs[i].value_len > 8)
+      return HAL_ZIGBEE_ERR_BAD_ARG;
+    buf[len++] = (uint8_t)(attrs[i].attr_id & 0xFF);
+    buf[len++] = (uint8_t)(attrs[i].attr_id >> 8);
+    buf[len++] = attrs[i].zcl_type_id;
+    memmove(&buf[len], attrs[i].value, attrs[i].value_len);
+    len += attrs[i].value_len;
+  }
+
+  sl_status_t st =
+      sl_zigbee_af_fill_command_global_server_to_client_report_attributes(
+          cluster_id, buf, len);
+  if (st != SL_STATUS_OK)
+    return HAL_ZIGBEE_ERR_SEND_FAILED;
+
+  sl_zigbee_af_set_command_endpoints(endpoint, endpoint);
+  st = sl_zigbee_af_send_command_unicast_to_bindings();
+  if (st != SL_STATUS_OK)
+    return HAL_ZIGBEE_ERR_SEND_FAILED;
+  diagnostics.reports_sent++;
+  return HAL_ZIGBEE_OK;
+}
+
 hal_zigbee_status_t hal_zigbee_send_announce(void) {
   if (sl_zigbee_send_device_announcement() != SL_STATUS_OK) {
     return HAL_ZIGBEE_ERR_SEND_FAILED;
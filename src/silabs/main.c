@@ -30,13 +30,25 @@
 #include "zigbee/relay_cluster.h"
 #include "zigbee/switch_cluster.h"
 
-// TODO: make configurable via ZCL
-#define POLLING_INTERVAL_MS 100
-
 void drop_old_ota_image_if_any() {
-  // Drop old OTA image if any exists
-  // Allows to re-download FORCE image multiple times
-  uint32_t currentOffset =
+  // Drop a finished OTA image, it was either bootloaded or given up on.
+  // Allows to re-download FORCE image multiple times.
+  // A partial download that is still here passed zigbee/ota_resume in
+  // app_init(). The OTA client continues it from the stored offset when the
+  // server offers the same image again, and clears it when another image is
+  // offered.
+  uint32_t currentOffset = 0;
+  uint32_t totalImageSize = 0;
+  sl_zigbee_af_ota_image_id_t id;
+  sl_zigbee_af_ota_storage_status_t status =
+      sl_zigbee_af_ota_storage_check_temp_data_cb(&currentOffset,
+                                                   &totalImageSize, &id);
+  if (status == SL_ZIGBEE_AF_OTA_STORAGE_PARTIAL_FILE_FOUND) {
+    printf("Keeping partial OTA image, offset: %lu of %lu\n", currentOffset,
+           totalImageSize);
+    return;
+  }
+  currentOffset =
       sl_zigbee_af_ota_storage_driver_retrieve_last_stored_offset_cb();
   if (currentOffset > 0) {
     printf("Dropping old OTA image, current offset: %lu\n", currentOffset);
@@ -54,11 +66,6 @@ int main(void) {
 
   drop_old_ota_image_if_any();
 
-  // Switch should never "long poll", as it should always be somewhat reactive
-  // to ZCL commands.
-  sl_zigbee_af_set_short_poll_interval_ms_cb(POLLING_INTERVAL_MS);
-  sl_zigbee_af_set_long_poll_interval_ms_cb(POLLING_INTERVAL_MS);
-
 #if defined(SL_CATALOG_KERNEL_PRESENT)
   // Start the kernel. Task(s) created in app_init() will start running.
   sl_system_kernel_start();
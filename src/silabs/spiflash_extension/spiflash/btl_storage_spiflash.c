@@ -53,6 +53,10 @@ const BootloaderStorageLayout_t storageLayout = {
   BTL_STORAGE_SLOTS
 };
 
+// Found by storage_init(), so that range checks don't have to wait for a
+// program or erase in progress to read the JEDEC ID again
+static StorageSpiflashDevice_t detectedDeviceType = UNKNOWN_DEVICE;
+
 // -----------------------------------------------------------------------------
 // Functions
 
@@ -331,16 +335,17 @@ BootloaderStorageImplementationInformation_t getDeviceInfo(void)
 
 static uint32_t getDeviceSize(StorageSpiflashDevice_t *pDeviceType)
 {
-  StorageSpiflashDevice_t deviceType;
-  waitUntilNotBusy();
-  if (pDeviceType == NULL) {
-    deviceType = getDeviceType();
-  } else {
+  StorageSpiflashDevice_t deviceType = detectedDeviceType;
+  if ((pDeviceType != NULL) && (*pDeviceType != UNKNOWN_DEVICE)) {
     deviceType = *pDeviceType;
-    if (deviceType == UNKNOWN_DEVICE) {
-      deviceType = getDeviceType();
-      *pDeviceType = deviceType;
-    }
+  }
+  if (deviceType == UNKNOWN_DEVICE) {
+    // The JEDEC ID can only be read once the part is idle
+    waitUntilNotBusy();
+    deviceType = getDeviceType();
+  }
+  if (pDeviceType != NULL) {
+    *pDeviceType = deviceType;
   }
   switch (deviceType) {
     case ISSI_256K_DEVICE:
@@ -414,6 +419,8 @@ static bool verifyErased(uint32_t address, uint32_t len)
 
   while (len--) {
     if (spi_readByte() != 0xFF) {
+      // Release the bus, the next command would be taken as more address
+      spi_setCsInactive();
       return false;
     }
   }
@@ -435,6 +442,26 @@ static void writePage(uint32_t address, const uint8_t *data, uint32_t length)
   spi_setCsInactive();
 }
 
+// Parts with a 32 kB block erase next to the 4 kB sector and 64 kB block
+// ones. A block erase takes a fraction of the time of its sectors one by one.
+static bool supportsBlockErase32K(StorageSpiflashDevice_t deviceType)
+{
+  switch (deviceType) {
+    case SPANSION_8M_DEVICE:
+    case NUMONYX_2M_DEVICE:
+    case NUMONYX_4M_DEVICE:
+    case NUMONYX_8M_DEVICE:
+    case NUMONYX_16M_DEVICE:
+    case ISSI_256K_DEVICE:
+    case ISSI_512K_DEVICE:
+      return false;
+    default:
+      return true;
+  }
+}
+
+// Only waits for the previous operation, an erase runs on while the caller
+// goes on. The next command, or storage_isBusy(), picks up its completion.
 static void eraseCommand(uint8_t command, uint32_t address)
 {
   waitUntilNotBusy();
@@ -469,6 +496,7 @@ int32_t storage_init(void)
   if (deviceType == UNKNOWN_DEVICE) {
     return BOOTLOADER_ERROR_INIT_STORAGE;
   }
+  detectedDeviceType = deviceType;
 
   // For Atmel devices, need to unprotect them because default is protected
   if ((deviceType >= ATMEL_4M_DEVICE) && (deviceType <= ATMEL_8M_DEVICE)) {
@@ -602,23 +630,23 @@ int32_t storage_eraseRaw(uint32_t address, size_t totalLength)
     return BOOTLOADER_OK;
   }
 
-  // first handle leading partial blocks
-  while (totalLength && (address & deviceBlockMask)) {
-    eraseCommand(CMD_ERASE_SECTOR, address);
-    address += DEVICE_SECTOR_SIZE;
-    totalLength -= DEVICE_SECTOR_SIZE;
-  }
-  // handle any full blocks
-  while (totalLength >= deviceBlockSize) {
-    eraseCommand(CMD_ERASE_BLOCK, address);
-    address += deviceBlockSize;
-    totalLength -= deviceBlockSize;
-  }
-  // finally handle any trailing partial blocks
+  // Largest erase that is aligned and fits at each step: sectors up to the
+  // next block boundary, then full blocks, then sectors again
+  bool block32K = supportsBlockErase32K(deviceType);
   while (totalLength) {
-    eraseCommand(CMD_ERASE_SECTOR, address);
-    address += DEVICE_SECTOR_SIZE;
-    totalLength -= DEVICE_SECTOR_SIZE;
+    uint8_t command = CMD_ERASE_SECTOR;
+    uint32_t eraseLength = DEVICE_SECTOR_SIZE;
+    if (!(address & deviceBlockMask) && (totalLength >= deviceBlockSize)) {
+      command = CMD_ERASE_BLOCK;
+      eraseLength = deviceBlockSize;
+    } else if (block32K && !(address & DEVICE_BLOCK_MASK_32K)
+               && (totalLength >= DEVICE_BLOCK_SIZE_32K)) {
+      command = CMD_ERASE_BLOCK_32K;
+      eraseLength = DEVICE_BLOCK_SIZE_32K;
+    }
+    eraseCommand(command, address);
+    address += eraseLength;
+    totalLength -= eraseLength;
   }
   return BOOTLOADER_OK;
 }
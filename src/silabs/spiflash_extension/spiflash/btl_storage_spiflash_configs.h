@@ -108,6 +108,7 @@
 #define CMD_PAGE_PROG                       (0x02)
 #define CMD_ERASE_SECTOR                    (0x20)
 #define CMD_ERASE_BLOCK                     (0xD8)
+#define CMD_ERASE_BLOCK_32K                 (0x52)
 #define CMD_ERASE_CHIP                      (0xC7)
 #define CMD_POWER_DOWN                      (0xB9)
 #define CMD_POWER_UP                        (0xAB)
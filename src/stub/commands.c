@@ -1,5 +1,6 @@
 #include "commands.h"
 #include "machine_io.h"
+#include "machine_proto.h"
 #include "parsing.h"
 
 #include "hal/timer.h"
@@ -7,16 +8,19 @@
 
 #include "stub/hal/stub.h"
 
+#include "stub/gpio_waveform.h"
 #include "stub/stub_app.h"
+#include "stub/trace_replay.h"
 #include "zigbee/consts.h"
 #include <stdio.h>
 #include <string.h>
+#include <sys/resource.h>
 
 extern volatile sig_atomic_t g_should_exit;
 
 static int cmd_machine(int argc, char **argv) {
   if (argc != 2) {
-    fprintf(stderr, "Usage: machine on|off\n");
+    fprintf(stderr, "Usage: machine on|off|bin\n");
     io_res_err("usage");
     return -1;
   }
@@ -31,10 +35,41 @@ static int cmd_machine(int argc, char **argv) {
     fprintf(stderr, "machine: off\n");
     return 0;
   }
+  if (strcmp(argv[1], "bin") == 0) {
+    if (g_binary_mode) {
+      io_res_ok(NULL);
+      return 0;
+    }
+    // Acknowledged as text, frames only start after this line
+    g_machine_mode = true;
+    io_res_ok(NULL);
+    if (!machine_proto_enable()) {
+      io_res_err("binary_unavailable");
+      return -1;
+    }
+    return 0;
+  }
   io_res_err("arg");
   return -1;
 }
 
+static int cmd_subscribe(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: subscribe all|none|<kind>...\n");
+    io_res_err("usage");
+    return -1;
+  }
+  if (argc == 2 && strcmp(argv[1], "all") == 0) {
+    io_evt_subscribe(0, NULL);
+  } else if (argc == 2 && strcmp(argv[1], "none") == 0) {
+    io_evt_unsubscribe_all();
+  } else {
+    io_evt_subscribe(argc - 1, argv + 1);
+  }
+  io_res_ok("kinds=%d", argc - 1);
+  return 0;
+}
+
 static int cmd_help(int argc, char **argv) {
   (void)argc;
   (void)argv;
@@ -302,14 +337,172 @@ static int cmd_step_time(int argc, char **argv) {
     io_res_err("bad_step=%s", argv[1]);
     return -1;
   }
-  stub_millis_step((uint64_t)step);
+  // Everything emitted on the way is reported before the response
+  stub_app_advance((uint32_t)step);
   io_res_ok("stepped_ms=%ld", step);
   return 0;
 }
 
+static int cmd_replay(int argc, char **argv) {
+  if (argc != 2 && argc != 3) {
+    fprintf(stderr, "Usage: replay <file> [settle_ms]\n");
+    io_res_err("usage");
+    return -1;
+  }
+  uint32_t settle_ms = 0;
+  if (argc == 3 && parse_u32_dec(argv[2], &settle_ms)) {
+    fprintf(stderr, "Bad settle time: %s\n", argv[2]);
+    io_res_err("bad_settle=%s", argv[2]);
+    return -1;
+  }
+  trace_replay_result_t result;
+  if (!trace_replay_file(argv[1], settle_ms, &result)) {
+    io_res_err("bad_trace line=%u records=%u", result.error_line,
+               result.records);
+    return -1;
+  }
+  io_res_ok("records=%u duration_ms=%u", result.records, result.duration_ms);
+  return 0;
+}
+
+static uint64_t cpu_time_us(void) {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return (uint64_t)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000 +
+         usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+static uint64_t stats_cpu_base_us = 0;
+static uint32_t stats_time_base_ms = 0;
+
+static int cmd_stats(int argc, char **argv) {
+  if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+    fprintf(stderr, "Usage: stats [reset]\n");
+    io_res_err("usage");
+    return -1;
+  }
+  if (argc == 2) {
+    stub_tasks_reset_peak();
+    stub_gpio_reset_callback_count();
+    stub_nvm_reset_write_count();
+    stats_cpu_base_us = cpu_time_us();
+    stats_time_base_ms = hal_millis();
+  }
+  uint8_t active, peak, peak_timers;
+  stub_tasks_get_usage(&active, &peak, &peak_timers);
+  io_res_ok("tasks_active=%u tasks_peak=%u timers_peak=%u "
+            "task_reschedules=%u gpio_callbacks=%u nvm_writes=%u "
+            "elapsed_ms=%u cpu_us=%llu",
+            active, peak, peak_timers, stub_tasks_get_reschedule_count(),
+            stub_gpio_get_callback_count(), stub_nvm_get_write_count(),
+            hal_millis() - stats_time_base_ms,
+            (unsigned long long)(cpu_time_us() - stats_cpu_base_us));
+  return 0;
+}
+
+static int cmd_wave(int argc, char **argv) {
+  gpio_wave_kind_t kind;
+  if (argc < 3 || !gpio_wave_parse_kind(argv[2], &kind)) {
+    fprintf(stderr, "Usage: wave <pin> bounce|glitch|hum [key=value]...\n");
+    io_res_err("usage");
+    return -1;
+  }
+  hal_gpio_pin_t pin = hal_gpio_parse_pin(argv[1]);
+  if (pin == HAL_INVALID_PIN) {
+    io_res_err("bad_pin=%s", argv[1]);
+    return -1;
+  }
+  gpio_wave_t wave;
+  gpio_wave_init(&wave, kind);
+  for (int i = 3; i < argc; i++) {
+    if (!gpio_wave_set_option(&wave, argv[i])) {
+      fprintf(stderr, "Bad option: %s\n", argv[i]);
+      io_res_err("bad_option=%s", argv[i]);
+      return -1;
+    }
+  }
+
+  uint64_t cpu_start_us = cpu_time_us();
+  gpio_wave_result_t result;
+  gpio_wave_play(pin, &wave, &result);
+  io_res_ok("edges=%u callbacks=%u reschedules=%u debounced=%u "
+            "false_presses=%u missed=%u duration_ms=%u cpu_us=%llu",
+            result.edges, result.callbacks, result.reschedules,
+            result.debounced, result.false_presses, result.missed,
+            result.duration_ms,
+            (unsigned long long)(cpu_time_us() - cpu_start_us));
+  return 0;
+}
+
+static int cmd_log(int argc, char **argv) {
+  if (argc >= 3 && argc <= 4 && strcmp(argv[1], "level") == 0) {
+    int level = io_log_parse_level(argv[2]);
+    if (level < 0) {
+      io_res_err("bad_level=%s", argv[2]);
+      return -1;
+    }
+    io_log_set_level(argc == 4 ? argv[3] : NULL, (io_log_level_t)level);
+  } else if (argc == 3 && strcmp(argv[1], "ring") == 0) {
+    uint32_t lines;
+    if (parse_u32_dec(argv[2], &lines) || !io_log_capture(lines)) {
+      io_res_err("bad_lines=%s max=%u", argv[2], IO_LOG_RING_MAX);
+      return -1;
+    }
+  } else if (argc == 2 && strcmp(argv[1], "dump") == 0) {
+    io_res_ok("lines=%u", io_log_dump());
+    return 0;
+  } else if (argc == 2 && strcmp(argv[1], "clear") == 0) {
+    io_log_clear();
+  } else if (argc != 1) {
+    fprintf(stderr, "Usage: log [level <level> [category] | ring <lines> | "
+                    "dump | clear]\n");
+    io_res_err("usage");
+    return -1;
+  }
+  io_res_ok("level=%s captured=%u", io_log_level_name(io_log_get_level(NULL)),
+            io_log_captured());
+  return 0;
+}
+
+static int cmd_reset(int argc, char **argv) {
+  const char *device_conf = NULL;
+  bool joined = true;
+  bool frozen = false;
+  bool keep_nvm = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--config") == 0 && i + 1 < argc) {
+      device_conf = argv[++i];
+    } else if (strcmp(argv[i], "--not-joined") == 0) {
+      joined = false;
+    } else if (strcmp(argv[i], "--freeze-time") == 0) {
+      frozen = true;
+    } else if (strcmp(argv[i], "--keep-nvm") == 0) {
+      keep_nvm = true;
+    } else {
+      fprintf(stderr, "Usage: reset [--config <str>] [--not-joined] "
+                      "[--freeze-time] [--keep-nvm]\n");
+      io_res_err("usage");
+      return -1;
+    }
+  }
+  if (device_conf && strlen(device_conf) >= APP_DEVICE_CONF_MAX) {
+    io_res_err("config_too_long");
+    return -1;
+  }
+
+  // Usage stats count from the restart, like from a process start
+  stats_cpu_base_us = cpu_time_us();
+  stats_time_base_ms = 0;
+  stub_app_reset(device_conf, joined, frozen, keep_nvm);
+
+  io_res_ok("uptime_ms=%u", hal_millis());
+  return 0;
+}
+
 /* Command table */
 static const SimpleReplCommand kCmds[] = {
     {"machine", cmd_machine},
+    {"subscribe", cmd_subscribe},
     {"help", cmd_help},
     {"s", cmd_status},
     {"status", cmd_status},
@@ -322,6 +515,11 @@ static const SimpleReplCommand kCmds[] = {
     {"zcl_cmd", cmd_zcl_cmd},
     {"freeze_time", cmd_freeze_time},
     {"step_time", cmd_step_time},
+    {"replay", cmd_replay},
+    {"wave", cmd_wave},
+    {"stats", cmd_stats},
+    {"log", cmd_log},
+    {"reset", cmd_reset},
     {"q", cmd_quit},
     {"quit", cmd_quit},
 };
@@ -0,0 +1,209 @@
+#include "gpio_waveform.h"
+
+#include "base_components/button.h"
+#include "base_components/diagnostics.h"
+#include "hal/tasks.h"
+#include "machine_io.h"
+#include "stub/hal/stub.h"
+#include "stub_app.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define DEFAULT_SETTLE_MS (4 * DEBOUNCE_DELAY_MS)
+
+typedef struct {
+  hal_gpio_pin_t pin;
+  uint32_t elapsed_ms;
+  uint32_t edges;
+  uint32_t rng;
+} wave_player_t;
+
+void gpio_wave_init(gpio_wave_t *wave, gpio_wave_kind_t kind) {
+  memset(wave, 0, sizeof(*wave));
+  wave->kind = kind;
+  wave->seed = 1;
+  wave->settle_ms = DEFAULT_SETTLE_MS;
+  switch (kind) {
+  case GPIO_WAVE_BOUNCE:
+    wave->count = 4;
+    wave->spacing_us = 1000;
+    wave->jitter_us = 400;
+    break;
+  case GPIO_WAVE_GLITCH:
+    wave->width_us = 5000;
+    break;
+  case GPIO_WAVE_HUM:
+    // Half waves of 50 Hz mains
+    wave->width_us = 1000;
+    wave->period_us = 10000;
+    wave->duration_ms = 500;
+    break;
+  }
+}
+
+bool gpio_wave_parse_kind(const char *name, gpio_wave_kind_t *kind) {
+  if (strcmp(name, "bounce") == 0) {
+    *kind = GPIO_WAVE_BOUNCE;
+  } else if (strcmp(name, "glitch") == 0) {
+    *kind = GPIO_WAVE_GLITCH;
+  } else if (strcmp(name, "hum") == 0) {
+    *kind = GPIO_WAVE_HUM;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool gpio_wave_set_option(gpio_wave_t *wave, const char *option) {
+  const char *eq = strchr(option, '=');
+  if (!eq || eq[1] == '\0')
+    return false;
+  char *e = NULL;
+  unsigned long value = strtoul(eq + 1, &e, 10);
+  if (*e || value > UINT32_MAX)
+    return false;
+
+  size_t key_len = (size_t)(eq - option);
+#define KEY_IS(name)                                                           \
+  (key_len == strlen(name) && !strncmp(option, name, key_len))
+  if (KEY_IS("level")) {
+    if (value > 1)
+      return false;
+    wave->level = (uint8_t)value;
+  } else if (KEY_IS("count")) {
+    wave->count = (uint32_t)value;
+  } else if (KEY_IS("spacing_us")) {
+    wave->spacing_us = (uint32_t)value;
+  } else if (KEY_IS("jitter_us")) {
+    wave->jitter_us = (uint32_t)value;
+  } else if (KEY_IS("width_us")) {
+    wave->width_us = (uint32_t)value;
+  } else if (KEY_IS("period_us")) {
+    wave->period_us = (uint32_t)value;
+  } else if (KEY_IS("duration_ms")) {
+    wave->duration_ms = (uint32_t)value;
+  } else if (KEY_IS("seed")) {
+    wave->seed = (uint32_t)value;
+  } else if (KEY_IS("settle_ms")) {
+    wave->settle_ms = (uint32_t)value;
+  } else {
+    return false;
+  }
+#undef KEY_IS
+  return true;
+}
+
+// xorshift32, jitter only has to be repeatable
+static uint32_t next_random(wave_player_t *player) {
+  uint32_t x = player->rng;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  player->rng = x;
+  return x;
+}
+
+// base_us +- jitter_us, never shorter than 1 us
+static uint64_t jittered(wave_player_t *player, uint32_t base_us,
+                         uint32_t jitter_us) {
+  if (jitter_us == 0)
+    return base_us;
+  int64_t offset =
+      (int64_t)(next_random(player) % (2 * (uint64_t)jitter_us + 1)) -
+      jitter_us;
+  int64_t us = (int64_t)base_us + offset;
+  return us > 0 ? (uint64_t)us : 1;
+}
+
+static void edge_at(wave_player_t *player, uint64_t t_us, uint8_t level) {
+  uint32_t t_ms = (uint32_t)(t_us / 1000);
+  if (t_ms > player->elapsed_ms) {
+    stub_app_advance(t_ms - player->elapsed_ms);
+    player->elapsed_ms = t_ms;
+  }
+  stub_gpio_simulate_input(player->pin, level);
+  player->edges++;
+}
+
+static void play_bounce(wave_player_t *player, const gpio_wave_t *wave) {
+  uint64_t t_us = 0;
+  edge_at(player, t_us, wave->level);
+  for (uint32_t i = 0; i < wave->count; i++) {
+    t_us += jittered(player, wave->spacing_us, wave->jitter_us);
+    edge_at(player, t_us, !wave->level);
+    t_us += jittered(player, wave->spacing_us, wave->jitter_us);
+    edge_at(player, t_us, wave->level);
+  }
+}
+
+static void play_pulse(wave_player_t *player, uint64_t start_us,
+                       uint32_t width_us, uint8_t idle) {
+  edge_at(player, start_us, !idle);
+  edge_at(player, start_us + width_us, idle);
+}
+
+static void play_hum(wave_player_t *player, const gpio_wave_t *wave,
+                     uint8_t idle) {
+  if (wave->period_us == 0)
+    return;
+  uint64_t end_us = (uint64_t)wave->duration_ms * 1000;
+  uint64_t prev_end_us = 0;
+  for (uint64_t base_us = 0; base_us + wave->width_us <= end_us;
+       base_us += wave->period_us) {
+    uint64_t start_us = base_us;
+    if (wave->jitter_us) {
+      start_us = jittered(player, (uint32_t)base_us + wave->jitter_us,
+                          wave->jitter_us);
+    }
+    // Jitter may not reorder pulses
+    if (start_us < prev_end_us)
+      start_us = prev_end_us;
+    play_pulse(player, start_us, wave->width_us, idle);
+    prev_end_us = start_us + wave->width_us;
+  }
+}
+
+void gpio_wave_play(hal_gpio_pin_t pin, const gpio_wave_t *wave,
+                    gpio_wave_result_t *result) {
+  memset(result, 0, sizeof(*result));
+  wave_player_t player = {
+      .pin = pin,
+      .elapsed_ms = 0,
+      .edges = 0,
+      .rng = wave->seed ? wave->seed : 1,
+  };
+
+  // Waveform time is virtual, whatever the clock was doing before
+  stub_millis_freeze();
+  uint8_t start_level = stub_gpio_get_output(pin);
+  uint32_t callbacks = stub_gpio_get_callback_count();
+  uint32_t reschedules = stub_tasks_get_reschedule_count();
+  uint32_t debounced = diagnostics.button_events;
+
+  switch (wave->kind) {
+  case GPIO_WAVE_BOUNCE:
+    play_bounce(&player, wave);
+    break;
+  case GPIO_WAVE_GLITCH:
+    play_pulse(&player, 0, wave->width_us, start_level);
+    break;
+  case GPIO_WAVE_HUM:
+    play_hum(&player, wave, start_level);
+    break;
+  }
+  stub_app_advance(wave->settle_ms);
+
+  // Only a bounce to the other level is a real change, all else is noise
+  uint32_t expected =
+      wave->kind == GPIO_WAVE_BOUNCE && wave->level != start_level;
+  result->edges = player.edges;
+  result->callbacks = stub_gpio_get_callback_count() - callbacks;
+  result->reschedules = stub_tasks_get_reschedule_count() - reschedules;
+  result->debounced = diagnostics.button_events - debounced;
+  result->false_presses =
+      result->debounced > expected ? result->debounced - expected : 0;
+  result->missed = result->debounced < expected;
+  result->duration_ms = player.elapsed_ms + wave->settle_ms;
+  io_log_debug("WAVE", "Pin %d: %u edges, %u callbacks, %u debounced", pin,
+               result->edges, result->callbacks, result->debounced);
+}
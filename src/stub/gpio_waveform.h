@@ -0,0 +1,83 @@
+#ifndef GPIO_WAVEFORM_H
+#define GPIO_WAVEFORM_H
+
+#include "hal/gpio.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Synthetic input noise on a GPIO pin, played in virtual time like a trace:
+ *
+ *   bounce  the contact reaches level, then bounces away and back count
+ *           times, spacing_us +- jitter_us apart
+ *   glitch  one pulse away from the current level, width_us long
+ *   hum     mains pickup, a width_us pulse every period_us (+- jitter_us)
+ *           for duration_ms
+ *
+ * Edges inside the same millisecond are applied back to back. After the last
+ * edge the device keeps running for settle_ms, then the statistics tell how
+ * much work the debounce did and whether it got the level right.
+ */
+
+typedef enum {
+  GPIO_WAVE_BOUNCE,
+  GPIO_WAVE_GLITCH,
+  GPIO_WAVE_HUM,
+} gpio_wave_kind_t;
+
+typedef struct {
+  gpio_wave_kind_t kind;
+  uint8_t level; // bounce: settled level
+  uint32_t count;
+  uint32_t spacing_us;
+  uint32_t jitter_us;
+  uint32_t width_us;
+  uint32_t period_us;
+  uint32_t duration_ms;
+  uint32_t seed; // jitter is pseudo random, the same for the same seed
+  uint32_t settle_ms;
+} gpio_wave_t;
+
+typedef struct {
+  uint32_t edges;       // level changes applied to the pin
+  uint32_t callbacks;   // pin callback invocations
+  uint32_t reschedules; // pending tasks cancelled, e.g. debounce restarts
+  uint32_t debounced;   // debounced presses and releases
+  uint32_t false_presses; // debounced changes beyond the settled level change
+  uint32_t missed;        // settled level change that was never debounced
+  uint32_t duration_ms;   // including settle_ms
+} gpio_wave_result_t;
+
+/**
+ * Fills a waveform with the defaults of its kind
+ * @param wave Waveform to initialize
+ * @param kind Waveform kind
+ */
+void gpio_wave_init(gpio_wave_t *wave, gpio_wave_kind_t kind);
+
+/**
+ * Parses a waveform kind
+ * @param name "bounce", "glitch" or "hum"
+ * @param kind Receives the kind
+ * @return true if the name is known
+ */
+bool gpio_wave_parse_kind(const char *name, gpio_wave_kind_t *kind);
+
+/**
+ * Sets one waveform parameter from a key=value option, e.g. "count=8"
+ * @param wave Waveform to change
+ * @param option Option text, keys are the gpio_wave_t field names
+ * @return true for a known key with a valid value
+ */
+bool gpio_wave_set_option(gpio_wave_t *wave, const char *option);
+
+/**
+ * Plays a waveform on an input pin, starting at the current device time
+ * @param pin Input pin
+ * @param wave Waveform to play
+ * @param result Filled with the statistics of the run
+ */
+void gpio_wave_play(hal_gpio_pin_t pin, const gpio_wave_t *wave,
+                    gpio_wave_result_t *result);
+
+#endif
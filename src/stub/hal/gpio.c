@@ -19,6 +19,9 @@ typedef struct {
 
 static stub_gpio_pin_t gpio_pins[MAX_GPIO_PINS];
 
+// Pin callback invocations since the last stub_gpio_reset_callback_count()
+static uint32_t callback_count = 0;
+
 void ensure_valid_input_pin(hal_gpio_pin_t gpio_pin);
 void ensure_valid_output_pin(hal_gpio_pin_t gpio_pin);
 
@@ -34,15 +37,15 @@ void hal_gpio_init(hal_gpio_pin_t gpio_pin, uint8_t is_input,
   gpio_pins[gpio_pin].callback = NULL;
   gpio_pins[gpio_pin].callback_arg = NULL;
 
-  io_log("GPIO", "Init pin %d as %s, pull=%d", gpio_pin,
-         is_input ? "input" : "output", pull);
+  io_log_debug("GPIO", "Init pin %d as %s, pull=%d", gpio_pin,
+               is_input ? "input" : "output", pull);
 }
 
 void hal_gpio_set(hal_gpio_pin_t gpio_pin) {
   ensure_valid_output_pin(gpio_pin);
 
   gpio_pins[gpio_pin].value = 1;
-  io_log("GPIO", "Set pin %d = 1", gpio_pin);
+  io_log_debug("GPIO", "Set pin %d = 1", gpio_pin);
   io_evt("gpio pin=%d value=%d", gpio_pin, 1);
 }
 
@@ -50,14 +53,14 @@ void hal_gpio_clear(hal_gpio_pin_t gpio_pin) {
   ensure_valid_output_pin(gpio_pin);
 
   gpio_pins[gpio_pin].value = 0;
-  io_log("GPIO", "Clear pin %d = 0", gpio_pin);
+  io_log_debug("GPIO", "Clear pin %d = 0", gpio_pin);
   io_evt("gpio pin=%d value=%d", gpio_pin, 0);
 }
 
 uint8_t hal_gpio_read(hal_gpio_pin_t gpio_pin) {
   ensure_valid_input_pin(gpio_pin);
 
-  io_log("GPIO", "Read pin %d = %d", gpio_pin, gpio_pins[gpio_pin].value);
+  io_log_trace("GPIO", "Read pin %d = %d", gpio_pin, gpio_pins[gpio_pin].value);
   return gpio_pins[gpio_pin].value;
 }
 
@@ -67,7 +70,7 @@ void hal_gpio_callback(hal_gpio_pin_t gpio_pin, gpio_callback_t callback,
 
   gpio_pins[gpio_pin].callback = callback;
   gpio_pins[gpio_pin].callback_arg = arg;
-  io_log("GPIO", "Set callback for pin %d", gpio_pin);
+  io_log_debug("GPIO", "Set callback for pin %d", gpio_pin);
 }
 
 void hal_gpio_unreg_callback(hal_gpio_pin_t gpio_pin) {
@@ -75,18 +78,18 @@ void hal_gpio_unreg_callback(hal_gpio_pin_t gpio_pin) {
 
   gpio_pins[gpio_pin].callback = NULL;
   gpio_pins[gpio_pin].callback_arg = NULL;
-  io_log("GPIO", "Unregistered callback for pin %d", gpio_pin);
+  io_log_debug("GPIO", "Unregistered callback for pin %d", gpio_pin);
 }
 
 hal_gpio_pin_t hal_gpio_parse_pin(const char *s) {
   if (!s) {
-    io_log("GPIO", "Error: NULL string passed to hal_parse_gpio_pin");
+    io_log_error("GPIO", "Error: NULL string passed to hal_parse_gpio_pin");
     return HAL_INVALID_PIN;
   }
 
   // Simple parsing: expect format like "PA5" or "PB10"
   if (strlen(s) < 2) {
-    io_log("GPIO", "Error: Invalid GPIO pin format: '%s'", s);
+    io_log_error("GPIO", "Error: Invalid GPIO pin format: '%s'", s);
     return HAL_INVALID_PIN;
   }
 
@@ -94,18 +97,18 @@ hal_gpio_pin_t hal_gpio_parse_pin(const char *s) {
   int pin = atoi(&s[1]);
 
   if (port < 'A' || port > 'Z' || pin < 0 || pin > 15) {
-    io_log("GPIO", "Error: Invalid GPIO pin format: '%s'", s);
+    io_log_error("GPIO", "Error: Invalid GPIO pin format: '%s'", s);
     return HAL_INVALID_PIN;
   }
 
   hal_gpio_pin_t res = ((port - 'A') << 4) | pin;
-  io_log("GPIO", "Parsed GPIO pin '%s' as %d", s, res);
+  io_log_trace("GPIO", "Parsed GPIO pin '%s' as %d", s, res);
   return res;
 }
 
 hal_gpio_pull_t hal_gpio_parse_pull(const char *pull_str) {
   if (!pull_str) {
-    io_log("GPIO", "Error: NULL string passed to hal_parse_gpio_pull");
+    io_log_error("GPIO", "Error: NULL string passed to hal_parse_gpio_pull");
     return HAL_GPIO_PULL_INVALID;
   }
 
@@ -115,7 +118,7 @@ hal_gpio_pull_t hal_gpio_parse_pull(const char *pull_str) {
     return HAL_GPIO_PULL_UP;
   if (strcmp(pull_str, "d") == 0)
     return HAL_GPIO_PULL_DOWN;
-  io_log("GPIO", "Error: Invalid GPIO pull string: '%s'", pull_str);
+  io_log_error("GPIO", "Error: Invalid GPIO pull string: '%s'", pull_str);
   return HAL_GPIO_PULL_INVALID;
 }
 
@@ -123,7 +126,8 @@ hal_gpio_pull_t hal_gpio_parse_pull(const char *pull_str) {
 
 void stub_gpio_simulate_input(hal_gpio_pin_t gpio_pin, uint8_t value) {
   if (gpio_pin >= MAX_GPIO_PINS) {
-    io_log("GPIO", "Error: Invalid input pin %d for simulation", gpio_pin);
+    io_log_error("GPIO", "Error: Invalid input pin %d for simulation",
+                 gpio_pin);
     return;
   }
 
@@ -131,29 +135,40 @@ void stub_gpio_simulate_input(hal_gpio_pin_t gpio_pin, uint8_t value) {
   gpio_pins[gpio_pin].value = value;
 
   if (old_value != value && gpio_pins[gpio_pin].callback) {
+    callback_count++;
     gpio_pins[gpio_pin].callback(gpio_pin, gpio_pins[gpio_pin].callback_arg);
   }
 
-  io_log("GPIO", "Simulated input pin %d = %d", gpio_pin, value);
+  io_log_trace("GPIO", "Simulated input pin %d = %d", gpio_pin, value);
 }
 
 uint8_t stub_gpio_get_output(hal_gpio_pin_t gpio_pin) {
   if (gpio_pin >= MAX_GPIO_PINS) {
-    io_log("GPIO", "Error: Invalid GPIO pin %d for output", gpio_pin);
+    io_log_error("GPIO", "Error: Invalid GPIO pin %d for output", gpio_pin);
     return 0;
   }
   return gpio_pins[gpio_pin].value;
 }
 
+uint32_t stub_gpio_get_callback_count(void) { return callback_count; }
+
+void stub_gpio_reset_callback_count(void) { callback_count = 0; }
+
+void stub_gpio_reset(void) {
+  memset(gpio_pins, 0, sizeof(gpio_pins));
+  callback_count = 0;
+  io_log("GPIO", "Reset all pins");
+}
+
 // Helper funcs
 
 void ensure_valid_pin(hal_gpio_pin_t gpio_pin) {
   if (gpio_pin >= MAX_GPIO_PINS) {
-    io_log("GPIO", "Error: GPIO pin %d out of range", gpio_pin);
+    io_log_error("GPIO", "Error: GPIO pin %d out of range", gpio_pin);
     exit(1);
   }
   if (!gpio_pins[gpio_pin].initialized) {
-    io_log("GPIO", "Error: GPIO pin %d not initialized", gpio_pin);
+    io_log_error("GPIO", "Error: GPIO pin %d not initialized", gpio_pin);
     exit(1);
   }
 }
@@ -162,8 +177,8 @@ void ensure_valid_input_pin(hal_gpio_pin_t gpio_pin) {
 
   ensure_valid_pin(gpio_pin);
   if (!gpio_pins[gpio_pin].is_input) {
-    io_log("GPIO", "Error: Attempt to use output GPIO pin %d as input",
-           gpio_pin);
+    io_log_error("GPIO", "Error: Attempt to use output GPIO pin %d as input",
+                 gpio_pin);
     exit(1);
   }
 }
@@ -171,8 +186,8 @@ void ensure_valid_input_pin(hal_gpio_pin_t gpio_pin) {
 void ensure_valid_output_pin(hal_gpio_pin_t gpio_pin) {
   ensure_valid_pin(gpio_pin);
   if (gpio_pins[gpio_pin].is_input) {
-    io_log("GPIO", "Error: Attempt to use input GPIO pin %d as output",
-           gpio_pin);
+    io_log_error("GPIO", "Error: Attempt to use input GPIO pin %d as output",
+                 gpio_pin);
     exit(1);
   }
 }
@@ -11,35 +11,40 @@
 #define MAX_NVM_ITEMS 256
 #define NVM_DATA_DIR "./stub_nvm_data"
 
+static char nvm_data_dir[256] = NVM_DATA_DIR;
+static uint32_t write_count = 0;
+
 static void ensure_nvm_dir(void) {
   struct stat st = {0};
-  if (stat(NVM_DATA_DIR, &st) == -1) {
-    if (mkdir(NVM_DATA_DIR, 0700) != 0) {
-      io_log("NVM", "Error: Failed to create NVM directory: %s", NVM_DATA_DIR);
+  if (stat(nvm_data_dir, &st) == -1) {
+    if (mkdir(nvm_data_dir, 0700) != 0) {
+      io_log_error("NVM", "Error: Failed to create NVM directory: %s",
+                   nvm_data_dir);
       exit(1);
     }
-    io_log("NVM", "Created NVM directory: %s", NVM_DATA_DIR);
+    io_log("NVM", "Created NVM directory: %s", nvm_data_dir);
   }
 }
 
 static char *get_item_filename(uint8_t item_id) {
-  static char filename[256];
-  snprintf(filename, sizeof(filename), "%s/item_%02x.bin", NVM_DATA_DIR,
+  static char filename[sizeof(nvm_data_dir) + 16];
+  snprintf(filename, sizeof(filename), "%s/item_%02x.bin", nvm_data_dir,
            item_id);
   return filename;
 }
 
 hal_nvm_status_t hal_nvm_write(uint8_t item_id, uint16_t size, uint8_t *data) {
   if (!data) {
-    io_log("NVM",
-           "Error: NULL data pointer passed to hal_nvm_write for item %02x",
-           item_id);
+    io_log_error(
+        "NVM", "Error: NULL data pointer passed to hal_nvm_write for item %02x",
+        item_id);
     return HAL_NVM_ERROR;
   }
 
   if (size == 0) {
-    io_log("NVM", "Error: Zero size passed to hal_nvm_write for item %02x",
-           item_id);
+    io_log_error("NVM",
+                 "Error: Zero size passed to hal_nvm_write for item %02x",
+                 item_id);
     return HAL_NVM_ERROR;
   }
 
@@ -48,7 +53,7 @@ hal_nvm_status_t hal_nvm_write(uint8_t item_id, uint16_t size, uint8_t *data) {
   char *filename = get_item_filename(item_id);
   FILE *file = fopen(filename, "wb");
   if (!file) {
-    io_log("NVM", "Failed to open file for writing: %s", filename);
+    io_log_error("NVM", "Failed to open file for writing: %s", filename);
     return HAL_NVM_ERROR;
   }
 
@@ -56,11 +61,13 @@ hal_nvm_status_t hal_nvm_write(uint8_t item_id, uint16_t size, uint8_t *data) {
   fclose(file);
 
   if (written != size) {
-    io_log("NVM", "Failed to write all data for item %02x", item_id);
+    io_log_error("NVM", "Failed to write all data for item %02x", item_id);
     return HAL_NVM_ERROR;
   }
 
-  io_log("NVM", "Wrote %d bytes to item %02x", size, item_id);
+  write_count++;
+  io_log_debug("NVM", "Wrote %d bytes to item %02x", size, item_id);
+  io_evt("nvm_write item=0x%02X size=%u", item_id, size);
   return HAL_NVM_SUCCESS;
 }
 
@@ -71,7 +78,7 @@ hal_nvm_status_t hal_nvm_read(uint8_t item_id, uint16_t size, uint8_t *data) {
   char *filename = get_item_filename(item_id);
   FILE *file = fopen(filename, "rb");
   if (!file) {
-    io_log("NVM", "Item %02x not found", item_id);
+    io_log_debug("NVM", "Item %02x not found", item_id);
     return HAL_NVM_NOT_FOUND;
   }
 
@@ -79,12 +86,28 @@ hal_nvm_status_t hal_nvm_read(uint8_t item_id, uint16_t size, uint8_t *data) {
   fclose(file);
 
   if (read_bytes != size) {
-    io_log("NVM", "Read %zu bytes instead of %d for item %02x", read_bytes,
-           size, item_id);
+    io_log_warn("NVM", "Read %zu bytes instead of %d for item %02x", read_bytes,
+                size, item_id);
+    return HAL_NVM_ERROR;
+  }
+
+  io_log_trace("NVM", "Read %d bytes from item %02x", size, item_id);
+  return HAL_NVM_SUCCESS;
+}
+
+hal_nvm_status_t hal_nvm_get_size(uint8_t item_id, uint16_t *size) {
+  if (!size)
     return HAL_NVM_ERROR;
+
+  struct stat st;
+  char *filename = get_item_filename(item_id);
+  if (stat(filename, &st) != 0) {
+    io_log_debug("NVM", "Item %02x not found", item_id);
+    return HAL_NVM_NOT_FOUND;
   }
 
-  io_log("NVM", "Read %d bytes from item %02x", size, item_id);
+  *size = (uint16_t)st.st_size;
+  io_log_trace("NVM", "Item %02x has %d bytes", item_id, *size);
   return HAL_NVM_SUCCESS;
 }
 
@@ -94,15 +117,15 @@ hal_nvm_status_t hal_nvm_delete(uint8_t item_id) {
   if (unlink(filename) != 0) {
     // Check if the error is because the file doesn't exist
     if (errno == ENOENT) {
-      io_log("NVM", "Item %02x not found for deletion", item_id);
+      io_log_debug("NVM", "Item %02x not found for deletion", item_id);
       return HAL_NVM_NOT_FOUND;
     } else {
-      io_log("NVM", "Failed to delete item %02x", item_id);
+      io_log_error("NVM", "Failed to delete item %02x", item_id);
       return HAL_NVM_ERROR;
     }
   }
 
-  io_log("NVM", "Deleted item %02x", item_id);
+  io_log_debug("NVM", "Deleted item %02x", item_id);
   return HAL_NVM_SUCCESS;
 }
 
@@ -111,10 +134,10 @@ hal_nvm_status_t hal_nvm_clear_all() {
 
   // Remove all files in the NVM directory
   char command[512];
-  snprintf(command, sizeof(command), "rm -f %s/*", NVM_DATA_DIR);
+  snprintf(command, sizeof(command), "rm -f %s/*", nvm_data_dir);
 
   if (system(command) != 0) {
-    io_log("NVM", "Failed to clear all NVM items");
+    io_log_error("NVM", "Failed to clear all NVM items");
     return HAL_NVM_ERROR;
   }
 
@@ -123,9 +146,15 @@ hal_nvm_status_t hal_nvm_clear_all() {
 }
 
 void stub_nvm_set_data_dir(const char *dir) {
-  // For testing, allow changing the data directory
-  // This is not thread-safe but sufficient for testing
-  static char custom_dir[256];
-  strncpy(custom_dir, dir, sizeof(custom_dir) - 1);
-  custom_dir[sizeof(custom_dir) - 1] = '\0';
-}
\ No newline at end of file
+  // Lets several stub instances run side by side, each with its own storage
+  if (!dir) {
+    dir = NVM_DATA_DIR;
+  }
+  strncpy(nvm_data_dir, dir, sizeof(nvm_data_dir) - 1);
+  nvm_data_dir[sizeof(nvm_data_dir) - 1] = '\0';
+  io_log("NVM", "Using NVM directory: %s", nvm_data_dir);
+}
+
+uint32_t stub_nvm_get_write_count(void) { return write_count; }
+
+void stub_nvm_reset_write_count(void) { write_count = 0; }
@@ -1,5 +1,11 @@
 #include "hal/zigbee.h"
+#include "hal/tasks.h"
 #include "hal/zigbee_ota.h"
+#include "stub/hal/stub.h"
+#include "stub/machine_io.h"
+#include "zigbee/ota_image.h"
+#include <stdlib.h>
+#include <string.h>
 
 // ZCL data type constants for stub build
 #define ZCL_IEEE_ADDRESS_ATTRIBUTE_TYPE 0xF0
@@ -7,6 +13,24 @@
 #define ZCL_ENUM8_ATTRIBUTE_TYPE 0x30
 #define ZCL_OTA_BOOTLOAD_CLUSTER_ID 0x19
 
+// Image upgrade status attribute values
+#define OTA_STATUS_NORMAL 0
+#define OTA_STATUS_DOWNLOAD_IN_PROGRESS 1
+#define OTA_STATUS_DOWNLOAD_COMPLETE 2
+
+// Same as the 0x40000 slot of Telink
+#define STUB_OTA_SLOT_SIZE 0x40000
+
+// Z2M sends 50 byte blocks by default
+#define STUB_OTA_BLOCK_SIZE 50
+#define STUB_OTA_BLOCK_INTERVAL_MS 10
+
+#define OTA_FILE_MAGIC 0x0BEEF11E
+#define OTA_FILE_MANUFACTURER_OFFSET 10
+#define OTA_FILE_IMAGE_TYPE_OFFSET 12
+#define OTA_FILE_VERSION_OFFSET 14
+#define OTA_UPGRADE_IMAGE_TAG 0x0000
+
 static struct OtaData {
   uint64_t upgrade_server_id;
   uint32_t offset;
@@ -31,6 +55,257 @@ hal_zigbee_attribute attrs[] = {
      .flag = ATTR_WRITABLE},
 };
 
+// Flash of the slot, it survives resets like the real one
+static uint8_t slot[STUB_OTA_SLOT_SIZE];
+static bool slot_initialized = false;
+
+// File offered by the simulated server, kept over resets
+static uint8_t *served_file = NULL;
+static uint32_t served_len = 0;
+static hal_ota_image_id_t served_id;
+static uint32_t image_start; // File offset of the upgrade image payload
+static uint32_t image_len;
+
+// Partial download of a plain image, kept over resets like the Silabs client
+// keeps it. Offsets are relative to the upgrade image, the part in the slot.
+static struct {
+  bool valid;
+  hal_ota_image_id_t id;
+  uint32_t offset;
+} partial;
+
+// Firmware the device runs, kept over resets
+static uint8_t *running_image = NULL;
+static uint32_t running_len = 0;
+
+// Simulated OTA client, downloading the offered file like the SDK
+static hal_task_t block_task;
+static bool decompressing = false;
+static bool starting = false; // First block not requested yet
+
+static uint32_t read_le(const uint8_t *p, uint8_t size) {
+  uint32_t value = 0;
+  for (uint8_t i = 0; i < size; i++)
+    value |= (uint32_t)p[i] << (8 * i);
+  return value;
+}
+
+static void init_slot(void) {
+  if (slot_initialized)
+    return;
+  memset(slot, 0xff, sizeof(slot));
+  slot_initialized = true;
+}
+
+uint32_t hal_ota_slot_size(void) { return STUB_OTA_SLOT_SIZE; }
+
+void hal_ota_slot_erase_sector(uint32_t offset) {
+  init_slot();
+  offset -= offset % HAL_OTA_SLOT_SECTOR_SIZE;
+  if (offset < STUB_OTA_SLOT_SIZE)
+    memset(slot + offset, 0xff, HAL_OTA_SLOT_SECTOR_SIZE);
+}
+
+void hal_ota_slot_write(uint32_t offset, const uint8_t *data, uint32_t len) {
+  init_slot();
+  if (offset > STUB_OTA_SLOT_SIZE || len > STUB_OTA_SLOT_SIZE - offset) {
+    io_log_error("OTA", "Slot write out of range: %u+%u", offset, len);
+    return;
+  }
+  // NOR flash only clears bits, a missing erase shows up as corrupt data
+  for (uint32_t i = 0; i < len; i++)
+    slot[offset + i] &= data[i];
+}
+
+void hal_ota_slot_read(uint32_t offset, uint8_t *data, uint32_t len) {
+  init_slot();
+  if (offset > STUB_OTA_SLOT_SIZE || len > STUB_OTA_SLOT_SIZE - offset) {
+    memset(data, 0xff, len);
+    return;
+  }
+  memcpy(data, slot + offset, len);
+}
+
+void hal_ota_running_read(uint32_t offset, uint8_t *data, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++)
+    data[i] = offset + i < running_len ? running_image[offset + i] : 0xff;
+}
+
+// What the SDK does with a plain image: erase for its size, then copy
+static void write_plain(uint32_t offset, const uint8_t *data, uint32_t len) {
+  if (offset == 0) {
+    for (uint32_t s = 0; s < image_len; s += HAL_OTA_SLOT_SECTOR_SIZE)
+      hal_ota_slot_erase_sector(s);
+  }
+  hal_ota_slot_write(offset, data, len);
+  partial.offset = offset + len;
+}
+
+static void write_image(uint32_t offset, const uint8_t *data, uint32_t len) {
+  if (offset == 0) {
+    decompressing = ota_image_is_compressed(data, len);
+    if (decompressing)
+      ota_image_begin();
+  }
+  if (decompressing)
+    ota_image_write(offset, data, len);
+  else
+    write_plain(offset, data, len);
+}
+
+static void complete(void) {
+  bool ok = !decompressing || ota_image_state() == OTA_IMAGE_DONE;
+  uint32_t size = decompressing ? ota_image_output_size() : image_len;
+  ota_data.status = ok ? OTA_STATUS_DOWNLOAD_COMPLETE : OTA_STATUS_NORMAL;
+  partial.valid = false;
+  io_log("OTA", "Download %s, %u bytes in the slot", ok ? "done" : "failed",
+         size);
+  io_evt("ota_complete status=%d size=%u", ok ? 0 : 1, size);
+}
+
+static bool same_image(const hal_ota_image_id_t *a,
+                       const hal_ota_image_id_t *b) {
+  return a->manufacturer_code == b->manufacturer_code &&
+         a->image_type == b->image_type && a->file_version == b->file_version;
+}
+
+// Continues the partial download of the same image, drops any other one
+static void begin_download(void) {
+  bool plain = !ota_image_is_compressed(served_file + image_start, image_len);
+  if (partial.valid && plain && same_image(&partial.id, &served_id)) {
+    ota_data.offset = image_start + partial.offset;
+    io_log("OTA", "Resuming download at %u", partial.offset);
+    return;
+  }
+  // Compressed images always start over, the decoder state is not kept
+  partial.valid = plain;
+  partial.id = served_id;
+  partial.offset = 0;
+}
+
+static void block_handler(void *arg) {
+  (void)arg;
+  if (!served_file)
+    return;
+  // Blocks only come over the network
+  if (hal_zigbee_get_network_status() != HAL_ZIGBEE_NETWORK_JOINED) {
+    hal_tasks_schedule(&block_task, STUB_OTA_BLOCK_INTERVAL_MS);
+    return;
+  }
+  if (starting) {
+    starting = false;
+    begin_download();
+  }
+
+  uint32_t start = ota_data.offset;
+  uint32_t end = start + STUB_OTA_BLOCK_SIZE;
+  if (end > served_len)
+    end = served_len;
+  ota_data.status = OTA_STATUS_DOWNLOAD_IN_PROGRESS;
+
+  // Only the upgrade image reaches the slot, headers are parsed by the SDK
+  uint32_t from = start > image_start ? start : image_start;
+  uint32_t to = end < image_start + image_len ? end : image_start + image_len;
+  if (from < to)
+    write_image(from - image_start, served_file + from, to - from);
+
+  ota_data.offset = end;
+  if (end < served_len) {
+    hal_tasks_schedule(&block_task, STUB_OTA_BLOCK_INTERVAL_MS);
+    return;
+  }
+  complete();
+  stub_ota_serve(NULL, 0); // The server is done with this device
+}
+
+static void start_download(void) {
+  ota_data.offset = 0;
+  ota_data.status = OTA_STATUS_NORMAL;
+  decompressing = false;
+  hal_tasks_unschedule(&block_task);
+  if (!served_file)
+    return;
+  // Decided on the first block, once the app had its look at the partial
+  starting = true;
+  block_task.handler = block_handler;
+  block_task.arg = NULL;
+  hal_tasks_init(&block_task);
+  hal_tasks_schedule(&block_task, STUB_OTA_BLOCK_INTERVAL_MS);
+}
+
+// Finds the upgrade image sub-element
+static bool parse_file(const uint8_t *file, uint32_t len) {
+  if (len < 56 || read_le(file, 4) != OTA_FILE_MAGIC)
+    return false;
+  uint32_t pos = read_le(file + 6, 2);
+  while (pos + 6 <= len) {
+    uint16_t tag = read_le(file + pos, 2);
+    uint32_t element_len = read_le(file + pos + 2, 4);
+    pos += 6;
+    if (element_len > len - pos)
+      return false;
+    if (tag == OTA_UPGRADE_IMAGE_TAG) {
+      image_start = pos;
+      image_len = element_len;
+      return true;
+    }
+    pos += element_len;
+  }
+  return false;
+}
+
+bool stub_ota_serve(const uint8_t *file, uint32_t len) {
+  free(served_file);
+  served_file = NULL;
+  served_len = 0;
+  if (!file)
+    return true;
+  if (!parse_file(file, len))
+    return false;
+  served_id.manufacturer_code = read_le(file + OTA_FILE_MANUFACTURER_OFFSET, 2);
+  served_id.image_type = read_le(file + OTA_FILE_IMAGE_TYPE_OFFSET, 2);
+  served_id.file_version = read_le(file + OTA_FILE_VERSION_OFFSET, 4);
+  served_file = malloc(len);
+  memcpy(served_file, file, len);
+  served_len = len;
+  start_download();
+  return true;
+}
+
+void stub_ota_set_running_image(const uint8_t *image, uint32_t len) {
+  free(running_image);
+  running_image = NULL;
+  running_len = 0;
+  if (!image)
+    return;
+  running_image = malloc(len);
+  memcpy(running_image, image, len);
+  running_len = len;
+}
+
+void stub_ota_reset(void) {
+  memset(&ota_data, 0, sizeof(ota_data));
+  decompressing = false;
+  starting = false;
+}
+
+bool hal_ota_partial_get(hal_ota_image_id_t *id, uint32_t *offset) {
+  if (!partial.valid)
+    return false;
+  *id = partial.id;
+  *offset = partial.offset;
+  return true;
+}
+
+void hal_ota_partial_read(uint32_t offset, uint8_t *data, uint32_t len) {
+  hal_ota_slot_read(offset, data, len);
+}
+
+void hal_ota_partial_clear(void) {
+  partial.valid = false;
+  hal_ota_slot_erase_sector(0);
+}
+
 void hal_ota_cluster_setup(hal_zigbee_cluster *cluster) {
   if (cluster == NULL) {
     return;
@@ -43,9 +318,10 @@ void hal_ota_cluster_setup(hal_zigbee_cluster *cluster) {
 }
 
 void hal_zigbee_init_ota() {
-  // Stub implementation - no initialization needed
+  // An offer still standing is downloaded again from the start
+  start_download();
 }
 
 void hal_zigbee_set_image_type(uint16_t image_type) {
   // Stub implementation - image type setting not supported
-}
\ No newline at end of file
+}
@@ -3,26 +3,47 @@
 
 #include "hal/gpio.h"
 #include "hal/zigbee.h"
+#include <setjmp.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 // GPIO stub functions
 void stub_gpio_enable_debug(int enable);
 void stub_gpio_simulate_input(hal_gpio_pin_t gpio_pin, uint8_t value);
 uint8_t stub_gpio_get_output(hal_gpio_pin_t gpio_pin);
+void stub_gpio_reset(void);
+uint32_t stub_gpio_get_callback_count(void);
+void stub_gpio_reset_callback_count(void);
 
 // Tasks stub functions
 void stub_tasks_poll(void);
+void stub_tasks_reset(void);
+void stub_tasks_get_usage(uint8_t *active, uint8_t *peak,
+                          uint8_t *peak_timers);
+void stub_tasks_reset_peak(void); // Also resets the reschedule count
+uint32_t stub_tasks_get_reschedule_count(void);
 
 // NVM stub functions
 void stub_nvm_enable_debug(int enable);
-void stub_nvm_set_data_dir(const char *dir);
+void stub_nvm_set_data_dir(const char *dir); // NULL for the default
+uint32_t stub_nvm_get_write_count(void);
+void stub_nvm_reset_write_count(void);
 
 // Zigbee stub functions
 void stub_zigbee_enable_debug(int enable);
 void stub_zigbee_set_network_status(hal_zigbee_network_status_t status);
+void stub_zigbee_set_ieee_address(uint64_t addr); // Seen from the next boot
 void stub_zigbee_add_binding(uint16_t short_addr, uint8_t endpoint,
                              uint16_t cluster_id);
 void stub_zigbee_clear_bindings(void);
+// Channel of the simulated coordinator, 0 turns it off
+void stub_zigbee_set_coordinator_channel(uint8_t channel);
+// Sends to bindings fail with HAL_ZIGBEE_ERR_SEND_FAILED while set, as with
+// a full APS queue
+void stub_zigbee_set_send_fail(bool fail);
+// The commissioned network survives if keep_network, as it does a power
+// cycle on hardware
+void stub_zigbee_reset(bool keep_network);
 hal_zigbee_endpoint *stub_zigbee_get_endpoints(uint8_t *count);
 hal_zigbee_cmd_result_t stub_zigbee_simulate_command(uint8_t endpoint,
                                                      uint16_t cluster_id,
@@ -36,5 +57,23 @@ void stub_millis_init();
 void stub_millis_freeze();
 void stub_millis_unfreeze();
 void stub_millis_step(uint64_t step);
+void stub_millis_reset(bool frozen);
+
+// System stub functions
+// hal_system_reset() longjmps to target instead of exiting, NULL to exit
+void stub_system_set_reset_target(jmp_buf *target);
+// Called on every device reset, the reset reason is software if the firmware
+// asked for it since the last one, power on otherwise
+void stub_system_reset(void);
+
+// OTA stub functions
+void stub_ota_reset(void);
+// Offers an OTA file from the simulated server, the client downloads it from
+// the next boot or right away. NULL withdraws the offer. Returns false if the
+// file has no upgrade image.
+bool stub_ota_serve(const uint8_t *file, uint32_t len);
+// Sets the firmware the device runs, the base of delta images. Reads past it
+// return erased flash. NULL clears it.
+void stub_ota_set_running_image(const uint8_t *image, uint32_t len);
 
 #endif // _HAL_STUB_H_
\ No newline at end of file
@@ -1,10 +1,33 @@
 #include "hal/system.h"
 #include "hal/zigbee.h"
+#include "stub/hal/stub.h"
 #include "stub/machine_io.h"
+#include <setjmp.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+static jmp_buf *reset_target = NULL;
+static bool reset_requested = false;
+static hal_reset_reason_t reset_reason = HAL_RESET_REASON_POWER_ON;
+
+void stub_system_set_reset_target(jmp_buf *target) { reset_target = target; }
+
+void stub_system_reset(void) {
+  reset_reason =
+      reset_requested ? HAL_RESET_REASON_SOFTWARE : HAL_RESET_REASON_POWER_ON;
+  reset_requested = false;
+}
+
+hal_reset_reason_t hal_system_get_reset_reason(void) { return reset_reason; }
+
 void hal_system_reset(void) {
+  reset_requested = true;
+  if (reset_target) {
+    // Embedded in a host process, unwind to it instead of exiting
+    io_log("SYSTEM", "System reset requested - returning to host");
+    longjmp(*reset_target, 1);
+  }
   io_log("SYSTEM",
          "System reset requested - performing graceful stub shutdown");
   io_log("SYSTEM",
@@ -1,4 +1,5 @@
 #include "hal/tasks.h"
+#include "base_components/diagnostics.h"
 #include "hal/timer.h"
 #include "stub/machine_io.h"
 #include <pthread.h>
@@ -17,6 +18,58 @@ typedef struct {
 
 static stub_task_entry_t tasks[MAX_TASKS];
 
+// Usage statistics, peaks since the last stub_tasks_reset_peak()
+static uint8_t tasks_peak = 0;
+static uint8_t timers_peak = 0;
+// Pending tasks cancelled by hal_tasks_unschedule(), mostly to be scheduled
+// again, like the button debounce restarting on every edge
+static uint32_t reschedule_count = 0;
+
+static void update_peaks(void) {
+  uint32_t now = hal_millis();
+  uint8_t active = 0;
+  uint8_t timers = 0;
+  for (int i = 0; i < MAX_TASKS; i++) {
+    if (tasks[i].active) {
+      active++;
+      timers += tasks[i].scheduled_time > now;
+    }
+  }
+  diagnostics_tasks_scheduled(active);
+  if (active > tasks_peak)
+    tasks_peak = active;
+  if (timers > timers_peak)
+    timers_peak = timers;
+}
+
+void stub_tasks_get_usage(uint8_t *active, uint8_t *peak,
+                          uint8_t *peak_timers) {
+  uint8_t count = 0;
+  for (int i = 0; i < MAX_TASKS; i++) {
+    count += tasks[i].active;
+  }
+  *active = count;
+  *peak = tasks_peak;
+  *peak_timers = timers_peak;
+}
+
+uint32_t stub_tasks_get_reschedule_count(void) { return reschedule_count; }
+
+void stub_tasks_reset_peak(void) {
+  tasks_peak = 0;
+  timers_peak = 0;
+  reschedule_count = 0;
+  update_peaks();
+}
+
+void stub_tasks_reset(void) {
+  memset(tasks, 0, sizeof(tasks));
+  tasks_peak = 0;
+  timers_peak = 0;
+  reschedule_count = 0;
+  io_log("TASKS", "Cleared all task slots");
+}
+
 void stub_tasks_poll(void) {
   uint32_t current_time = hal_millis();
   int tasks_executed = 0;
@@ -28,13 +81,13 @@ void stub_tasks_poll(void) {
     for (int i = 0; i < MAX_TASKS; i++) {
       if (tasks[i].active && current_time >= tasks[i].scheduled_time) {
         if (tasks[i].task && tasks[i].task->handler) {
-          io_log("TASKS", "Executing task %p from slot %d",
-                 (void *)tasks[i].task, i);
+          io_log_trace("TASKS", "Executing task %p from slot %d",
+                       (void *)tasks[i].task, i);
           tasks[i].task->handler(tasks[i].task->arg);
           tasks_executed++;
         }
         tasks[i].active = 0;
-        io_log("TASKS", "Task completed and removed from slot %d", i);
+        io_log_trace("TASKS", "Task completed and removed from slot %d", i);
       }
     }
   } while (tasks_executed > 0);
@@ -42,22 +95,23 @@ void stub_tasks_poll(void) {
 
 void hal_tasks_init(hal_task_t *task) {
   if (!task) {
-    io_log("TASKS", "Error: NULL task pointer passed to hal_init_task");
+    io_log_error("TASKS", "Error: NULL task pointer passed to hal_init_task");
     exit(1);
   }
 
   memset(&task->platform_struct, 0, sizeof(task->platform_struct));
-  io_log("TASKS", "Initialized task at %p", (void *)task);
+  io_log_trace("TASKS", "Initialized task at %p", (void *)task);
 }
 
 void hal_tasks_schedule(hal_task_t *task, uint32_t delay_ms) {
   if (!task) {
-    io_log("TASKS", "Error: NULL task pointer passed to hal_schedule_task");
+    io_log_error("TASKS",
+                 "Error: NULL task pointer passed to hal_schedule_task");
     exit(1);
   }
 
   if (!task->handler) {
-    io_log("TASKS", "Error: Task at %p has NULL handler", (void *)task);
+    io_log_error("TASKS", "Error: Task at %p has NULL handler", (void *)task);
     exit(1);
   }
 
@@ -71,17 +125,19 @@ void hal_tasks_schedule(hal_task_t *task, uint32_t delay_ms) {
   }
 
   if (slot == -1) {
-    io_log("TASKS", "Error: No free task slots available (max %d tasks)",
-           MAX_TASKS);
+    io_log_error("TASKS", "Error: No free task slots available (max %d tasks)",
+                 MAX_TASKS);
     exit(1);
   }
 
   tasks[slot].task = task;
   tasks[slot].scheduled_time = hal_millis() + delay_ms;
   tasks[slot].active = 1;
+  update_peaks();
 
-  io_log("TASKS", "Scheduled task %p in slot %d, delay=%u ms, execute_at=%u",
-         (void *)task, slot, delay_ms, tasks[slot].scheduled_time);
+  io_log_trace("TASKS",
+               "Scheduled task %p in slot %d, delay=%u ms, execute_at=%u",
+               (void *)task, slot, delay_ms, tasks[slot].scheduled_time);
 }
 
 void hal_tasks_unschedule(hal_task_t *task) {
@@ -91,7 +147,9 @@ void hal_tasks_unschedule(hal_task_t *task) {
   for (int i = 0; i < MAX_TASKS; i++) {
     if (tasks[i].active && tasks[i].task == task) {
       tasks[i].active = 0;
-      io_log("TASKS", "Unscheduled task %p from slot %d", (void *)task, i);
+      reschedule_count++;
+      io_log_trace("TASKS", "Unscheduled task %p from slot %d", (void *)task,
+                   i);
       break;
     }
   }
@@ -1,5 +1,6 @@
 #include "hal/timer.h"
 #include "stub/machine_io.h"
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -14,7 +15,7 @@ static uint64_t frozen_millis = 0;
 void stub_millis_init() {
   struct timeval current_time;
   if (gettimeofday(&current_time, NULL) != 0) {
-    io_log("TIMER", "Error: Failed to get initial time");
+    io_log_error("TIMER", "Error: Failed to get initial time");
     exit(1);
   }
   start_ms = (uint64_t)current_time.tv_sec * 1000 + current_time.tv_usec / 1000;
@@ -24,7 +25,8 @@ void stub_millis_init() {
 }
 
 void stub_millis_freeze() {
-  frozen_millis = hal_millis();
+  // Frozen from startup, time starts at exactly 0 for reproducible runs
+  frozen_millis = initialized ? hal_millis() : 0;
   time_frozen = 1;
   io_log("TIMER", "Time frozen at %llu ms", (unsigned long long)frozen_millis);
 }
@@ -36,6 +38,15 @@ void stub_millis_unfreeze() {
 
 void stub_millis_step(uint64_t step) { frozen_millis += step; }
 
+void stub_millis_reset(bool frozen) {
+  // Same clock as a process started now, with or without --freeze-time
+  initialized = 0;
+  time_frozen = 0;
+  if (frozen) {
+    stub_millis_freeze();
+  }
+}
+
 uint32_t hal_millis() {
   if (time_frozen) {
     return (uint32_t)frozen_millis;
@@ -48,7 +59,7 @@ uint32_t hal_millis() {
   }
 
   if (gettimeofday(&current_time, NULL) != 0) {
-    io_log("TIMER", "Error: Failed to get current time");
+    io_log_error("TIMER", "Error: Failed to get current time");
     exit(1);
   }
 
@@ -1,4 +1,6 @@
 #include "hal/zigbee.h"
+#include "base_components/diagnostics.h"
+#include "hal/tasks.h"
 #include "stub/machine_io.h"
 #include "stub/parsing.h"
 #include <stdint.h>
@@ -20,20 +22,42 @@ static uint8_t endpoints_count = 0;
 static hal_zigbee_network_status_t network_status =
     HAL_ZIGBEE_NETWORK_NOT_JOINED;
 static hal_attribute_change_callback_t attr_change_callback = NULL;
+// Hardware identity, kept over resets
+static uint64_t ieee_address = 0xA4C1380000000001ull;
+
+// Beacon scan of one channel at scan duration 3, (2^3 + 1) * 15.36 ms
+#define STUB_CHANNEL_SCAN_MS 138
+// Rejoin request and response once the parent is found
+#define STUB_REJOIN_EXCHANGE_MS 50
+
+// The simulated coordinator, channel 0 when it is off
+static uint8_t coordinator_channel = 15;
+static const hal_zigbee_network_info coordinator_network = {
+    .pan_id = 0x1A62,
+    .ext_pan_id = {0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD},
+};
+
+// Network of the stack's own NVM, kept over resets that keep NVM
+static bool commissioned = false;
+static hal_zigbee_network_info network;
+
+static hal_task_t rejoin_task;
+static uint32_t rejoin_channel_mask;
 
 static stub_binding_t bindings[MAX_BINDINGS];
 static int binding_count = 0;
+static bool send_fail = false;
 
 void hal_zigbee_init(hal_zigbee_endpoint *ep_list, uint8_t ep_count) {
   if (!ep_list && ep_count > 0) {
-    io_log("ZIGBEE", "Error: NULL endpoint list with non-zero count %d",
-           ep_count);
+    io_log_error("ZIGBEE", "Error: NULL endpoint list with non-zero count %d",
+                 ep_count);
     exit(1);
   }
 
   if (ep_count > MAX_ENDPOINTS) {
-    io_log("ZIGBEE", "Error: Endpoint count %d exceeds maximum %d", ep_count,
-           MAX_ENDPOINTS);
+    io_log_error("ZIGBEE", "Error: Endpoint count %d exceeds maximum %d",
+                 ep_count, MAX_ENDPOINTS);
     exit(1);
   }
 
@@ -43,37 +67,39 @@ void hal_zigbee_init(hal_zigbee_endpoint *ep_list, uint8_t ep_count) {
   io_log("ZIGBEE", "Initialized Zigbee with %d endpoints", ep_count);
 
   for (int i = 0; i < ep_count; i++) {
-    io_log("ZIGBEE", "Endpoint %d: profile=0x%04x, device=0x%04x, clusters=%d",
-           ep_list[i].endpoint, ep_list[i].profile_id, ep_list[i].device_id,
-           ep_list[i].cluster_count);
+    io_log_trace("ZIGBEE",
+                 "Endpoint %d: profile=0x%04x, device=0x%04x, clusters=%d",
+                 ep_list[i].endpoint, ep_list[i].profile_id,
+                 ep_list[i].device_id, ep_list[i].cluster_count);
 
     if (ep_list[i].cluster_count > 0 && !ep_list[i].clusters) {
-      io_log(
+      io_log_error(
           "ZIGBEE",
           "Error: Endpoint %d has cluster count %d but NULL clusters pointer",
           ep_list[i].endpoint, ep_list[i].cluster_count);
       exit(1);
     }
     for (int j = 0; j < ep_list[i].cluster_count; j++) {
-      io_log("ZIGBEE", "  Cluster %d: id=0x%04x, attrs=%d, is_server=%d", j,
-             ep_list[i].clusters[j].cluster_id,
-             ep_list[i].clusters[j].attribute_count,
-             ep_list[i].clusters[j].is_server);
+      io_log_trace("ZIGBEE", "  Cluster %d: id=0x%04x, attrs=%d, is_server=%d",
+                   j, ep_list[i].clusters[j].cluster_id,
+                   ep_list[i].clusters[j].attribute_count,
+                   ep_list[i].clusters[j].is_server);
       if (ep_list[i].clusters[j].attribute_count > 0 &&
           !ep_list[i].clusters[j].attributes) {
-        io_log("ZIGBEE",
-               "Error: Endpoint %d Cluster %d has attribute count %d but NULL "
-               "attributes pointer",
-               ep_list[i].endpoint, j, ep_list[i].clusters[j].attribute_count);
+        io_log_error(
+            "ZIGBEE",
+            "Error: Endpoint %d Cluster %d has attribute count %d but NULL "
+            "attributes pointer",
+            ep_list[i].endpoint, j, ep_list[i].clusters[j].attribute_count);
         exit(1);
       }
       for (int k = 0; k < ep_list[i].clusters[j].attribute_count; k++) {
-        io_log("ZIGBEE",
-               "    Attr %d: id=0x%04x, type=0x%02x, size=%d, flags=%d", k,
-               ep_list[i].clusters[j].attributes[k].attribute_id,
-               ep_list[i].clusters[j].attributes[k].data_type_id,
-               ep_list[i].clusters[j].attributes[k].size,
-               ep_list[i].clusters[j].attributes[k].flag);
+        io_log_trace("ZIGBEE",
+                     "    Attr %d: id=0x%04x, type=0x%02x, size=%d, flags=%d",
+                     k, ep_list[i].clusters[j].attributes[k].attribute_id,
+                     ep_list[i].clusters[j].attributes[k].data_type_id,
+                     ep_list[i].clusters[j].attributes[k].size,
+                     ep_list[i].clusters[j].attributes[k].flag);
       }
     }
   }
@@ -91,19 +117,68 @@ void hal_register_on_network_status_change_callback(
   network_status_change_callback = callback;
 }
 
+static void set_status(hal_zigbee_network_status_t status) {
+  network_status = status;
+  io_evt("network_status status=%d", status);
+  if (network_status_change_callback != NULL) {
+    network_status_change_callback(hal_zigbee_get_network_status());
+  }
+}
+
 void hal_zigbee_leave_network(void) {
   if (network_status == HAL_ZIGBEE_NETWORK_NOT_JOINED) {
-    io_log("ZIGBEE", "Cannot leave network - not joined");
+    io_log_warn("ZIGBEE", "Cannot leave network - not joined");
     return;
   }
   io_evt("zcl_leave_network");
   io_log("ZIGBEE", "Leaving network");
-  network_status = HAL_ZIGBEE_NETWORK_NOT_JOINED;
-  if (network_status_change_callback != NULL) {
-    network_status_change_callback(hal_zigbee_get_network_status());
+  commissioned = false;
+  set_status(HAL_ZIGBEE_NETWORK_NOT_JOINED);
+}
+
+bool hal_zigbee_get_network_info(hal_zigbee_network_info *info) {
+  if (commissioned)
+    *info = network;
+  return commissioned;
+}
+
+static void rejoin_done(void *arg) {
+  bool found = coordinator_channel != 0 &&
+               (rejoin_channel_mask >> coordinator_channel) & 1;
+  io_log("ZIGBEE", "Rejoin %s", found ? "succeeded" : "failed");
+  if (found) {
+    network.channel = coordinator_channel;
+    set_status(HAL_ZIGBEE_NETWORK_JOINED);
+  } else {
+    set_status(HAL_ZIGBEE_NETWORK_NOT_JOINED);
   }
 }
 
+hal_zigbee_status_t hal_zigbee_rejoin(uint32_t channel_mask) {
+  if (!commissioned || !(channel_mask & HAL_ZIGBEE_ALL_CHANNELS_MASK))
+    return HAL_ZIGBEE_ERR_BAD_ARG;
+  io_evt("zdo_rejoin channels=0x%08x", channel_mask);
+
+  // Every channel of the mask is scanned before the parent answers
+  uint32_t channels = 0;
+  for (uint32_t m = channel_mask & HAL_ZIGBEE_ALL_CHANNELS_MASK; m; m >>= 1)
+    channels += m & 1;
+  rejoin_channel_mask = channel_mask;
+  rejoin_task.handler = rejoin_done;
+  rejoin_task.arg = NULL;
+  hal_tasks_init(&rejoin_task);
+  hal_tasks_schedule(&rejoin_task, channels * STUB_CHANNEL_SCAN_MS +
+                                       STUB_REJOIN_EXCHANGE_MS);
+  set_status(HAL_ZIGBEE_NETWORK_JOINING);
+  return HAL_ZIGBEE_OK;
+}
+
+void stub_zigbee_set_coordinator_channel(uint8_t channel) {
+  coordinator_channel = channel;
+}
+
+void stub_zigbee_set_send_fail(bool fail) { send_fail = fail; }
+
 void hal_zigbee_start_network_steering() {
   io_log("ZIGBEE", "Starting network steering (joining)");
   io_evt("zcl_start_network_steering");
@@ -113,21 +188,36 @@ void hal_zigbee_start_network_steering() {
   }
 }
 
+void hal_zigbee_get_ieee_address(uint8_t addr[8]) {
+  for (int i = 0; i < 8; i++) {
+    addr[i] = (uint8_t)(ieee_address >> (8 * i));
+  }
+}
+
+void stub_zigbee_set_ieee_address(uint64_t addr) { ieee_address = addr; }
+
+void hal_zigbee_set_poll_interval(uint32_t interval_ms) {
+  io_log_debug("ZIGBEE", "Poll interval %u ms", interval_ms);
+  io_evt("poll_interval ms=%u", interval_ms);
+}
+
 void hal_zigbee_notify_attribute_changed(uint8_t endpoint, uint8_t cluster_id,
                                          uint16_t attribute_id) {
-  io_log("ZIGBEE", "Attribute changed: ep=%d, cluster=0x%04x, attr=0x%04x",
-         endpoint, cluster_id, attribute_id);
+  io_log_debug("ZIGBEE",
+               "Attribute changed: ep=%d, cluster=0x%04x, attr=0x%04x",
+               endpoint, cluster_id, attribute_id);
   hal_zigbee_attribute *attr = hal_zigbee_find_attribute(
       endpoints, endpoints_count, endpoint, cluster_id, attribute_id);
   if (!attr) {
-    io_log("ZIGBEE",
-           "Error: Notified about change of unregistered attribute "
-           "not found for ep=%d, cluster=0x%04x, attr=0x%04x",
-           endpoint, cluster_id, attribute_id);
+    io_log_error("ZIGBEE",
+                 "Error: Notified about change of unregistered attribute "
+                 "not found for ep=%d, cluster=0x%04x, attr=0x%04x",
+                 endpoint, cluster_id, attribute_id);
 
     // TODO: Fix this properly
     // exit(1);
   }
+  diagnostics.reports_sent++;
   io_evt("zcl_attr_change ep=%u cluster=0x%04X attr=0x%04X", endpoint,
          cluster_id, attribute_id);
 }
@@ -135,7 +225,7 @@ void hal_zigbee_notify_attribute_changed(uint8_t endpoint, uint8_t cluster_id,
 void hal_zigbee_register_on_attribute_change_callback(
     hal_attribute_change_callback_t callback) {
   attr_change_callback = callback;
-  io_log("ZIGBEE", "Registered attribute change callback");
+  io_log_debug("ZIGBEE", "Registered attribute change callback");
 }
 
 hal_zigbee_status_t hal_zigbee_send_cmd_to_bindings(const hal_zigbee_cmd *cmd) {
@@ -143,12 +233,19 @@ hal_zigbee_status_t hal_zigbee_send_cmd_to_bindings(const hal_zigbee_cmd *cmd) {
     return HAL_ZIGBEE_ERR_BAD_ARG;
 
   if (network_status != HAL_ZIGBEE_NETWORK_JOINED) {
-    io_log("ZIGBEE", "Cannot send command - not joined to network");
+    io_log_warn("ZIGBEE", "Cannot send command - not joined to network");
     return HAL_ZIGBEE_ERR_NOT_JOINED;
   }
 
-  io_log("ZIGBEE", "Sending command: ep=%d, cluster=0x%04x, cmd=0x%02x, len=%d",
-         cmd->endpoint, cmd->cluster_id, cmd->command_id, cmd->payload_len);
+  if (send_fail) {
+    io_log_warn("ZIGBEE", "Cannot send command - send failure simulated");
+    return HAL_ZIGBEE_ERR_SEND_FAILED;
+  }
+
+  io_log_debug("ZIGBEE",
+               "Sending command: ep=%d, cluster=0x%04x, cmd=0x%02x, len=%d",
+               cmd->endpoint, cmd->cluster_id, cmd->command_id,
+               cmd->payload_len);
 
   char buffer[cmd->payload_len * 2 + 1];
   bytes_to_hexstr(cmd->payload, cmd->payload_len, buffer);
@@ -162,14 +259,14 @@ hal_zigbee_status_t hal_zigbee_send_cmd_to_bindings(const hal_zigbee_cmd *cmd) {
   for (int i = 0; i < binding_count; i++) {
     if (bindings[i].endpoint == cmd->endpoint &&
         bindings[i].cluster_id == cmd->cluster_id) {
-      io_log("ZIGBEE", "Sent to binding %d (addr=0x%04x)", i,
-             bindings[i].short_addr);
+      io_log_debug("ZIGBEE", "Sent to binding %d (addr=0x%04x)", i,
+                   bindings[i].short_addr);
       sent_count++;
     }
   }
 
   if (sent_count == 0) {
-    io_log("ZIGBEE", "No matching bindings found");
+    io_log_debug("ZIGBEE", "No matching bindings found");
   }
 
   return HAL_ZIGBEE_OK;
@@ -183,18 +280,43 @@ hal_zigbee_send_report_attr(uint8_t endpoint, uint16_t cluster_id,
     return HAL_ZIGBEE_ERR_BAD_ARG;
 
   if (network_status != HAL_ZIGBEE_NETWORK_JOINED) {
-    io_log("ZIGBEE", "Cannot send report - not joined to network");
+    io_log_warn("ZIGBEE", "Cannot send report - not joined to network");
     return HAL_ZIGBEE_ERR_NOT_JOINED;
   }
 
-  io_log("ZIGBEE",
-         "Sending attribute report: ep=%d, cluster=0x%04x, attr=0x%04x, "
-         "type=0x%02x, len=%d",
-         endpoint, cluster_id, attr_id, zcl_type_id, value_len);
+  io_log_debug("ZIGBEE",
+               "Sending attribute report: ep=%d, cluster=0x%04x, attr=0x%04x, "
+               "type=0x%02x, len=%d",
+               endpoint, cluster_id, attr_id, zcl_type_id, value_len);
 
   return HAL_ZIGBEE_OK;
 }
 
+hal_zigbee_status_t
+hal_zigbee_send_report_attrs(uint8_t endpoint, uint16_t cluster_id,
+                             const hal_zigbee_report_attr *attrs,
+                             uint8_t attrs_cnt) {
+  if (!attrs || attrs_cnt == 0 || attrs_cnt > HAL_ZIGBEE_MAX_REPORT_ATTRS)
+    return HAL_ZIGBEE_ERR_BAD_ARG;
+
+  if (network_status != HAL_ZIGBEE_NETWORK_JOINED) {
+    io_log_warn("ZIGBEE", "Cannot send report - not joined to network");
+    return HAL_ZIGBEE_ERR_NOT_JOINED;
+  }
+
+  // "0x0000,0x8001"
+  char ids[HAL_ZIGBEE_MAX_REPORT_ATTRS * 7];
+  size_t len = 0;
+  for (uint8_t i = 0; i < attrs_cnt; i++) {
+    len += snprintf(ids + len, sizeof(ids) - len, "%s0x%04X", i ? "," : "",
+                    attrs[i].attr_id);
+  }
+  diagnostics.reports_sent++;
+  io_evt("zcl_report ep=%u cluster=0x%04X attrs=%s", endpoint, cluster_id,
+         ids);
+  return HAL_ZIGBEE_OK;
+}
+
 hal_zigbee_status_t hal_zigbee_send_announce(void) {
   io_log("ZIGBEE", "Sending Zigbee announce");
   io_evt("zdo_announce");
@@ -202,17 +324,22 @@ hal_zigbee_status_t hal_zigbee_send_announce(void) {
 }
 
 void stub_zigbee_set_network_status(hal_zigbee_network_status_t status) {
-  network_status = status;
-  io_log("ZIGBEE", "Network status set to %d", network_status);
-  if (network_status_change_callback != NULL) {
-    network_status_change_callback(hal_zigbee_get_network_status());
+  io_log("ZIGBEE", "Network status set to %d", status);
+  // Joined to the simulated coordinator, or kicked off its network
+  if (status == HAL_ZIGBEE_NETWORK_JOINED) {
+    commissioned = true;
+    network = coordinator_network;
+    network.channel = coordinator_channel;
+  } else if (status == HAL_ZIGBEE_NETWORK_NOT_JOINED) {
+    commissioned = false;
   }
+  set_status(status);
 }
 
 void stub_zigbee_add_binding(uint16_t short_addr, uint8_t endpoint,
                              uint16_t cluster_id) {
   if (binding_count >= MAX_BINDINGS) {
-    io_log("ZIGBEE", "Cannot add binding - table full");
+    io_log_warn("ZIGBEE", "Cannot add binding - table full");
     return;
   }
 
@@ -221,8 +348,8 @@ void stub_zigbee_add_binding(uint16_t short_addr, uint8_t endpoint,
   bindings[binding_count].cluster_id = cluster_id;
   binding_count++;
 
-  io_log("ZIGBEE", "Added binding: addr=0x%04x, ep=%d, cluster=0x%04x",
-         short_addr, endpoint, cluster_id);
+  io_log_debug("ZIGBEE", "Added binding: addr=0x%04x, ep=%d, cluster=0x%04x",
+               short_addr, endpoint, cluster_id);
 }
 
 void stub_zigbee_clear_bindings(void) {
@@ -230,6 +357,18 @@ void stub_zigbee_clear_bindings(void) {
   io_log("ZIGBEE", "Cleared all bindings");
 }
 
+void stub_zigbee_reset(bool keep_network) {
+  if (!keep_network) {
+    commissioned = false;
+  }
+  endpoints = NULL;
+  endpoints_count = 0;
+  network_status = HAL_ZIGBEE_NETWORK_NOT_JOINED;
+  attr_change_callback = NULL;
+  network_status_change_callback = NULL;
+  stub_zigbee_clear_bindings();
+}
+
 hal_zigbee_endpoint *stub_zigbee_get_endpoints(uint8_t *count) {
   if (count)
     *count = endpoints_count;
@@ -241,8 +380,9 @@ hal_zigbee_cmd_result_t stub_zigbee_simulate_command(uint8_t endpoint,
                                                      uint16_t cluster_id,
                                                      uint8_t command_id,
                                                      void *payload) {
-  io_log("ZIGBEE", "Simulating command: ep=%d, cluster=0x%04x, cmd=0x%02x",
-         endpoint, cluster_id, command_id);
+  io_log_debug("ZIGBEE",
+               "Simulating command: ep=%d, cluster=0x%04x, cmd=0x%02x",
+               endpoint, cluster_id, command_id);
 
   // Find the endpoint and cluster
   for (int i = 0; i < endpoints_count; i++) {
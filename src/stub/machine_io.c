@@ -1,2 +1,193 @@
+#include "machine_io.h"
 #include <stdbool.h>
+#include <string.h>
+
+#define MAX_EVT_KINDS 16
+#define MAX_EVT_KIND_LEN 32
+#define MAX_EVT_TEXT_LEN 512
+
 bool g_machine_mode = false;
+io_evt_sink_t g_evt_sink = NULL;
+
+static char evt_kinds[MAX_EVT_KINDS][MAX_EVT_KIND_LEN];
+static int evt_kinds_cnt = 0;
+static bool evt_all = true;
+
+bool io_evt_subscribed(const char *fmt) {
+  if (evt_all)
+    return true;
+  // Event kind is the first word of the format
+  size_t len = strcspn(fmt, " ");
+  for (int i = 0; i < evt_kinds_cnt; i++) {
+    if (strlen(evt_kinds[i]) == len && strncmp(evt_kinds[i], fmt, len) == 0)
+      return true;
+  }
+  return false;
+}
+
+void io_evt_subscribe(int count, char **kinds) {
+  evt_all = count == 0;
+  evt_kinds_cnt = 0;
+  for (int i = 0; i < count && evt_kinds_cnt < MAX_EVT_KINDS; i++) {
+    strncpy(evt_kinds[evt_kinds_cnt], kinds[i], MAX_EVT_KIND_LEN - 1);
+    evt_kinds[evt_kinds_cnt][MAX_EVT_KIND_LEN - 1] = '\0';
+    evt_kinds_cnt++;
+  }
+}
+
+void io_evt_unsubscribe_all(void) {
+  evt_all = false;
+  evt_kinds_cnt = 0;
+}
+
+void io_evt_to_sink(const char *fmt, va_list ap) {
+  char text[MAX_EVT_TEXT_LEN];
+  vsnprintf(text, sizeof(text), fmt, ap);
+  g_evt_sink(text, hal_millis());
+}
+
+#define MAX_LOG_CATEGORIES 16
+#define MAX_LOG_CATEGORY_LEN 16
+#define MAX_LOG_LINE_LEN 256
+
+static const char *const log_level_names[] = {"trace", "debug", "info",
+                                              "warn",  "error", "off"};
+
+// Level of every category without its own entry
+static io_log_level_t log_level = IO_LOG_INFO;
+io_log_level_t g_log_floor = IO_LOG_INFO;
+
+static struct {
+  char name[MAX_LOG_CATEGORY_LEN];
+  io_log_level_t level;
+} log_categories[MAX_LOG_CATEGORIES];
+static int log_categories_cnt = 0;
+
+static char log_ring[IO_LOG_RING_MAX][MAX_LOG_LINE_LEN];
+static uint32_t log_ring_size = 0; // 0 writes to stderr
+static uint32_t log_ring_start = 0;
+static uint32_t log_ring_count = 0;
+
+static void update_log_floor(void) {
+  g_log_floor = log_level;
+  for (int i = 0; i < log_categories_cnt; i++) {
+    if (log_categories[i].level < g_log_floor)
+      g_log_floor = log_categories[i].level;
+  }
+}
+
+bool io_log_enabled(io_log_level_t level, const char *category) {
+  return level >= io_log_get_level(category);
+}
+
+void io_log_set_level(const char *category, io_log_level_t level) {
+  if (!category) {
+    log_level = level;
+    log_categories_cnt = 0;
+    update_log_floor();
+    return;
+  }
+  int i = 0;
+  while (i < log_categories_cnt && strcmp(log_categories[i].name, category))
+    i++;
+  if (i == log_categories_cnt) {
+    if (log_categories_cnt == MAX_LOG_CATEGORIES)
+      return;
+    strncpy(log_categories[i].name, category, MAX_LOG_CATEGORY_LEN - 1);
+    log_categories[i].name[MAX_LOG_CATEGORY_LEN - 1] = '\0';
+    log_categories_cnt++;
+  }
+  log_categories[i].level = level;
+  update_log_floor();
+}
+
+io_log_level_t io_log_get_level(const char *category) {
+  for (int i = 0; category && i < log_categories_cnt; i++) {
+    if (strcmp(log_categories[i].name, category) == 0)
+      return log_categories[i].level;
+  }
+  return log_level;
+}
+
+int io_log_parse_level(const char *name) {
+  for (int i = 0; i <= IO_LOG_OFF; i++) {
+    if (strcmp(log_level_names[i], name) == 0)
+      return i;
+  }
+  return -1;
+}
+
+const char *io_log_level_name(io_log_level_t level) {
+  return level <= IO_LOG_OFF ? log_level_names[level] : "?";
+}
+
+bool io_log_capture(uint32_t lines) {
+  if (lines > IO_LOG_RING_MAX)
+    return false;
+  log_ring_size = lines;
+  io_log_clear();
+  return true;
+}
+
+uint32_t io_log_captured(void) { return log_ring_count; }
+
+void io_log_clear(void) {
+  log_ring_start = 0;
+  log_ring_count = 0;
+}
+
+uint32_t io_log_dump(void) {
+  uint32_t count = log_ring_count;
+  for (uint32_t i = 0; i < count; i++) {
+    fputs(log_ring[(log_ring_start + i) % log_ring_size], stderr);
+    fputc('\n', stderr);
+  }
+  fprintf(stderr, "[LOG] %u lines dumped\n", count);
+  fflush(stderr);
+  io_log_clear();
+  return count;
+}
+
+static void log_line(const char *category, const char *fmt, va_list ap) {
+  if (!log_ring_size) {
+    fprintf(stderr, "[%s] ", category);
+    vfprintf(stderr, fmt, ap);
+    fputc('\n', stderr);
+    return;
+  }
+  // Oldest line is overwritten once the ring is full
+  uint32_t slot = (log_ring_start + log_ring_count) % log_ring_size;
+  if (log_ring_count == log_ring_size) {
+    log_ring_start = (log_ring_start + 1) % log_ring_size;
+  } else {
+    log_ring_count++;
+  }
+  char *line = log_ring[slot];
+  int len = snprintf(line, MAX_LOG_LINE_LEN, "[%s] ", category);
+  vsnprintf(line + len, MAX_LOG_LINE_LEN - len, fmt, ap);
+}
+
+void io_log_write(const char *category, const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  log_line(category, fmt, ap);
+  va_end(ap);
+}
+
+int stub_fw_printf(const char *fmt, ...) {
+  if (IO_LOG_INFO < IO_LOG_MIN_LEVEL || IO_LOG_INFO < g_log_floor ||
+      !io_log_enabled(IO_LOG_INFO, "FW"))
+    return 0;
+  char text[MAX_LOG_LINE_LEN];
+  va_list ap;
+  va_start(ap, fmt);
+  int len = vsnprintf(text, sizeof(text), fmt, ap);
+  va_end(ap);
+  // Firmware lines end in "\r\n", the logger adds its own
+  size_t end = strlen(text);
+  while (end > 0 && (text[end - 1] == '\n' || text[end - 1] == '\r'))
+    end--;
+  text[end] = '\0';
+  io_log_write("FW", "%s", text);
+  return len;
+}
@@ -1,31 +1,112 @@
 #ifndef APP_MACHINE_IO_H
 #define APP_MACHINE_IO_H
+#include "hal/timer.h"
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 
 extern bool g_machine_mode;
 
-static inline void io_log(const char *prefix, const char *fmt, ...) {
-  va_list ap;
-  va_start(ap, fmt);
-  fprintf(stderr, "[%s] ", prefix);
-  vfprintf(stderr, fmt, ap);
-  va_end(ap);
-  fputc('\n', stderr);
-}
+/* Set while the binary framed protocol (machine_proto.c) is active */
+extern bool g_binary_mode;
+
+/* Returns whether events of the kind starting fmt are subscribed */
+bool io_evt_subscribed(const char *fmt);
+
+/* Limits events to the given kinds, all of them when count is 0 */
+void io_evt_subscribe(int count, char **kinds);
+
+/* Drops every event until the next io_evt_subscribe() */
+void io_evt_unsubscribe_all(void);
+
+/* Set by an embedding host (switchcore.c), takes events instead of stdout */
+typedef void (*io_evt_sink_t)(const char *text, uint32_t t_ms);
+extern io_evt_sink_t g_evt_sink;
+void io_evt_to_sink(const char *fmt, va_list ap);
+
+void machine_proto_res(bool ok, const char *fmt, va_list ap);
+void machine_proto_evt(const char *fmt, va_list ap);
+
+/* Log levels, most verbose first */
+typedef enum {
+  IO_LOG_TRACE,
+  IO_LOG_DEBUG,
+  IO_LOG_INFO,
+  IO_LOG_WARN,
+  IO_LOG_ERROR,
+  IO_LOG_OFF,
+} io_log_level_t;
+
+/* Least severe level compiled in, calls below it cost nothing
+   (make LOG_MIN_LEVEL=INFO) */
+#ifndef IO_LOG_MIN_LEVEL
+#define IO_LOG_MIN_LEVEL IO_LOG_TRACE
+#endif
+
+/* Most verbose level enabled for any category, a fast first check */
+extern io_log_level_t g_log_floor;
+
+/* Returns whether a log line of the category (e.g. "GPIO") is enabled */
+bool io_log_enabled(io_log_level_t level, const char *category);
+
+/* Sets the level of one category, all of them when category is NULL */
+void io_log_set_level(const char *category, io_log_level_t level);
+io_log_level_t io_log_get_level(const char *category);
+
+/* Parses "trace", "debug", "info", "warn", "error" or "off", -1 if unknown */
+int io_log_parse_level(const char *name);
+const char *io_log_level_name(io_log_level_t level);
+
+/* Keeps the last lines log lines in a ring instead of writing them to
+   stderr, 0 writes to stderr again. Empties the ring. Returns false if lines
+   is over IO_LOG_RING_MAX. */
+#define IO_LOG_RING_MAX 1024
+bool io_log_capture(uint32_t lines);
+uint32_t io_log_captured(void);
+void io_log_clear(void);
+
+/* Writes the captured lines to stderr, oldest first, then a
+   "[LOG] <n> lines dumped" marker, and empties the ring. Returns n. */
+uint32_t io_log_dump(void);
+
+/* printf of the firmware on the stub (hal/printf_selector.h), logged as
+   INFO lines of the FW category */
+int stub_fw_printf(const char *fmt, ...)
+    __attribute__((format(printf, 1, 2)));
+
+void io_log_write(const char *category, const char *fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+
+#define io_log_at(level, category, ...)                                        \
+  do {                                                                         \
+    if ((level) >= IO_LOG_MIN_LEVEL && (level) >= g_log_floor &&               \
+        io_log_enabled(level, category))                                       \
+      io_log_write(category, __VA_ARGS__);                                     \
+  } while (0)
+
+#define io_log_trace(cat, ...) io_log_at(IO_LOG_TRACE, cat, __VA_ARGS__)
+#define io_log_debug(cat, ...) io_log_at(IO_LOG_DEBUG, cat, __VA_ARGS__)
+#define io_log(cat, ...) io_log_at(IO_LOG_INFO, cat, __VA_ARGS__)
+#define io_log_warn(cat, ...) io_log_at(IO_LOG_WARN, cat, __VA_ARGS__)
+#define io_log_error(cat, ...) io_log_at(IO_LOG_ERROR, cat, __VA_ARGS__)
 
 static inline void io_res_ok(const char *fmt, ...) {
   if (!g_machine_mode)
     return;
+  va_list ap;
+  va_start(ap, fmt);
+  if (g_binary_mode) {
+    machine_proto_res(true, fmt, ap);
+    va_end(ap);
+    return;
+  }
   fputs("RES OK", stdout);
   if (fmt && *fmt) {
     fputc(' ', stdout);
-    va_list ap;
-    va_start(ap, fmt);
     vfprintf(stdout, fmt, ap);
-    va_end(ap);
   }
+  va_end(ap);
   fputc('\n', stdout);
   fflush(stdout);
 }
@@ -33,9 +114,14 @@ static inline void io_res_ok(const char *fmt, ...) {
 static inline void io_res_err(const char *fmt, ...) {
   if (!g_machine_mode)
     return;
-  fputs("RES ERR ", stdout);
   va_list ap;
   va_start(ap, fmt);
+  if (g_binary_mode) {
+    machine_proto_res(false, fmt, ap);
+    va_end(ap);
+    return;
+  }
+  fputs("RES ERR ", stdout);
   vfprintf(stdout, fmt, ap);
   va_end(ap);
   fputc('\n', stdout);
@@ -43,14 +129,25 @@ static inline void io_res_err(const char *fmt, ...) {
 }
 
 static inline void io_evt(const char *fmt, ...) {
-  if (!g_machine_mode)
+  if (!g_machine_mode || !io_evt_subscribed(fmt))
     return;
-  fputs("EVT ", stdout);
   va_list ap;
   va_start(ap, fmt);
+  if (g_evt_sink) {
+    io_evt_to_sink(fmt, ap);
+    va_end(ap);
+    return;
+  }
+  if (g_binary_mode) {
+    machine_proto_evt(fmt, ap);
+    va_end(ap);
+    return;
+  }
+  fputs("EVT ", stdout);
   vfprintf(stdout, fmt, ap);
   va_end(ap);
-  fputc('\n', stdout);
+  // Device time of the event, lets the host order events across instances
+  fprintf(stdout, " t=%u\n", hal_millis());
   fflush(stdout);
 }
 #endif
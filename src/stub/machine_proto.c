@@ -0,0 +1,177 @@
+#include "machine_proto.h"
+
+#include "machine_io.h"
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define FRAME_HEADER_SIZE 5 // u16 length, u8 type, u16 seq
+#define MAX_FRAME_SIZE (2 + UINT16_MAX)
+#define MAX_TEXT_LEN 512
+
+bool g_binary_mode = false;
+
+static FILE *proto_out = NULL;
+
+static uint8_t in_buf[MAX_FRAME_SIZE];
+static size_t in_len = 0;
+
+static uint8_t res_buf[MAX_FRAME_SIZE];
+static size_t res_len = FRAME_HEADER_SIZE;
+static uint16_t current_seq = 0;
+static bool command_answered = false;
+
+static void put_u16(uint8_t *p, uint16_t value) {
+  p[0] = value & 0xFF;
+  p[1] = value >> 8;
+}
+
+static uint16_t get_u16(const uint8_t *p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+// Frame must start with FRAME_HEADER_SIZE free bytes for the header
+static void send_frame(uint8_t *frame, size_t payload_len, uint8_t type,
+                       uint16_t seq) {
+  put_u16(frame, (uint16_t)(payload_len + 3));
+  frame[2] = type;
+  put_u16(frame + 3, seq);
+  fwrite(frame, 1, FRAME_HEADER_SIZE + payload_len, proto_out);
+  fflush(proto_out);
+}
+
+static void flush_results(void) {
+  send_frame(res_buf, res_len - FRAME_HEADER_SIZE, MACHINE_PROTO_RESULT,
+             current_seq);
+  res_len = FRAME_HEADER_SIZE;
+}
+
+static void append_result(bool ok, const char *text, size_t len) {
+  if (res_len + 3 + len > sizeof(res_buf)) {
+    flush_results();
+  }
+  res_buf[res_len++] = ok;
+  put_u16(res_buf + res_len, (uint16_t)len);
+  res_len += 2;
+  memcpy(res_buf + res_len, text, len);
+  res_len += len;
+  command_answered = true;
+}
+
+static size_t clamp_len(int len, size_t size) {
+  if (len < 0)
+    return 0;
+  return (size_t)len < size ? (size_t)len : size - 1;
+}
+
+void machine_proto_res(bool ok, const char *fmt, va_list ap) {
+  char text[MAX_TEXT_LEN];
+  size_t len = 0;
+  if (fmt && *fmt) {
+    len = clamp_len(vsnprintf(text, sizeof(text), fmt, ap), sizeof(text));
+  }
+  append_result(ok, text, len);
+}
+
+void machine_proto_evt(const char *fmt, va_list ap) {
+  uint8_t frame[FRAME_HEADER_SIZE + MAX_TEXT_LEN];
+  char *text = (char *)frame + FRAME_HEADER_SIZE;
+  size_t len = clamp_len(vsnprintf(text, MAX_TEXT_LEN, fmt, ap), MAX_TEXT_LEN);
+  len += clamp_len(snprintf(text + len, MAX_TEXT_LEN - len, " t=%u",
+                            hal_millis()),
+                   MAX_TEXT_LEN - len);
+  send_frame(frame, len, MACHINE_PROTO_EVENT, current_seq);
+}
+
+// The device may reset in the middle of a batch, answer what completed
+static void flush_results_at_exit(void) {
+  if (current_seq != 0 && res_len > FRAME_HEADER_SIZE) {
+    flush_results();
+  }
+}
+
+bool machine_proto_enable(void) {
+  fflush(stdout);
+  int fd = dup(STDOUT_FILENO);
+  if (fd < 0 || (proto_out = fdopen(fd, "wb")) == NULL) {
+    io_log_error("PROTO", "Failed to take over stdout: %s", strerror(errno));
+    return false;
+  }
+  // Firmware printf output would corrupt the frames
+  dup2(STDERR_FILENO, STDOUT_FILENO);
+  atexit(flush_results_at_exit);
+  g_binary_mode = true;
+  io_log("PROTO", "Binary protocol enabled");
+  return true;
+}
+
+static void run_batch(const SimpleReplConfig *cfg, uint16_t seq,
+                      const uint8_t *p, const uint8_t *end) {
+  current_seq = seq;
+  while (p < end) {
+    if (cfg->should_exit && *cfg->should_exit)
+      break;
+    uint8_t len = *p++;
+    if (p + len > end) {
+      append_result(false, "truncated", strlen("truncated"));
+      break;
+    }
+    char line[256];
+    memcpy(line, p, len);
+    line[len] = '\0';
+    p += len;
+
+    command_answered = false;
+    simple_repl_dispatch_line(cfg, line);
+    if (!command_answered) {
+      append_result(false, "no_result", strlen("no_result"));
+    }
+    // Same as the line reader, the main loop runs between commands
+    if (cfg->poll_cb)
+      cfg->poll_cb(cfg->poll_user);
+  }
+  flush_results();
+  current_seq = 0;
+}
+
+static void handle_frame(const SimpleReplConfig *cfg, const uint8_t *body,
+                         size_t len) {
+  if (len < 3) {
+    io_log_warn("PROTO", "Dropping short frame of %zu bytes", len);
+    return;
+  }
+  uint8_t type = body[0];
+  uint16_t seq = get_u16(body + 1);
+  if (type != MACHINE_PROTO_BATCH) {
+    io_log_warn("PROTO", "Dropping frame of unknown type 0x%02x", type);
+    return;
+  }
+  run_batch(cfg, seq, body + 3, body + len);
+}
+
+int machine_proto_input(const SimpleReplConfig *cfg) {
+  if (!g_binary_mode)
+    return 0;
+
+  ssize_t n = read(STDIN_FILENO, in_buf + in_len, sizeof(in_buf) - in_len);
+  if (n == 0)
+    return -1;
+  if (n < 0)
+    return errno == EINTR || errno == EAGAIN ? 1 : -1;
+  in_len += (size_t)n;
+
+  size_t offset = 0;
+  while (in_len - offset >= 2) {
+    size_t frame_len = 2 + get_u16(in_buf + offset);
+    if (in_len - offset < frame_len)
+      break;
+    handle_frame(cfg, in_buf + offset + 2, frame_len - 2);
+    offset += frame_len;
+  }
+  memmove(in_buf, in_buf + offset, in_len - offset);
+  in_len -= offset;
+  return 1;
+}
@@ -0,0 +1,43 @@
+#ifndef MACHINE_PROTO_H
+#define MACHINE_PROTO_H
+
+#include "simple_repl.h"
+#include <stdbool.h>
+
+/*
+ * Binary framed control protocol, used instead of the RES/EVT text lines
+ * after `machine bin`.
+ *
+ * Frames are little endian: u16 length of the rest of the frame, u8 type,
+ * u16 sequence number, payload.
+ *
+ * Host to device:
+ *   MACHINE_PROTO_BATCH   commands, each as u8 length + command line
+ * Device to host:
+ *   MACHINE_PROTO_RESULT  per command u8 ok, u16 length + response text.
+ *                         Large batches answer with several frames of the
+ *                         same sequence number.
+ *   MACHINE_PROTO_EVENT   event text, with the sequence number of the batch
+ *                         that caused it or 0
+ *
+ * Response and event texts are the key=value strings of the line protocol.
+ * Frames own stdout, firmware output is moved to stderr.
+ */
+
+#define MACHINE_PROTO_BATCH 0x01
+#define MACHINE_PROTO_RESULT 0x81
+#define MACHINE_PROTO_EVENT 0x82
+
+/**
+ * Switches stdin and stdout to binary frames
+ * @return false if stdout could not be taken over
+ */
+bool machine_proto_enable(void);
+
+/**
+ * SimpleReplConfig input callback, executes pending frames once enabled
+ * @return 1 if input was consumed, 0 when disabled, -1 at end of input
+ */
+int machine_proto_input(const SimpleReplConfig *cfg);
+
+#endif
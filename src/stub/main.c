@@ -1,6 +1,7 @@
 #include <getopt.h>
 #include <signal.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #ifndef HAL_STUB
@@ -8,9 +9,12 @@
 #endif
 
 #include "commands.h"
+#include "machine_proto.h"
+#include "machine_io.h"
 #include "simple_repl.h"
 #include "stub/hal/stub.h"
 #include "stub_app.h"
+#include "trace_replay.h"
 
 volatile sig_atomic_t g_should_exit = 0;
 static void on_sigint(int sig) {
@@ -24,7 +28,14 @@ static void poll_wrapper(void *u) {
 }
 
 static void print_usage(const char *prog) {
-  printf("Usage: %s [--device-config <string>] [--help]\n", prog);
+  printf("Usage: %s [--device-config <string>] [--nvm-dir <path>] "
+         "[--replay <trace>] [--log-level <level>] [--log-ring <lines>] "
+         "[--ieee <hex>] [--help]\n",
+         prog);
+  printf("  --replay prints the events of a trace replay and exits\n");
+  printf("  --log-level is trace, debug, info (default), warn, error or off\n");
+  printf("  --log-ring keeps the last log lines in memory for `log dump`\n");
+  printf("  --ieee sets the device IEEE address, it seeds the join jitter\n");
 }
 
 int main(int argc, char **argv) {
@@ -35,14 +46,20 @@ int main(int argc, char **argv) {
       {"device-config", required_argument, 0, 'd'},
       {"not-joined", no_argument, 0, 'j'},
       {"freeze-time", no_argument, 0, 'f'},
+      {"nvm-dir", required_argument, 0, 'n'},
+      {"replay", required_argument, 0, 'r'},
+      {"log-level", required_argument, 0, 'l'},
+      {"log-ring", required_argument, 0, 'g'},
+      {"ieee", required_argument, 0, 'i'},
       {"help", no_argument, 0, 'h'},
       {0, 0, 0, 0}};
 
   char device_conf_buf[APP_DEVICE_CONF_MAX];
   device_conf_buf[0] = '\0';
   bool joined = true;
+  const char *replay_path = NULL;
   for (;;) {
-    int opt = getopt_long(argc, argv, "d:j:f:h", long_opts, NULL);
+    int opt = getopt_long(argc, argv, "d:j:f:n:r:l:g:i:h", long_opts, NULL);
     if (opt == -1)
       break;
     switch (opt) {
@@ -55,6 +72,30 @@ int main(int argc, char **argv) {
     case 'f':
       stub_millis_freeze();
       break;
+    case 'n':
+      stub_nvm_set_data_dir(optarg);
+      break;
+    case 'r':
+      replay_path = optarg;
+      break;
+    case 'l': {
+      int level = io_log_parse_level(optarg);
+      if (level < 0) {
+        print_usage(argv[0]);
+        return 1;
+      }
+      io_log_set_level(NULL, (io_log_level_t)level);
+      break;
+    }
+    case 'g':
+      if (!io_log_capture((uint32_t)strtoul(optarg, NULL, 10))) {
+        print_usage(argv[0]);
+        return 1;
+      }
+      break;
+    case 'i':
+      stub_zigbee_set_ieee_address(strtoull(optarg, NULL, 16));
+      break;
     case 'h':
     default:
       print_usage(argv[0]);
@@ -64,6 +105,21 @@ int main(int argc, char **argv) {
 
   stub_app_init(device_conf_buf[0] ? device_conf_buf : NULL, joined);
 
+  if (replay_path) {
+    // Timeline on stdout as machine events, no REPL
+    g_machine_mode = true;
+    trace_replay_result_t result;
+    bool ok = trace_replay_file(replay_path, 0, &result);
+    if (ok) {
+      io_res_ok("records=%u duration_ms=%u", result.records,
+                result.duration_ms);
+    } else {
+      io_res_err("bad_trace line=%u", result.error_line);
+    }
+    stub_app_shutdown();
+    return ok ? 0 : 1;
+  }
+
   puts("[STUB] Entering interactive mode. Type 'h' for help.");
   commands_print_help(); // auto-generated from table
 
@@ -73,6 +129,7 @@ int main(int argc, char **argv) {
       .poll_cb = poll_wrapper,
       .poll_user = NULL,
       .should_exit = &g_should_exit,
+      .input_cb = machine_proto_input,
   };
   (void)simple_repl_run(&cfg);
 
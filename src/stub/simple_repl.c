@@ -104,6 +104,14 @@ int simple_repl_run(const SimpleReplConfig *cfg) {
       continue; /* on timeout or EINTR */
     }
 
+    if (cfg->input_cb) {
+      int handled = cfg->input_cb(cfg);
+      if (handled < 0)
+        break;
+      if (handled > 0)
+        continue;
+    }
+
     if (!fgets(line, sizeof line, stdin)) {
       if (feof(stdin)) {
         if (tty)
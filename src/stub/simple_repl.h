@@ -12,7 +12,7 @@ typedef struct
     repl_cmd_fn fn;
 } SimpleReplCommand;
 
-typedef struct
+typedef struct SimpleReplConfig
 {
     const SimpleReplCommand *commands;
     size_t command_count;
@@ -21,6 +21,11 @@ typedef struct
     void *poll_user;
 
     volatile sig_atomic_t *should_exit;
+
+    /* Optional reader taking over stdin, e.g. for a binary protocol. Returns
+     * 1 when it consumed the pending input, 0 to read a text line instead and
+     * -1 at end of input. */
+    int (*input_cb)(const struct SimpleReplConfig *cfg);
 } SimpleReplConfig;
 
 int simple_repl_run(const SimpleReplConfig *cfg);
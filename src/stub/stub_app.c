@@ -7,6 +7,7 @@
 #include "base_components/led.h"
 #include "base_components/network_indicator.h"
 #include "base_components/relay.h"
+#include "device_config/config_compiler.h"
 #include "device_config/config_nv.h"
 #include "device_config/config_parser.h"
 #include "device_config/nvm_items.h"
@@ -24,35 +25,30 @@
 #include "zigbee/switch_cluster.h"
 
 // externs from your codebase
-extern led_t leds[5];
+extern led_t leds[DEVICE_CONFIG_MAX_LEDS];
 extern uint8_t leds_cnt;
-extern button_t buttons[5];
+extern button_t buttons[DEVICE_CONFIG_MAX_BUTTONS];
 extern uint8_t buttons_cnt;
-extern relay_t relays[5];
+extern relay_t relays[DEVICE_CONFIG_MAX_RELAYS];
 extern uint8_t relays_cnt;
 
-static device_config_str_t g_stub_config = {
-    .size = 0, .data = "Stub;Stub;SA0u;SA1u;SA2u;SA3u;RB0;RB1;RC0;RC1;"};
+static const char g_stub_default_config[] =
+    "Stub;Stub;SA0u;SA1u;SA2u;SA3u;RB0;RB1;RC0;RC1;";
 
 void stub_app_init(const char *device_conf, bool joined) {
   puts("[STUB] Starting Smart Home Device Stub");
 
-  bool nvm_has_config = false;
-  if (hal_nvm_read(NV_ITEM_DEVICE_CONFIG, sizeof(device_config_str_t),
-                   (uint8_t *)&g_stub_config) == HAL_NVM_SUCCESS) {
-    nvm_has_config = true;
-  }
+  uint16_t stored_size = 0;
+  bool nvm_has_config = hal_nvm_get_size(NV_ITEM_DEVICE_CONFIG,
+                                         &stored_size) == HAL_NVM_SUCCESS;
 
-  if (device_conf) {
-    snprintf((char *)g_stub_config.data, sizeof(g_stub_config.data), "%s",
-             device_conf);
-  }
   if (device_conf || !nvm_has_config) {
-    printf("[STUB] Using device configuration: %s\n", g_stub_config.data);
-    g_stub_config.size = (uint16_t)strnlen((const char *)g_stub_config.data,
-                                           sizeof(g_stub_config.data));
-    hal_nvm_write(NV_ITEM_DEVICE_CONFIG, sizeof(device_config_str_t),
-                  (uint8_t *)&g_stub_config);
+    snprintf((char *)device_config_str.data, sizeof(device_config_str.data),
+             "%s", device_conf ? device_conf : g_stub_default_config);
+    printf("[STUB] Using device configuration: %s\n", device_config_str.data);
+    device_config_str.size = (uint16_t)strnlen(
+        (const char *)device_config_str.data, sizeof(device_config_str.data));
+    device_config_write_to_nv();
   }
 
   puts("[STUB] Initializing stub application");
@@ -71,6 +67,30 @@ void stub_app_init(const char *device_conf, bool joined) {
   puts("[STUB] Application initialized");
 }
 
+void stub_app_reset(const char *device_conf, bool joined, bool frozen,
+                    bool keep_nvm) {
+  puts("[STUB] Resetting device state");
+  // Pending tasks point into the firmware tables, drop them first
+  stub_tasks_reset();
+  stub_gpio_reset();
+  stub_zigbee_reset(keep_nvm);
+  stub_ota_reset();
+  stub_millis_reset(frozen);
+  stub_system_reset();
+  if (!keep_nvm) {
+    hal_nvm_clear_all();
+  }
+  stub_nvm_reset_write_count();
+  app_reset_state();
+
+  // A fresh process runs its main loop once before machine mode is enabled,
+  // nothing of that is reported
+  io_evt_unsubscribe_all();
+  stub_app_init(device_conf, joined);
+  stub_app_poll();
+  io_evt_subscribe(0, NULL);
+}
+
 void stub_app_shutdown() {
   puts("[STUB] Cleaning up...");
   stub_zigbee_clear_bindings();
@@ -82,10 +102,20 @@ void stub_app_poll() {
   stub_tasks_poll();
 }
 
+void stub_app_advance(uint32_t ms) {
+  // One millisecond at a time so tasks run at their scheduled time
+  for (uint32_t i = 0; i < ms; i++) {
+    stub_millis_step(1);
+    stub_app_poll();
+  }
+}
+
 void stub_app_print_help(void) {
   puts("Stub Smart Home Device Simulator");
   puts("Commands:");
-  puts("  machine on|off                        - Set machine mode");
+  puts("  machine on|off|bin                    - Set machine mode, bin "
+       "switches to binary frames");
+  puts("  subscribe all|none|<kind>...          - Filter machine events");
   puts("  help                                  - Show this help");
   puts("  s, status                             - Show device status");
   puts(
@@ -100,6 +130,17 @@ void stub_app_print_help(void) {
        "bytes)");
   puts("  freeze_time <0|1>                     - Freeze/unfreeze time");
   puts("  step_time <ms>                        - Advance time by ms");
+  puts("  replay <file> [settle_ms]             - Replay an input trace in "
+       "virtual time");
+  puts("  wave <pin> bounce|glitch|hum [k=v]... - Play input noise, report "
+       "debounce stats");
+  puts("  stats [reset]                         - Task, NVM and CPU usage, "
+       "reset starts a new window");
+  puts("  log [level <lvl> [cat] | ring <n> | dump | clear]");
+  puts("                                        - Log levels (trace..off) and "
+       "ring capture");
+  puts("  reset [--config <str>] [--not-joined] [--freeze-time] [--keep-nvm]");
+  puts("                                        - Restart the device in place");
   puts("  q, quit                               - Exit");
 }
 
@@ -166,6 +207,15 @@ const char *stub_app_attribute_value_to_string(hal_zigbee_attribute *attr,
       buf[0] = '\0';
     }
     break;
+  case ZCL_DATA_TYPE_UINT32:
+    if (attr->size >= 4) {
+      uint32_t val = attr->value[0] | (attr->value[1] << 8) |
+                     (attr->value[2] << 16) | ((uint32_t)attr->value[3] << 24);
+      snprintf(buf, bufsize, "%u", val);
+    } else {
+      buf[0] = '\0';
+    }
+    break;
   case ZCL_DATA_TYPE_CHAR_STR: {
     if (attr->size >= 1) {
       uint8_t len = attr->value[0];
@@ -209,7 +259,7 @@ int stub_app_string_to_attribute_value(hal_zigbee_attribute *attr,
     return -1;
 
   if (attr->flag == ATTR_READONLY) {
-    io_log("ZIGBEE", "Warning: Writing to read-only attribute\n");
+    io_log_warn("ZIGBEE", "Warning: Writing to read-only attribute\n");
   }
 
   switch (attr->data_type_id) {
@@ -236,6 +286,17 @@ int stub_app_string_to_attribute_value(hal_zigbee_attribute *attr,
       return -3;
     break;
   }
+  case ZCL_DATA_TYPE_UINT32: {
+    unsigned int v = 0;
+    if (sscanf(str, "%u", &v) != 1)
+      return -2;
+    if (attr->size >= 4) {
+      for (int i = 0; i < 4; i++)
+        attr->value[i] = (uint8_t)((v >> (8 * i)) & 0xFF);
+    } else
+      return -3;
+    break;
+  }
   case ZCL_DATA_TYPE_CHAR_STR: {
     size_t len = strlen(str);
     if (attr->size < 1)
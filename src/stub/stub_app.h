@@ -10,9 +10,18 @@
 void stub_app_init(const char *device_conf_or_null, bool joined);
 void stub_app_shutdown(void);
 
+/* rebuilds all device state in place, as if the process had just started
+   with these options and run its first poll; NVM is wiped unless keep_nvm.
+   Event subscriptions are back to all events. */
+void stub_app_reset(const char *device_conf_or_null, bool joined, bool frozen,
+                    bool keep_nvm);
+
 /* polling (1ms cadence via REPL) */
 void stub_app_poll(void);
 
+/* advances frozen time ms by ms, running everything due on the way */
+void stub_app_advance(uint32_t ms);
+
 /* UI helpers */
 void stub_app_print_help(void);
 void stub_app_show_status(void);
@@ -0,0 +1,217 @@
+#include "switchcore.h"
+
+#include "hal/timer.h"
+#include "hal/zigbee.h"
+#include "hal/zigbee_ota.h"
+#include "machine_io.h"
+#include "stub/hal/stub.h"
+#include "stub_app.h"
+#include <setjmp.h>
+#include <string.h>
+
+#define MAX_EVT_KIND_LEN 32
+#define MAX_ZCL_PAYLOAD 64
+
+static bool created = false;
+static bool boot_joined = true;
+static switchcore_event_cb_t event_cb = NULL;
+static void *event_user = NULL;
+
+// hal_system_reset() unwinds here from anywhere inside the firmware
+static jmp_buf reset_jmp;
+
+// Runs stmt, or restarts the device if the firmware reset on the way
+#define GUARDED(stmt)                                                          \
+  do {                                                                         \
+    if (setjmp(reset_jmp) == 0) {                                              \
+      stmt;                                                                    \
+    } else {                                                                   \
+      reboot();                                                                \
+    }                                                                          \
+  } while (0)
+
+static void deliver_event(const char *text, uint32_t t_ms) {
+  if (!event_cb)
+    return;
+  char kind[MAX_EVT_KIND_LEN];
+  size_t len = strcspn(text, " ");
+  if (len >= sizeof(kind))
+    len = sizeof(kind) - 1;
+  memcpy(kind, text, len);
+  kind[len] = '\0';
+
+  const char *args = text + strcspn(text, " ");
+  while (*args == ' ')
+    args++;
+  event_cb(kind, args, t_ms, event_user);
+}
+
+// Like a power cycle: NVM survives, the clock restarts
+static void reboot(void) {
+  uint32_t t_ms = hal_millis();
+  stub_app_reset(NULL, boot_joined, true, true);
+  deliver_event("reboot", t_ms);
+}
+
+int switchcore_create(const char *device_config, const char *nvm_dir,
+                      bool joined) {
+  if (created)
+    return -1;
+  created = true;
+  boot_joined = joined;
+
+  g_machine_mode = true;
+  g_evt_sink = deliver_event;
+  stub_system_set_reset_target(&reset_jmp);
+  stub_nvm_set_data_dir(nvm_dir);
+  // Same path as an in-place reset, so a destroyed device leaves nothing
+  GUARDED(stub_app_reset(device_config, joined, true, true));
+  return 0;
+}
+
+int switchcore_reset(const char *device_config, bool joined, bool keep_nvm) {
+  if (!created)
+    return -1;
+  boot_joined = joined;
+  GUARDED(stub_app_reset(device_config, joined, true, keep_nvm));
+  return 0;
+}
+
+void switchcore_destroy(void) {
+  if (!created)
+    return;
+  stub_app_shutdown();
+  stub_zigbee_reset(false); // The next device starts factory new
+  stub_ota_serve(NULL, 0);
+  hal_ota_partial_clear();
+  stub_ota_set_running_image(NULL, 0);
+  stub_zigbee_set_send_fail(false);
+  stub_system_set_reset_target(NULL);
+  g_evt_sink = NULL;
+  g_machine_mode = false;
+  created = false;
+}
+
+void switchcore_set_event_callback(switchcore_event_cb_t cb, void *user) {
+  event_cb = cb;
+  event_user = user;
+}
+
+int switchcore_set_gpio(uint8_t pin, uint8_t value) {
+  if (!created || value > 1)
+    return -1;
+  GUARDED(stub_gpio_simulate_input(pin, value));
+  return 0;
+}
+
+int switchcore_get_gpio(uint8_t pin) {
+  if (!created)
+    return -1;
+  return stub_gpio_get_output(pin);
+}
+
+int switchcore_zcl_cmd(uint8_t endpoint, uint16_t cluster, uint8_t command,
+                       const uint8_t *payload, size_t len) {
+  if (!created || len > MAX_ZCL_PAYLOAD || (len && !payload))
+    return -1;
+  // Handlers may parse past the payload, like the zcl_cmd command buffer
+  uint8_t buf[MAX_ZCL_PAYLOAD] = {0};
+  if (len)
+    memcpy(buf, payload, len);
+  volatile int result = HAL_ZIGBEE_CMD_SKIPPED;
+  GUARDED(result = stub_zigbee_simulate_command(endpoint, cluster, command,
+                                                len ? buf : NULL));
+  return result;
+}
+
+int switchcore_set_network(uint8_t status) {
+  if (!created || status > HAL_ZIGBEE_NETWORK_JOINING)
+    return -1;
+  GUARDED(stub_zigbee_set_network_status((hal_zigbee_network_status_t)status));
+  return 0;
+}
+
+void switchcore_set_ieee_address(uint64_t addr) {
+  stub_zigbee_set_ieee_address(addr);
+}
+
+void switchcore_set_coordinator_channel(uint8_t channel) {
+  stub_zigbee_set_coordinator_channel(channel);
+}
+
+void switchcore_set_send_fail(bool fail) { stub_zigbee_set_send_fail(fail); }
+
+int switchcore_ota_serve(const uint8_t *file, size_t len) {
+  if (file && len > UINT32_MAX)
+    return -1;
+  volatile bool ok = false;
+  GUARDED(ok = stub_ota_serve(file, (uint32_t)len));
+  return ok ? 0 : -1;
+}
+
+int switchcore_ota_set_running_image(const uint8_t *image, size_t len) {
+  if (image && len > hal_ota_slot_size())
+    return -1;
+  stub_ota_set_running_image(image, (uint32_t)len);
+  return 0;
+}
+
+int switchcore_ota_read_slot(uint32_t offset, uint8_t *buf, size_t len) {
+  if (offset > hal_ota_slot_size() || len > hal_ota_slot_size() - offset)
+    return -1;
+  hal_ota_slot_read(offset, buf, (uint32_t)len);
+  return 0;
+}
+
+int switchcore_write_attr(uint8_t endpoint, uint16_t cluster, uint16_t attr,
+                          const char *value) {
+  if (!created)
+    return -1;
+  hal_zigbee_attribute *attribute = stub_app_find_attr(endpoint, cluster, attr);
+  if (!attribute || stub_app_string_to_attribute_value(attribute, value) != 0)
+    return -1;
+  GUARDED(stub_simulate_zigbee_attribute_write(endpoint, cluster, attr));
+  return 0;
+}
+
+int switchcore_read_attr(uint8_t endpoint, uint16_t cluster, uint16_t attr,
+                         char *buf, size_t size) {
+  if (!created || size == 0)
+    return -1;
+  hal_zigbee_attribute *attribute = stub_app_find_attr(endpoint, cluster, attr);
+  if (!attribute)
+    return -1;
+  const char *text = stub_app_attribute_value_to_string(attribute, buf, size);
+  if (text != buf) {
+    strncpy(buf, text, size - 1);
+    buf[size - 1] = '\0';
+  }
+  return 0;
+}
+
+uint32_t switchcore_advance(uint32_t ms) {
+  if (!created)
+    return 0;
+  volatile uint32_t reboots = 0;
+  // Same stepping as stub_app_advance(), guarded per millisecond
+  for (volatile uint32_t i = 0; i < ms; i++) {
+    if (setjmp(reset_jmp) == 0) {
+      stub_millis_step(1);
+      stub_app_poll();
+    } else {
+      reboot();
+      reboots++;
+    }
+  }
+  return reboots;
+}
+
+int switchcore_set_log_level(const char *category, const char *level) {
+  int parsed = level ? io_log_parse_level(level) : -1;
+  if (parsed < 0)
+    return -1;
+  io_log_set_level(category, (io_log_level_t)parsed);
+  return 0;
+}
+
+uint32_t switchcore_millis(void) { return hal_millis(); }
@@ -0,0 +1,175 @@
+#ifndef SWITCHCORE_H
+#define SWITCHCORE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * C embedding API of libswitchcore.so, the firmware core on the stub HAL
+ * without the REPL (`make stub/lib`).
+ *
+ * The firmware keeps its state in globals, so there is one device per
+ * process. Time is virtual and only moves in switchcore_advance(). Events are
+ * the ones of the stub machine protocol, delivered to a callback. A reboot of
+ * the firmware restarts the device in place with its NVM and reports a
+ * "reboot" event.
+ */
+
+#define SWITCHCORE_API __attribute__((visibility("default")))
+
+/**
+ * Receives every event
+ * @param kind Event kind, e.g. "gpio" or "zcl_attr_change"
+ * @param args key=value pairs separated by spaces, may be empty
+ * @param t_ms Device time of the event
+ * @param user Pointer given to switchcore_set_event_callback()
+ */
+typedef void (*switchcore_event_cb_t)(const char *kind, const char *args,
+                                      uint32_t t_ms, void *user);
+
+/**
+ * Boots the device at time 0
+ * @param device_config Config string, NULL for the stored or default one
+ * @param nvm_dir NVM directory, NULL for ./stub_nvm_data
+ * @param joined Whether the device starts joined to a network
+ * @return 0 on success, -1 if the device already exists
+ */
+SWITCHCORE_API int switchcore_create(const char *device_config,
+                                     const char *nvm_dir, bool joined);
+
+/**
+ * Restarts the device in place at time 0, like a new process
+ * @param device_config Config string, NULL for the stored or default one
+ * @param joined Whether the device starts joined to a network
+ * @param keep_nvm Keep NVM contents, otherwise they are wiped
+ * @return 0 on success, -1 without a device
+ */
+SWITCHCORE_API int switchcore_reset(const char *device_config, bool joined,
+                                    bool keep_nvm);
+
+/** Stops the device, switchcore_create() may be called again */
+SWITCHCORE_API void switchcore_destroy(void);
+
+/**
+ * Sets the event callback, NULL to drop events
+ * @param cb Callback, called synchronously from the API functions
+ * @param user Passed to every call of cb
+ */
+SWITCHCORE_API void switchcore_set_event_callback(switchcore_event_cb_t cb,
+                                                  void *user);
+
+/**
+ * Drives a GPIO input, edges run the pin callback immediately
+ * @param pin Pin number, port * 16 + pin (A0 = 0, B0 = 16)
+ * @param value Electrical level, 0 or 1
+ * @return 0 on success, -1 for a bad value or without a device
+ */
+SWITCHCORE_API int switchcore_set_gpio(uint8_t pin, uint8_t value);
+
+/**
+ * Reads a GPIO level
+ * @param pin Pin number, port * 16 + pin
+ * @return Level 0 or 1, -1 without a device
+ */
+SWITCHCORE_API int switchcore_get_gpio(uint8_t pin);
+
+/**
+ * Delivers a ZCL command to an endpoint, as if received from the network
+ * @param payload Command payload, may be NULL when len is 0
+ * @param len Payload length, at most 64 bytes
+ * @return hal_zigbee_cmd_result_t value, -1 for bad arguments
+ */
+SWITCHCORE_API int switchcore_zcl_cmd(uint8_t endpoint, uint16_t cluster,
+                                      uint8_t command, const uint8_t *payload,
+                                      size_t len);
+
+/**
+ * Changes the network status, as the stack would
+ * @param status hal_zigbee_network_status_t value
+ * @return 0 on success, -1 for a bad status or without a device
+ */
+SWITCHCORE_API int switchcore_set_network(uint8_t status);
+
+/**
+ * Sets the IEEE address the device boots with, by default a fixed one
+ * @param addr Address, applies from the next create or reset
+ */
+SWITCHCORE_API void switchcore_set_ieee_address(uint64_t addr);
+
+/**
+ * Moves the simulated coordinator, rejoins only find it on its channel.
+ * Resets that keep NVM keep the joined network, booting not joined then
+ * plays a power cycle that needs a rejoin.
+ * @param channel Channel 11-26, 0 turns the coordinator off
+ */
+SWITCHCORE_API void switchcore_set_coordinator_channel(uint8_t channel);
+
+/**
+ * Makes sends to bindings fail, as with a full APS queue
+ * @param fail true until sends should go through again
+ */
+SWITCHCORE_API void switchcore_set_send_fail(bool fail);
+
+/**
+ * Offers an OTA file from the simulated server. The client downloads it block
+ * by block while joined, reports an "ota_complete" event and the server then
+ * withdraws the offer. A reboot restarts the download.
+ * @param file Zigbee OTA file, NULL withdraws the offer
+ * @return 0 on success, -1 if the file has no upgrade image
+ */
+SWITCHCORE_API int switchcore_ota_serve(const uint8_t *file, size_t len);
+
+/**
+ * Sets the firmware the device runs, delta OTA images are patches against it.
+ * It stays over reboots.
+ * @param image Firmware, NULL clears it
+ * @return 0 on success, -1 if too large
+ */
+SWITCHCORE_API int switchcore_ota_set_running_image(const uint8_t *image,
+                                                    size_t len);
+
+/**
+ * Reads the OTA slot the client downloads to
+ * @param offset Start in the slot
+ * @return 0 on success, -1 past the end of the slot
+ */
+SWITCHCORE_API int switchcore_ota_read_slot(uint32_t offset, uint8_t *buf,
+                                            size_t len);
+
+/**
+ * Writes an attribute, as if written from the network
+ * @param value Value in the format of the stub zcl_write command
+ * @return 0 on success, -1 for an unknown attribute or bad value
+ */
+SWITCHCORE_API int switchcore_write_attr(uint8_t endpoint, uint16_t cluster,
+                                         uint16_t attr, const char *value);
+
+/**
+ * Reads an attribute as text, in the format of the stub zcl_read command
+ * @param buf Receives the NUL terminated value
+ * @return 0 on success, -1 for an unknown attribute
+ */
+SWITCHCORE_API int switchcore_read_attr(uint8_t endpoint, uint16_t cluster,
+                                        uint16_t attr, char *buf, size_t size);
+
+/**
+ * Advances virtual time, running every task at its scheduled millisecond
+ * @param ms Time to advance
+ * @return Number of reboots on the way
+ */
+SWITCHCORE_API uint32_t switchcore_advance(uint32_t ms);
+
+/**
+ * Sets the stub log level, logs go to stderr
+ * @param category Category such as "GPIO" or "FW", NULL for all of them
+ * @param level "trace", "debug", "info", "warn", "error" or "off"
+ * @return 0 on success, -1 for an unknown level
+ */
+SWITCHCORE_API int switchcore_set_log_level(const char *category,
+                                            const char *level);
+
+/** @return Current device time in milliseconds */
+SWITCHCORE_API uint32_t switchcore_millis(void);
+
+#endif
@@ -0,0 +1,136 @@
+#include "trace_replay.h"
+
+#include "hal/gpio.h"
+#include "hal/timer.h"
+#include "machine_io.h"
+#include "stub/hal/stub.h"
+#include "stub_app.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_TRACE_LINE 512
+#define MAX_TRACE_TOKENS 72
+#define MAX_TRACE_PAYLOAD 64
+
+static int split_tokens(char *line, char **tokens) {
+  int count = 0;
+  char *p = line;
+  while (*p && count < MAX_TRACE_TOKENS) {
+    while (*p && isspace((unsigned char)*p))
+      p++;
+    if (!*p || *p == '#')
+      break;
+    tokens[count++] = p;
+    while (*p && !isspace((unsigned char)*p))
+      p++;
+    if (*p)
+      *p++ = '\0';
+  }
+  return count;
+}
+
+static bool parse_hex(const char *s, unsigned long max, unsigned long *out) {
+  char *e = NULL;
+  unsigned long v = strtoul(s, &e, 16);
+  if (*s == '\0' || *e || v > max)
+    return false;
+  *out = v;
+  return true;
+}
+
+static bool replay_gpio(int argc, char **argv) {
+  if (argc != 4 || (strcmp(argv[3], "0") && strcmp(argv[3], "1")))
+    return false;
+  hal_gpio_pin_t pin = hal_gpio_parse_pin(argv[2]);
+  if (pin == HAL_INVALID_PIN)
+    return false;
+  stub_gpio_simulate_input(pin, argv[3][0] - '0');
+  return true;
+}
+
+static bool replay_zcl(int argc, char **argv) {
+  unsigned long ep, cluster, cmd;
+  if (argc < 5 || argc - 5 > MAX_TRACE_PAYLOAD ||
+      !parse_hex(argv[3], 0xFFFF, &cluster) ||
+      !parse_hex(argv[4], 0xFF, &cmd)) {
+    return false;
+  }
+  char *e = NULL;
+  ep = strtoul(argv[2], &e, 10);
+  if (*e || ep == 0 || ep > 0xFF)
+    return false;
+
+  uint8_t payload[MAX_TRACE_PAYLOAD];
+  for (int i = 5; i < argc; i++) {
+    unsigned long byte;
+    if (!parse_hex(argv[i], 0xFF, &byte))
+      return false;
+    payload[i - 5] = (uint8_t)byte;
+  }
+  stub_zigbee_simulate_command((uint8_t)ep, (uint16_t)cluster, (uint8_t)cmd,
+                               argc > 5 ? payload : NULL);
+  return true;
+}
+
+bool trace_replay_file(const char *path, uint32_t settle_ms,
+                       trace_replay_result_t *result) {
+  memset(result, 0, sizeof(*result));
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    io_log_warn("REPLAY", "Cannot open trace %s", path);
+    return false;
+  }
+
+  // Trace time is virtual, whatever the clock was doing before
+  stub_millis_freeze();
+  uint32_t elapsed_ms = 0;
+  uint32_t line_no = 0;
+  char line[MAX_TRACE_LINE];
+  char *tokens[MAX_TRACE_TOKENS];
+
+  while (fgets(line, sizeof(line), file)) {
+    line_no++;
+    int argc = split_tokens(line, tokens);
+    if (argc == 0)
+      continue;
+
+    char *e = NULL;
+    unsigned long long t_us = strtoull(tokens[0], &e, 10);
+    uint32_t t_ms = (uint32_t)(t_us / 1000);
+    if (argc < 2 || *e || t_ms < elapsed_ms) {
+      result->error_line = line_no;
+      break;
+    }
+    stub_app_advance(t_ms - elapsed_ms);
+    elapsed_ms = t_ms;
+
+    bool ok = false;
+    if (strcmp(tokens[1], "gpio") == 0) {
+      ok = replay_gpio(argc, tokens);
+    } else if (strcmp(tokens[1], "zcl") == 0) {
+      ok = replay_zcl(argc, tokens);
+    } else if (strcmp(tokens[1], "wait") == 0) {
+      ok = argc == 2;
+    }
+    if (!ok) {
+      result->error_line = line_no;
+      break;
+    }
+    result->records++;
+  }
+  fclose(file);
+
+  if (result->error_line) {
+    io_log_warn("REPLAY", "Bad trace record at %s:%u", path,
+                result->error_line);
+    return false;
+  }
+
+  stub_app_advance(settle_ms);
+  result->duration_ms = elapsed_ms + settle_ms;
+  io_log("REPLAY", "Replayed %u records over %u ms", result->records,
+         result->duration_ms);
+  return true;
+}
@@ -0,0 +1,37 @@
+#ifndef TRACE_REPLAY_H
+#define TRACE_REPLAY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Replays a recorded input trace in virtual time. One record per line,
+ * timestamps in microseconds from the start of the replay, non-decreasing:
+ *
+ *   # comment
+ *   <t_us> gpio <pin> <0|1>                      electrical input level
+ *   <t_us> zcl <ep> <cluster:hex> <cmd:hex> [payload bytes:hex...]
+ *   <t_us> wait                                  only advances time
+ *
+ * Time advances one millisecond at a time, so several edges inside the same
+ * millisecond (contact bounce) are applied back to back. Outputs, reports and
+ * NVM writes show up as regular events, which form the replay timeline.
+ */
+
+typedef struct {
+  uint32_t records;
+  uint32_t duration_ms;
+  uint32_t error_line; // 0 when the whole trace was replayed
+} trace_replay_result_t;
+
+/**
+ * Replays a trace file, then keeps running for settle_ms
+ * @param path Trace file
+ * @param settle_ms Time to run after the last record
+ * @param result Filled with replay statistics or the failing line
+ * @return true if the whole trace was replayed
+ */
+bool trace_replay_file(const char *path, uint32_t settle_ms,
+                       trace_replay_result_t *result);
+
+#endif
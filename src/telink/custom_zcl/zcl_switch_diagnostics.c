@@ -0,0 +1,11 @@
+#pragma pack(push, 1)
+#include "zcl_include.h"
+#include "zcl_switch_diagnostics.h"
+#pragma pack(pop)
+
+_CODE_ZCL_ status_t zcl_switch_diagnostics_register(
+    u8 endpoint, u16 manuCode, u8 attrNum, const zclAttrInfo_t attrTbl[],
+    cluster_forAppCb_t cb) {
+  return (zcl_registerCluster(endpoint, ZCL_CLUSTER_MANU_SWITCH_DIAGNOSTICS,
+                              manuCode, attrNum, attrTbl, NULL, cb));
+}
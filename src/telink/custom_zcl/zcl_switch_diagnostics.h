@@ -0,0 +1,15 @@
+#ifndef ZCL_SWITCH_DIAGNOSTICS_H
+#define ZCL_SWITCH_DIAGNOSTICS_H
+
+#include "zcl_include.h"
+
+// ZCL_CLUSTER_SWITCH_DIAGNOSTICS of zigbee/consts.h, which clashes with the
+// SDK headers
+#define ZCL_CLUSTER_MANU_SWITCH_DIAGNOSTICS 0xFCA0
+
+status_t zcl_switch_diagnostics_register(u8 endpoint, u16 manuCode,
+                                         u8 attrNum,
+                                         const zclAttrInfo_t attrTbl[],
+                                         cluster_forAppCb_t cb);
+
+#endif /* ZCL_SWITCH_DIAGNOSTICS_H */
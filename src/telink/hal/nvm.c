@@ -1,4 +1,5 @@
 #include "hal/nvm.h"
+#include "hal/tlog.h"
 #pragma pack(push, 1)
 #include "tl_common.h"
 #pragma pack(pop)
@@ -17,18 +18,18 @@ static hal_nvm_status_t telink_to_hal_status(nv_sts_t telink_status) {
 }
 
 hal_nvm_status_t hal_nvm_write(uint8_t item_id, uint16_t size, uint8_t *data) {
-  printf("Writing to NV item %d, size %d\r\n", item_id, size);
+  TLOG("Writing to NV item %d, size %d\r\n", item_id, size);
   if (data == NULL) {
     return HAL_NVM_ERROR;
   }
 
   nv_sts_t status = nv_flashWriteNew(1, NV_MODULE_APP, item_id, size, data);
-  printf("Write status: %d\r\n", status);
+  TLOG("Write status: %d\r\n", status);
   return telink_to_hal_status(status);
 }
 
 hal_nvm_status_t hal_nvm_read(uint8_t item_id, uint16_t size, uint8_t *data) {
-  printf("Reading from NV item %d, size %d\r\n", item_id, size);
+  TLOG("Reading from NV item %d, size %d\r\n", item_id, size);
   if (data == NULL) {
     return HAL_NVM_ERROR;
   }
@@ -37,6 +38,15 @@ hal_nvm_status_t hal_nvm_read(uint8_t item_id, uint16_t size, uint8_t *data) {
   return telink_to_hal_status(status);
 }
 
+hal_nvm_status_t hal_nvm_get_size(uint8_t item_id, uint16_t *size) {
+  if (size == NULL) {
+    return HAL_NVM_ERROR;
+  }
+
+  nv_sts_t status = nv_flashSingleItemSizeGet(NV_MODULE_APP, item_id, size);
+  return telink_to_hal_status(status);
+}
+
 hal_nvm_status_t hal_nvm_delete(uint8_t item_id) {
   // First, get the size of the item to delete
   uint16_t item_size = 0;
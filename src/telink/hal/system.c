@@ -11,4 +11,10 @@ void hal_system_reset(void) {
   mcu_reset();
 }
 
-void hal_factory_reset(void) { zb_factoryReset(); }
\ No newline at end of file
+void hal_factory_reset(void) { zb_factoryReset(); }
+
+// The TLSR8258 boots the same way after power on, software and watchdog
+// resets, drv_platform_init() only tells deep sleep wake-ups apart
+hal_reset_reason_t hal_system_get_reset_reason(void) {
+  return HAL_RESET_REASON_UNKNOWN;
+}
@@ -1,8 +1,12 @@
 #include "hal/tasks.h"
+#include "base_components/diagnostics.h"
 #pragma pack(push, 1)
 #include "tl_common.h"
 #pragma pack(pop)
 
+// Tasks with a pending timer, for the diagnostics peak
+static uint16_t scheduled_cnt = 0;
+
 // Wrapper callback to adapt between Telink's int return signature and HAL's
 // void signature
 static int _telink_task_wrapper(void *data) {
@@ -10,6 +14,7 @@ static int _telink_task_wrapper(void *data) {
 
   // Clear the timer handle since it's now executed
   task->platform_struct.ev_timer_handle = NULL;
+  scheduled_cnt--;
 
   // Call the HAL task handler
   task->handler(task->arg);
@@ -27,6 +32,7 @@ void hal_tasks_schedule(hal_task_t *task, uint32_t delay_ms) {
   // Cancel any existing scheduled task
   if (task->platform_struct.ev_timer_handle != NULL) {
     ev_timer_taskCancel(&task->platform_struct.ev_timer_handle);
+    scheduled_cnt--;
   }
 
   // Schedule new task using Telink's event timer system
@@ -35,11 +41,15 @@ void hal_tasks_schedule(hal_task_t *task, uint32_t delay_ms) {
                         task,                 // Pass the hal_task_t as argument
                         delay_ms              // Delay in milliseconds
       );
+  if (task->platform_struct.ev_timer_handle != NULL) {
+    diagnostics_tasks_scheduled(++scheduled_cnt);
+  }
 }
 
 void hal_tasks_unschedule(hal_task_t *task) {
   // Cancel the scheduled task if it exists
   if (task->platform_struct.ev_timer_handle != NULL) {
     ev_timer_taskCancel(&task->platform_struct.ev_timer_handle);
+    scheduled_cnt--;
   }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "device_config/capacities.h"
 #include "hal/zigbee.h"
 
 #pragma pack(push, 1)
@@ -9,9 +10,9 @@
 #pragma pack(pop)
 
 // Shared constants
-#define MAX_ENDPOINTS 8
-#define MAX_IN_CLUSTERS 32
-#define MAX_OUT_CLUSTERS 32
+#define MAX_ENDPOINTS DEVICE_CONFIG_MAX_ENDPOINTS
+#define MAX_IN_CLUSTERS DEVICE_CONFIG_MAX_CLUSTERS
+#define MAX_OUT_CLUSTERS DEVICE_CONFIG_MAX_CLUSTERS
 #define MAX_ATTRS 128
 #define OTA_QUERY_INTERVAL 15 * 60 // 15 minutes
 
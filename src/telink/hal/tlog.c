@@ -0,0 +1,110 @@
+#include "hal/tlog.h"
+
+#ifdef TLOG_TOKENIZED
+
+#pragma pack(push, 1)
+#include "tl_common.h"
+#pragma pack(pop)
+#include <stdint.h>
+
+// Frame on the wire: TLOG_FRAME_START, nargs, token (u32), args (u32 each),
+// all little endian. Plain printf text may be interleaved, it never contains
+// the start byte.
+#define TLOG_FRAME_START 0xFE
+#define TLOG_DROPPED_TOKEN 0
+
+// Words, one entry takes 2 + nargs
+#define TLOG_RING_WORDS 256
+
+extern int putchar(int c);
+
+static uint32_t ring[TLOG_RING_WORDS];
+static uint16_t head;
+static uint16_t tail;
+static uint16_t used;
+static uint16_t queued;
+static uint16_t dropped;
+
+static void ring_push(uint32_t word) {
+  ring[head] = word;
+  head = (head + 1) % TLOG_RING_WORDS;
+  used++;
+}
+
+static uint32_t ring_pop(void) {
+  uint32_t word = ring[tail];
+  tail = (tail + 1) % TLOG_RING_WORDS;
+  used--;
+  return word;
+}
+
+void hal_tlog_write(const char *fmt, const uint32_t *args, uint8_t nargs) {
+  if (nargs > TLOG_MAX_ARGS)
+    nargs = TLOG_MAX_ARGS;
+
+  u8 r = irq_disable();
+  if (used + 2 + nargs > TLOG_RING_WORDS) {
+    dropped++;
+  } else {
+    ring_push(nargs);
+    ring_push((uint32_t)fmt);
+    for (uint8_t i = 0; i < nargs; i++) {
+      ring_push(args[i]);
+    }
+    queued++;
+  }
+  irq_restore(r);
+}
+
+static void send_word(uint32_t word) {
+  for (uint8_t i = 0; i < 4; i++) {
+    putchar((word >> (8 * i)) & 0xFF);
+  }
+}
+
+static void send_frame(uint32_t token, const uint32_t *args, uint8_t nargs) {
+  putchar(TLOG_FRAME_START);
+  putchar(nargs);
+  send_word(token);
+  for (uint8_t i = 0; i < nargs; i++) {
+    send_word(args[i]);
+  }
+}
+
+uint16_t hal_tlog_drain(uint16_t max_frames) {
+  uint32_t args[TLOG_MAX_ARGS];
+  uint16_t sent = 0;
+
+  while (max_frames == 0 || sent < max_frames) {
+    // Copy the entry out first, UART output is slow and must not hold IRQs
+    u8 r = irq_disable();
+    uint16_t lost = dropped;
+    dropped = 0;
+    if (queued == 0) {
+      irq_restore(r);
+      if (lost) {
+        uint32_t count = lost;
+        send_frame(TLOG_DROPPED_TOKEN, &count, 1);
+      }
+      break;
+    }
+    uint8_t nargs = (uint8_t)ring_pop();
+    uint32_t token = ring_pop();
+    for (uint8_t i = 0; i < nargs; i++) {
+      args[i] = ring_pop();
+    }
+    queued--;
+    irq_restore(r);
+
+    if (lost) {
+      uint32_t count = lost;
+      send_frame(TLOG_DROPPED_TOKEN, &count, 1);
+    }
+    send_frame(token, args, nargs);
+    sent++;
+  }
+
+  return queued;
+}
+
+#endif
@@ -24,6 +24,11 @@ void zdo_leave_confirmation_callback(nlme_leave_cnf_t *pLeaveCnf);
 static hal_network_status_change_callback_t network_status_change_callback =
     NULL;
 static bool steeringInProgress = 0;
+static bool rejoinInProgress = 0; // Asked for by the app
+#ifdef ZB_ED_ROLE
+// Set by the app, applied again after every join
+static u32 poll_rate_ms = POLL_RATE;
+#endif
 
 // Telink ZDO callbacks
 zdo_appIndCb_t zdo_callbacks = {
@@ -79,15 +84,13 @@ void bdb_init_callback(u8 status, u8 joinedNetwork) {
     if (joinedNetwork) {
       ota_queryStart(OTA_QUERY_INTERVAL);
       #ifdef ZB_ED_ROLE
-        zb_setPollRate(POLL_RATE);
-        printf("Set poll rate to %d\r\n", POLL_RATE);
+        zb_setPollRate(poll_rate_ms);
+        printf("Set poll rate to %d\r\n", poll_rate_ms);
       #endif
     }
-  } else {
-    if (joinedNetwork) {
-      zb_rejoinReqWithBackOff(zb_apsChannelMaskGet(), g_bdbAttrs.scanDuration);
-    }
   }
+  // Not restored but still commissioned: the app rejoins, on the last known
+  // channel first (zigbee/fast_rejoin.c)
   notify_about_network_status_change();
 }
 
@@ -97,10 +100,11 @@ void bdb_commissioning_callback(u8 status, void *arg) {
   case BDB_COMMISSION_STA_SUCCESS:
     ota_queryStart(OTA_QUERY_INTERVAL);
 #ifdef ZB_ED_ROLE
-    zb_setPollRate(POLL_RATE);
-    printf("Set poll rate to %d\r\n", POLL_RATE);
+    zb_setPollRate(poll_rate_ms);
+    printf("Set poll rate to %d\r\n", poll_rate_ms);
 #endif
     steeringInProgress = 0;
+    rejoinInProgress = 0;
     break;
   case BDB_COMMISSION_STA_IN_PROGRESS:
     break;
@@ -121,12 +125,10 @@ void bdb_commissioning_callback(u8 status, void *arg) {
     break;
   case BDB_COMMISSION_STA_NO_SCAN_RESPONSE:
   case BDB_COMMISSION_STA_PARENT_LOST:
-    zb_rejoinReqWithBackOff(zb_apsChannelMaskGet(), g_bdbAttrs.scanDuration);
-    break;
   case BDB_COMMISSION_STA_REJOIN_FAILURE:
-    if (!zb_isDeviceFactoryNew()) {
-      zb_rejoinReqWithBackOff(zb_apsChannelMaskGet(), g_bdbAttrs.scanDuration);
-    }
+    // No SDK backoff rejoin next to the app's, the not joined status below
+    // lets zigbee/fast_rejoin.c pick the next channels
+    rejoinInProgress = 0;
     break;
   default:
     break;
@@ -142,7 +144,7 @@ hal_zigbee_network_status_t hal_zigbee_get_network_status(void) {
   if (zb_isDeviceJoinedNwk()) {
     return HAL_ZIGBEE_NETWORK_JOINED;
   }
-  if (steeringInProgress) {
+  if (steeringInProgress || rejoinInProgress) {
     return HAL_ZIGBEE_NETWORK_JOINING;
   }
   return HAL_ZIGBEE_NETWORK_NOT_JOINED;
@@ -173,6 +175,41 @@ void hal_zigbee_start_network_steering(void) {
   }
 }
 
+void hal_zigbee_get_ieee_address(uint8_t addr[8]) {
+  ZB_IEEE_ADDR_COPY(addr, g_zbMacPib.extAddress);
+}
+
+void hal_zigbee_set_poll_interval(uint32_t interval_ms) {
+#ifdef ZB_ED_ROLE
+  poll_rate_ms = interval_ms;
+  if (hal_zigbee_get_network_status() == HAL_ZIGBEE_NETWORK_JOINED) {
+    zb_setPollRate(poll_rate_ms);
+  }
+#endif
+}
+
+bool hal_zigbee_get_network_info(hal_zigbee_network_info *info) {
+  if (zb_isDeviceFactoryNew()) {
+    return false;
+  }
+  info->channel = g_zbMacPib.phyChannelCur;
+  info->pan_id = g_zbMacPib.panId;
+  memcpy(info->ext_pan_id, g_zbNIB.extPANId, sizeof(info->ext_pan_id));
+  return true;
+}
+
+hal_zigbee_status_t hal_zigbee_rejoin(uint32_t channel_mask) {
+  // Only channels the device may use at all
+  channel_mask &= zb_apsChannelMaskGet();
+  if (channel_mask == 0 ||
+      zb_rejoinReq(channel_mask, g_bdbAttrs.scanDuration) != RET_OK) {
+    return HAL_ZIGBEE_ERR_BAD_ARG;
+  }
+  rejoinInProgress = 1;
+  notify_about_network_status_change();
+  return HAL_ZIGBEE_OK;
+}
+
 hal_zigbee_status_t hal_zigbee_send_announce(void) {
   if (zb_zdoSendDevAnnance() != RET_OK) {
     return HAL_ZIGBEE_ERR_SEND_FAILED;
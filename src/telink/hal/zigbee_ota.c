@@ -53,4 +53,14 @@ void hal_zigbee_init_ota() {
 
 void hal_zigbee_set_image_type(uint16_t image_type) {
   ota_preamble.imageType = image_type;
-}
\ No newline at end of file
+}
+
+// The SDK's OTA client keeps no partial download, an interrupted one starts
+// over from zero
+bool hal_ota_partial_get(hal_ota_image_id_t *id, uint32_t *offset) {
+  return false;
+}
+
+void hal_ota_partial_read(uint32_t offset, uint8_t *data, uint32_t len) {}
+
+void hal_ota_partial_clear(void) {}
@@ -4,10 +4,13 @@
 #include "zcl_include.h"
 #include "zcl_multistate_input.h"
 #include "zcl_onoff_configuration.h"
+#include "zcl_switch_diagnostics.h"
 #pragma pack(pop)
 
 #include "telink_size_t_hack.h"
 
+#include "base_components/diagnostics.h"
+#include "hal/tlog.h"
 #include "hal/zigbee.h"
 #include "telink_zigbee_hal.h"
 
@@ -47,6 +50,9 @@ static cluster_registerFunc_t get_register_func_by_cluster_id(u16 cluster_id) {
       ZCL_CLUSTER_GEN_MULTISTATE_INPUT_BASIC) { // Multistate Input
     return zcl_multistate_input_register;
   }
+  if (cluster_id == ZCL_CLUSTER_MANU_SWITCH_DIAGNOSTICS) { // Diagnostics
+    return zcl_switch_diagnostics_register;
+  }
   return NULL;
 }
 
@@ -81,9 +87,9 @@ static void zcl_incoming_message_callback(zclIncoming_t *pInHdlrMsg) {
     }
     zclWriteCmd_t *writeCmd = (zclWriteCmd_t *)pInHdlrMsg->attrCmd;
     for (u8 i = 0; i < writeCmd->numAttr; i++) {
-      printf("Attr write on endpoint %d, cluster %d, attribute %d\r\n",
-             pInHdlrMsg->msg->indInfo.dst_ep,
-             pInHdlrMsg->msg->indInfo.cluster_id, writeCmd->attrList[i].attrID);
+      TLOG("Attr write on endpoint %d, cluster %d, attribute %d\r\n",
+           pInHdlrMsg->msg->indInfo.dst_ep, pInHdlrMsg->msg->indInfo.cluster_id,
+           writeCmd->attrList[i].attrID);
       attribute_change_callback(pInHdlrMsg->msg->indInfo.dst_ep,
                                 pInHdlrMsg->msg->indInfo.cluster_id,
                                 writeCmd->attrList[i].attrID);
@@ -168,6 +174,7 @@ void telink_zigbee_hal_zcl_init(hal_zigbee_endpoint *endpoints,
 
 void hal_zigbee_notify_attribute_changed(uint8_t endpoint, uint8_t cluster_id,
                                          uint16_t attribute_id) {
+  diagnostics.reports_sent++;
   report_handler(); // Trigger reporting if needed
 }
 
@@ -177,23 +184,24 @@ hal_zigbee_status_t hal_zigbee_send_cmd_to_bindings(const hal_zigbee_cmd *cmd) {
 
   dstEpInfo.profileId = HA_PROFILE_ID;
   dstEpInfo.dstAddrMode = APS_DSTADDR_EP_NOTPRESETNT;
-  zcl_sendCmd(cmd->endpoint, &dstEpInfo, cmd->cluster_id, cmd->command_id,
-              cmd->cluster_specific,
-              cmd->direction == HAL_ZIGBEE_DIR_CLIENT_TO_SERVER
-                  ? ZCL_FRAME_CLIENT_SERVER_DIR
-                  : ZCL_FRAME_SERVER_CLIENT_DIR,
-              cmd->disable_default_rsp, cmd->manufacturer_code, ZCL_SEQ_NUM,
-              cmd->payload_len, cmd->payload);
+  status_t st = zcl_sendCmd(
+      cmd->endpoint, &dstEpInfo, cmd->cluster_id, cmd->command_id,
+      cmd->cluster_specific,
+      cmd->direction == HAL_ZIGBEE_DIR_CLIENT_TO_SERVER
+          ? ZCL_FRAME_CLIENT_SERVER_DIR
+          : ZCL_FRAME_SERVER_CLIENT_DIR,
+      cmd->disable_default_rsp, cmd->manufacturer_code, ZCL_SEQ_NUM,
+      cmd->payload_len, cmd->payload);
 
-  return HAL_ZIGBEE_OK;
+  return st == ZCL_STA_SUCCESS ? HAL_ZIGBEE_OK : HAL_ZIGBEE_ERR_SEND_FAILED;
 }
 
 hal_zigbee_status_t
 hal_zigbee_send_report_attr(uint8_t endpoint, uint16_t cluster_id,
                             uint16_t attr_id, uint8_t zcl_type_id,
                             const void *value, uint8_t value_len) {
-  printf("Sending attribute report, ep: %d, cluster: %d, attr: %d\r\n",
-         endpoint, cluster_id, attr_id);
+  TLOG("Sending attribute report, ep: %d, cluster: %d, attr: %d\r\n", endpoint,
+       cluster_id, attr_id);
   if (zb_isDeviceJoinedNwk()) {
     epInfo_t dstEpInfo;
     TL_SETSTRUCTCONTENT(dstEpInfo, 0);
@@ -206,8 +214,43 @@ hal_zigbee_send_report_attr(uint8_t endpoint, uint16_t cluster_id,
     status_t status = zcl_sendReportCmd(
         endpoint, &dstEpInfo, TRUE, ZCL_FRAME_SERVER_CLIENT_DIR, cluster_id,
         pAttrEntry->id, pAttrEntry->type, pAttrEntry->data);
-    printf("Sent attribute report, status: %d\r\n", status);
+    TLOG("Sent attribute report, status: %d\r\n", status);
+  }
+  return HAL_ZIGBEE_OK;
+}
+
+hal_zigbee_status_t
+hal_zigbee_send_report_attrs(uint8_t endpoint, uint16_t cluster_id,
+                             const hal_zigbee_report_attr *attrs,
+                             uint8_t attrs_cnt) {
+  if (attrs_cnt == 0 || attrs_cnt > HAL_ZIGBEE_MAX_REPORT_ATTRS)
+    return HAL_ZIGBEE_ERR_BAD_ARG;
+  if (!zb_isDeviceJoinedNwk())
+    return HAL_ZIGBEE_ERR_NOT_JOINED;
+
+  epInfo_t dstEpInfo;
+  TL_SETSTRUCTCONTENT(dstEpInfo, 0);
+  dstEpInfo.profileId = HA_PROFILE_ID;
+  dstEpInfo.dstAddrMode = APS_DSTADDR_EP_NOTPRESETNT;
+
+  // zclReportCmd_t ends with the attribute list
+  u32 buf[(sizeof(zclReportCmd_t) +
+           HAL_ZIGBEE_MAX_REPORT_ATTRS * sizeof(zclReport_t) + 3) /
+          4];
+  zclReportCmd_t *report = (zclReportCmd_t *)buf;
+  report->numAttr = attrs_cnt;
+  for (u8 i = 0; i < attrs_cnt; i++) {
+    report->attrList[i].attrID = attrs[i].attr_id;
+    report->attrList[i].dataType = attrs[i].zcl_type_id;
+    report->attrList[i].attrData = (u8 *)attrs[i].value;
   }
+
+  status_t st = zcl_sendReportAttrsCmd(endpoint, &dstEpInfo, TRUE,
+                                       ZCL_FRAME_SERVER_CLIENT_DIR, cluster_id,
+                                       report);
+  if (st != ZCL_STA_SUCCESS)
+    return HAL_ZIGBEE_ERR_SEND_FAILED;
+  diagnostics.reports_sent++;
   return HAL_ZIGBEE_OK;
 }
 
@@ -0,0 +1,109 @@
+#include "loop_profile.h"
+
+#ifdef LOOP_PROFILE
+
+#pragma pack(push, 1)
+#include "tl_common.h"
+#pragma pack(pop)
+
+#include "base_components/diagnostics.h"
+#include "hal/printf_selector.h"
+#include "hal/timer.h"
+
+// Averages are refreshed every this many iterations, it saves a 64-bit
+// division per loop
+#define AVERAGE_EVERY 256
+
+typedef struct {
+  uint32_t max_ticks;
+  uint64_t total_ticks;
+  uint32_t slow;
+} stage_stats_t;
+
+static const char *const stage_names[LOOP_STAGE_CNT] = {
+    "ev_main",
+    "zb_tasks",
+    "app_task",
+    "reports",
+};
+
+static stage_stats_t stages[LOOP_STAGE_CNT];
+static stage_stats_t loop;
+static uint32_t iterations;
+static uint64_t sleep_ticks;
+
+static uint32_t loop_start_tick;
+static uint32_t stage_start_tick;
+static uint32_t last_dump_ms;
+
+static uint32_t ticks_to_us(uint64_t ticks) {
+  return (uint32_t)(ticks / CLOCK_16M_SYS_TIMER_CLK_1US);
+}
+
+static void add_sample(stage_stats_t *stats, uint32_t ticks) {
+  if (ticks > stats->max_ticks)
+    stats->max_ticks = ticks;
+  stats->total_ticks += ticks;
+  if (ticks > LOOP_PROFILE_SLOW_US * CLOCK_16M_SYS_TIMER_CLK_1US)
+    stats->slow++;
+}
+
+void loop_profile_begin(void) {
+  loop_start_tick = clock_time();
+  stage_start_tick = loop_start_tick;
+}
+
+void loop_profile_stage_done(loop_stage_t stage) {
+  uint32_t now = clock_time();
+  add_sample(&stages[stage], now - stage_start_tick);
+  stage_start_tick = now;
+}
+
+static uint8_t slowest_stage(void) {
+  uint8_t slowest = 0;
+  for (uint8_t i = 1; i < LOOP_STAGE_CNT; i++) {
+    if (stages[i].max_ticks > stages[slowest].max_ticks)
+      slowest = i;
+  }
+  return slowest;
+}
+
+void loop_profile_end(void) {
+  add_sample(&loop, clock_time() - loop_start_tick);
+  iterations++;
+
+  diagnostics.loop_max_us = ticks_to_us(loop.max_ticks);
+  diagnostics.loop_slow_count = loop.slow;
+  if (iterations % AVERAGE_EVERY == 0) {
+    diagnostics.loop_avg_us = ticks_to_us(loop.total_ticks / iterations);
+    diagnostics.loop_slowest_stage = slowest_stage();
+  }
+}
+
+void loop_profile_slept(uint32_t start_tick) {
+  sleep_ticks += clock_time() - start_tick;
+  diagnostics.sleep_ms = ticks_to_us(sleep_ticks) / 1000;
+}
+
+void loop_profile_dump_if_due(void) {
+  uint32_t now = hal_millis();
+  if (now - last_dump_ms < LOOP_PROFILE_DUMP_INTERVAL_MS)
+    return;
+  last_dump_ms = now;
+  if (iterations == 0)
+    return;
+
+  // Plain %d and %s, the formats every SDK printf variant handles
+  printf("Loop profile: %d iterations, slept %d ms\r\n", iterations,
+         diagnostics.sleep_ms);
+  for (uint8_t i = 0; i < LOOP_STAGE_CNT; i++) {
+    printf("  %s: max %d us, avg %d us, slow %d\r\n", stage_names[i],
+           ticks_to_us(stages[i].max_ticks),
+           ticks_to_us(stages[i].total_ticks / iterations), stages[i].slow);
+  }
+  printf("  loop: max %d us, avg %d us, slow %d\r\n",
+         ticks_to_us(loop.max_ticks),
+         ticks_to_us(loop.total_ticks / iterations), loop.slow);
+}
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef _LOOP_PROFILE_H_
+#define _LOOP_PROFILE_H_
+
+/*
+ * Cycle-time profiling of the main loop, built with LOOP_PROFILE=1.
+ *
+ * Each stage of real_main() is timed with the 16 MHz system timer. The loop
+ * totals go to the diagnostics cluster, debug builds also print a per-stage
+ * table to UART every LOOP_PROFILE_DUMP_INTERVAL_MS.
+ *
+ * Without LOOP_PROFILE all macros below compile to nothing.
+ */
+
+#include <stdint.h>
+
+typedef enum {
+  LOOP_STAGE_EV_MAIN = 0,
+  LOOP_STAGE_ZB_TASKS,
+  LOOP_STAGE_APP_TASK,
+  LOOP_STAGE_REPORTS,
+  LOOP_STAGE_CNT,
+} loop_stage_t;
+
+#ifdef LOOP_PROFILE
+
+// An iteration or a stage taking longer counts as slow
+#ifndef LOOP_PROFILE_SLOW_US
+#define LOOP_PROFILE_SLOW_US 20000
+#endif
+
+#ifndef LOOP_PROFILE_DUMP_INTERVAL_MS
+#define LOOP_PROFILE_DUMP_INTERVAL_MS 60000
+#endif
+
+/** Starts timing an iteration, and its first stage */
+void loop_profile_begin(void);
+
+/**
+ * Ends a stage, the next one starts right away
+ * @param stage Stage that just returned
+ */
+void loop_profile_stage_done(loop_stage_t stage);
+
+/** Ends the iteration, before the power management sleep */
+void loop_profile_end(void);
+
+/**
+ * Adds the time spent in drv_pm_sleep()
+ * @param start_tick clock_time() before going to sleep
+ */
+void loop_profile_slept(uint32_t start_tick);
+
+/** Prints the per-stage table to UART when the dump interval passed */
+void loop_profile_dump_if_due(void);
+
+#define LOOP_PROFILE_BEGIN() loop_profile_begin()
+#define LOOP_PROFILE_STAGE_DONE(stage) loop_profile_stage_done(stage)
+#define LOOP_PROFILE_END() loop_profile_end()
+
+#else
+
+#define LOOP_PROFILE_BEGIN()
+#define LOOP_PROFILE_STAGE_DONE(stage)
+#define LOOP_PROFILE_END()
+
+#endif
+
+#endif
@@ -13,10 +13,17 @@
 #include "hal/gpio.h"
 #include "hal/tasks.h"
 #include "hal/telink_zigbee_hal.h"
+#include "hal/tlog.h"
 #include "hal/zigbee.h"
+#include "loop_profile.h"
 
 int real_main(startup_state_e state);
 
+#ifdef TLOG_TOKENIZED
+// Bounds the time spent on UART in one loop iteration
+#define TLOG_DRAIN_FRAMES_PER_LOOP 4
+#endif
+
 static _attribute_ram_code_sec_ bool is_bootloader_mode(void) {
   // Check if we are in bootloader mode by reading the flag
   return (*((u32 *)(BOOTLOADER_MODE_MAIN_ADDR + FLASH_TLNK_FLAG_OFFSET)) ==
@@ -46,6 +53,10 @@ int real_main(startup_state_e state) {
   printf("Started!\r\n");
 
   uint8_t isRetention = (state == SYSTEM_DEEP_RETENTION) ? 1 : 0;
+  if (!isRetention) {
+    // Only a full boot can follow a migration
+    ota_scheme_report_migration();
+  }
 
   os_init(isRetention);
 
@@ -57,26 +68,57 @@ int real_main(startup_state_e state) {
   drv_wd_start();
 
   while (1) {
+    LOOP_PROFILE_BEGIN();
     drv_wd_clear();
     ev_main();
+    LOOP_PROFILE_STAGE_DONE(LOOP_STAGE_EV_MAIN);
     drv_wd_clear();
     tl_zbTaskProcedure();
+    LOOP_PROFILE_STAGE_DONE(LOOP_STAGE_ZB_TASKS);
     drv_wd_clear();
     app_task();
+    LOOP_PROFILE_STAGE_DONE(LOOP_STAGE_APP_TASK);
     drv_wd_clear();
     report_handler();
+    LOOP_PROFILE_STAGE_DONE(LOOP_STAGE_REPORTS);
     drv_wd_clear();
+    LOOP_PROFILE_END();
+
+#ifdef TLOG_TOKENIZED
+    // UART output only while the stack has nothing to do
+    if (!tl_stackBusy() && zb_isTaskDone()) {
+      hal_tlog_drain(TLOG_DRAIN_FRAMES_PER_LOOP);
+      drv_wd_clear();
+    }
+#endif
+
+#if defined(LOOP_PROFILE) && UART_PRINTF_MODE
+    if (!tl_stackBusy() && zb_isTaskDone()) {
+      loop_profile_dump_if_due();
+      drv_wd_clear();
+    }
+#endif
 
 #if PM_ENABLE
     if (!tl_stackBusy() && zb_isTaskDone()) {
+#ifdef TLOG_TOKENIZED
+      // Nothing may stay queued across a sleep
+      hal_tlog_drain(0);
+#endif
       telink_gpio_hal_setup_wake_ups();
       ev_timer_event_t *timerEvt = ev_timer_nearestGet();
       u32 sleepDuration = 1000;
       if (timerEvt) {
         sleepDuration = timerEvt->timeout < 1000 ? timerEvt->timeout : 1000;
       }
+#ifdef LOOP_PROFILE
+      u32 sleep_start_tick = clock_time();
+#endif
       drv_pm_sleep(PM_SLEEP_MODE_SUSPEND,
                    PM_WAKEUP_SRC_PAD | PM_WAKEUP_SRC_TIMER, sleepDuration);
+#ifdef LOOP_PROFILE
+      loop_profile_slept(sleep_start_tick);
+#endif
     }
 #endif
   }
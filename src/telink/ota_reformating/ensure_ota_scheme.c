@@ -15,9 +15,11 @@
  * - Detect current scheme (bootloader or no-bootloader, current boot address)
  * - If current schema is correct, just return
  * - Move code to unused OTA slot to avoid overwriting code that is being
- * executed
+ * executed. Sectors already in place are kept, so a power loss mid-copy only
+ * costs the sector in progress, and the boot flag of the new slot is written
+ * once all of it is verified.
  * - Mark current slot as unused
- * - Reboot into the new slot
+ * - Reboot into the new slot, which reports how long the copy took
  *
  * Note that this code runs in ram-code section, because in bootloader mode
  * flash-resident code cannot be used (it was linked to run from different
@@ -33,21 +35,47 @@
 #include "tl_common.h"
 #pragma pack(pop)
 
-// Ramcode versions of flash read/write functions
+// Copies go through RAM in chunks of this size, a multiple of the page size.
+// Helpers keep two chunks on the stack, which in bootloader mode is the
+// bootloader's, so they stay at one page as the original copy loop did.
+#define COPY_CHUNK_SIZE PAGE_SIZE
+#define COPY_CHUNK_WORDS (COPY_CHUNK_SIZE / 4)
+#define MIGRATION_SECTOR_SIZE 4096
+#define BOOT_FLAG_WORD (FLASH_TLNK_FLAG_OFFSET / 4)
 
-int _attribute_ram_code_sec_ ram_code_memcmp(const void *m1, const void *m2,
-                                             unsigned int n) {
-  unsigned char *s1 = (unsigned char *)m1;
-  unsigned char *s2 = (unsigned char *)m2;
+// Left right after the image in the new slot, the next boot prints it
+#define MIGRATION_RECORD_MAGIC 0x5247494d // "MIGR"
 
-  while (n--) {
-    if (*s1 != *s2) {
-      return *s1 - *s2;
+typedef struct {
+  u32 magic;
+  u32 ticks; // System timer ticks the copy took
+  u16 sectors_copied;
+  u16 sectors_skipped; // Already in place from an interrupted migration
+} migration_record_t;
+
+#define MIGRATION_RECORD_WORDS (sizeof(migration_record_t) / 4)
+
+static u32 _attribute_ram_code_sec_ align_up(u32 value, u32 alignment) {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+bool _attribute_ram_code_sec_ ram_code_words_equal(const u32 *a, const u32 *b,
+                                                   u32 words) {
+  while (words--) {
+    if (*a++ != *b++) {
+      return false;
     }
-    s1++;
-    s2++;
   }
-  return 0;
+  return true;
+}
+
+bool _attribute_ram_code_sec_ ram_code_words_erased(const u32 *a, u32 words) {
+  while (words--) {
+    if (*a++ != 0xffffffff) {
+      return false;
+    }
+  }
+  return true;
 }
 
 bool _attribute_ram_code_sec_ is_valid_image_at_address(u32 addr) {
@@ -63,27 +91,149 @@ u32 _attribute_ram_code_sec_ get_firmware_size(u32 addr) {
   return size;
 }
 
-void _attribute_ram_code_sec_ move_flash_data(u32 from, u32 to, u32 size) {
-  u32 bufCache[256 / 4]; // align to 4, not sure
-  u8 *buf = (u8 *)bufCache;
-  u8 verifyBuf[256];
+// The boot flag of the new slot is written last, until then a half copied
+// image must not boot. Its word is left erased, or already holds the flag
+// after an interrupted migration.
+static void _attribute_ram_code_sec_ mask_boot_flag(u32 *chunk) {
+  chunk[BOOT_FLAG_WORD] = 0xffffffff;
+}
 
-  for (int i = 0; i < size; i += 256) {
-    if ((i & 0xfff) == 0) {
-      ram_code_flash_erase_sector(to + i);
-    }
+// Whether the record area can take a record or holds one of an interrupted
+// migration that got as far as that
+static bool _attribute_ram_code_sec_ record_area_ok(const u32 *area) {
+  return area[0] == MIGRATION_RECORD_MAGIC ||
+         ram_code_words_erased(area, MIGRATION_RECORD_WORDS);
+}
 
-    ram_code_flash_read_page(from + i, 256, buf);
+// Whether the sector at offset already holds the image, so a migration that
+// lost power goes on where it stopped. The record area, if in the sector, has
+// to be usable as well.
+static bool _attribute_ram_code_sec_ sector_in_place(u32 from, u32 to,
+                                                     u32 offset, u32 len,
+                                                     u32 record_offset) {
+  u32 src[COPY_CHUNK_WORDS];
+  u32 dst[COPY_CHUNK_WORDS];
+
+  for (u32 i = 0; i < len; i += COPY_CHUNK_SIZE) {
+    u32 n = len - i < COPY_CHUNK_SIZE ? len - i : COPY_CHUNK_SIZE;
+    ram_code_flash_read_page(from + offset + i, n, (u8 *)src);
+    ram_code_flash_read_page(to + offset + i, n, (u8 *)dst);
+    if (offset + i == 0) {
+      mask_boot_flag(src);
+      mask_boot_flag(dst);
+    }
+    if (!ram_code_words_equal(src, dst, n / 4)) {
+      return false;
+    }
+  }
+  if (record_offset >= offset &&
+      record_offset < offset + MIGRATION_SECTOR_SIZE) {
+    ram_code_flash_read_page(to + record_offset, sizeof(migration_record_t),
+                             (u8 *)dst);
+    return record_area_ok(dst);
+  }
+  return true;
+}
 
-    ram_code_flash_write_page(to + i, 256, buf);
+// Erases the sector and copies len bytes of it, pages of the image that are
+// still erased are skipped. Every chunk is read back, a mismatch resets and
+// the next boot tries again.
+static void _attribute_ram_code_sec_ copy_sector(u32 from, u32 to, u32 offset,
+                                                 u32 len) {
+  u32 buf[COPY_CHUNK_WORDS];
+  u32 verify[COPY_CHUNK_WORDS];
 
-    ram_code_flash_read_page(to + i, 256, verifyBuf);
-    if (ram_code_memcmp(verifyBuf, buf, 256)) {
+  ram_code_flash_erase_sector(to + offset);
+  for (u32 i = 0; i < len; i += COPY_CHUNK_SIZE) {
+    u32 n = len - i < COPY_CHUNK_SIZE ? len - i : COPY_CHUNK_SIZE;
+    ram_code_flash_read_page(from + offset + i, n, (u8 *)buf);
+    if (offset + i == 0) {
+      mask_boot_flag(buf);
+    }
+    for (u32 page = 0; page < n; page += PAGE_SIZE) {
+      u32 *data = buf + page / 4;
+      if (!ram_code_words_erased(data, PAGE_SIZE / 4)) {
+        ram_code_flash_write_page(to + offset + i + page, PAGE_SIZE,
+                                  (u8 *)data);
+      }
+    }
+    ram_code_flash_read_page(to + offset + i, n, (u8 *)verify);
+    if (!ram_code_words_equal(verify, buf, n / 4)) {
       SYSTEM_RESET(); // Verification failed, reset
     }
   }
 }
 
+// Copies the image sector by sector, sectors already in place are kept.
+// Only the sectors the image and the record cover are erased.
+void _attribute_ram_code_sec_ move_flash_data(u32 from, u32 to, u32 size) {
+  u32 start_tick = reg_system_tick;
+  u32 copy_len = align_up(size, PAGE_SIZE);
+  u32 record_offset = copy_len;
+  u32 end = copy_len + sizeof(migration_record_t);
+  if (end > MAX_FIRMWARE_SIZE) {
+    record_offset = MAX_FIRMWARE_SIZE; // No room, the next boot reports none
+    end = copy_len;
+  }
+  // Set field by field, an initializer could be copied from flash
+  migration_record_t record;
+  record.magic = MIGRATION_RECORD_MAGIC;
+  record.sectors_copied = 0;
+  record.sectors_skipped = 0;
+
+  for (u32 offset = 0; offset < end; offset += MIGRATION_SECTOR_SIZE) {
+    u32 len = 0;
+    if (offset < copy_len) {
+      len = copy_len - offset < MIGRATION_SECTOR_SIZE ? copy_len - offset
+                                                      : MIGRATION_SECTOR_SIZE;
+    }
+    if (sector_in_place(from, to, offset, len, record_offset)) {
+      record.sectors_skipped++;
+      continue;
+    }
+    copy_sector(from, to, offset, len);
+    record.sectors_copied++;
+  }
+
+  record.ticks = reg_system_tick - start_tick;
+  if (record_offset < MAX_FIRMWARE_SIZE) {
+    u32 area[MIGRATION_RECORD_WORDS];
+    ram_code_flash_read_page(to + record_offset, sizeof(area), (u8 *)area);
+    if (ram_code_words_erased(area, MIGRATION_RECORD_WORDS)) {
+      ram_code_flash_write_page(to + record_offset, sizeof(record),
+                                (u8 *)&record);
+    }
+  }
+  // The copy is complete and verified, now it may boot
+  u32 flag = TL_START_UP_FLAG_WHOLE;
+  ram_code_flash_write_page(to + FLASH_TLNK_FLAG_OFFSET, 4, (u8 *)&flag);
+}
+
+void ota_scheme_report_migration(void) {
+  if (!is_valid_image_at_address(FLASH_ADDR_OF_OTA_IMAGE)) {
+    return;
+  }
+  u32 size = get_firmware_size(FLASH_ADDR_OF_OTA_IMAGE);
+  u32 record_offset = align_up(size, PAGE_SIZE);
+  if (size == 0 ||
+      record_offset + sizeof(migration_record_t) > MAX_FIRMWARE_SIZE) {
+    return;
+  }
+  migration_record_t record;
+  ram_code_flash_read_page(FLASH_ADDR_OF_OTA_IMAGE + record_offset,
+                           sizeof(record), (u8 *)&record);
+  if (record.magic != MIGRATION_RECORD_MAGIC) {
+    return;
+  }
+  printf("OTA scheme migrated in %d ms, %d sectors copied, %d in place\r\n",
+         record.ticks / CLOCK_16M_SYS_TIMER_CLK_1MS, record.sectors_copied,
+         record.sectors_skipped);
+  // Reported once, clearing bits needs no erase
+  u32 cleared = 0;
+  ram_code_flash_write_page(FLASH_ADDR_OF_OTA_IMAGE + record_offset, 4,
+                            (u8 *)&cleared);
+}
+
 void _attribute_ram_code_sec_ ensure_correct_ota_scheme(void) {
 
   u32 current_addr = 0x0;
@@ -14,4 +14,7 @@
 
 void _attribute_ram_code_sec_ ensure_correct_ota_scheme(void);
 
+/** Prints the duration of a slot migration once, on the boot after it */
+void ota_scheme_report_migration(void);
+
 #endif
\ No newline at end of file
@@ -3,11 +3,15 @@
 #include "build_date.h"
 #include "cluster_common.h"
 #include "consts.h"
+#include "device_config/config_compiler.h"
 #include "device_config/config_nv.h"
+#include "device_config/config_parser.h"
+#include "device_config/nvm_cache.h"
 #include "device_config/nvm_items.h"
 #include "device_config/reset.h"
-#include "hal/nvm.h"
+#include "hal/printf_selector.h"
 #include "hal/tasks.h"
+#include "poll_control.h"
 #include <stddef.h>
 
 #ifdef HAL_SILABS
@@ -29,12 +33,30 @@ void basic_cluster_store_attrs_to_nv();
 void basic_cluster_load_attrs_from_nv();
 
 void basic_cluster_callback_attr_write_trampoline(uint16_t attribute_id) {
+  static device_config_compiled_t new_config;
+
+  if (attribute_id == ZCL_ATTR_BASIC_POLL_SHORT_INTERVAL ||
+      attribute_id == ZCL_ATTR_BASIC_POLL_LONG_INTERVAL ||
+      attribute_id == ZCL_ATTR_BASIC_POLL_FAST_TIMEOUT) {
+    poll_control_on_attr_write(); // Kept in their own NV item
+    return;
+  }
+
   basic_cluster_store_attrs_to_nv();
   if (attribute_id == ZCL_ATTR_BASIC_DEVICE_CONFIG) {
+    if (device_config_str.size >= sizeof(device_config_str.data) ||
+        !device_config_compiled_write_to_nv(&new_config)) {
+      printf("Rejected invalid config\r\n");
+      device_config_read_from_nv(); // Keep the running config
+      return;
+    }
     device_config_str.data[device_config_str.size] =
         0; // NULL terminate the string
     device_config_write_to_nv();
-    schedule_reboot(0); // Use default delay
+    // Only changes to the endpoint layout need the device to rejoin
+    if (!device_config_apply_in_place(&new_config)) {
+      schedule_reboot(0); // Use default delay
+    }
   }
   if (attribute_id == ZCL_ATTR_BASIC_STATUS_LED_STATE) {
     network_indicator_from_manual_state(&network_indicator);
@@ -74,14 +96,28 @@ void basic_cluster_add_to_endpoint(zigbee_basic_cluster *cluster,
              ATTR_READONLY, cluster_revision);
   SETUP_ATTR(11, ZCL_ATTR_BASIC_DEVICE_CONFIG, ZCL_DATA_TYPE_LONG_CHAR_STR,
              ATTR_WRITABLE, device_config_str);
+  // SETUP_ATTR expands its index several times, it is bumped separately
+  uint8_t attr_count = 12;
   if (network_indicator.has_dedicated_led) {
-    SETUP_ATTR(12, ZCL_ATTR_BASIC_STATUS_LED_STATE, ZCL_DATA_TYPE_BOOLEAN,
-               ATTR_WRITABLE, network_indicator.manual_state_when_connected);
+    SETUP_ATTR(attr_count, ZCL_ATTR_BASIC_STATUS_LED_STATE,
+               ZCL_DATA_TYPE_BOOLEAN, ATTR_WRITABLE,
+               network_indicator.manual_state_when_connected);
+    attr_count++;
   }
+#ifdef POLL_CONTROL_ATTRS
+  SETUP_ATTR(attr_count, ZCL_ATTR_BASIC_POLL_SHORT_INTERVAL,
+             ZCL_DATA_TYPE_UINT16, ATTR_WRITABLE,
+             poll_control.short_interval_ms);
+  SETUP_ATTR(attr_count + 1, ZCL_ATTR_BASIC_POLL_LONG_INTERVAL,
+             ZCL_DATA_TYPE_UINT32, ATTR_WRITABLE,
+             poll_control.long_interval_ms);
+  SETUP_ATTR(attr_count + 2, ZCL_ATTR_BASIC_POLL_FAST_TIMEOUT,
+             ZCL_DATA_TYPE_UINT32, ATTR_WRITABLE, poll_control.fast_timeout_ms);
+  attr_count += 3;
+#endif
 
   endpoint->clusters[endpoint->cluster_count].cluster_id = ZCL_CLUSTER_BASIC;
-  endpoint->clusters[endpoint->cluster_count].attribute_count =
-      network_indicator.has_dedicated_led ? 13 : 12;
+  endpoint->clusters[endpoint->cluster_count].attribute_count = attr_count;
   endpoint->clusters[endpoint->cluster_count].attributes = cluster->attr_infos;
   endpoint->clusters[endpoint->cluster_count].is_server = 1;
   endpoint->cluster_count++;
@@ -103,14 +139,15 @@ void basic_cluster_store_attrs_to_nv() {
   nv_config_buffer.network_led_on =
       network_indicator.manual_state_when_connected;
 
-  hal_nvm_write(NV_ITEM_BASIC_CLUSTER_DATA, sizeof(zigbee_basic_cluster_config),
-                (uint8_t *)&nv_config_buffer);
+  nvm_cache_write(NV_ITEM_BASIC_CLUSTER_DATA,
+                  sizeof(zigbee_basic_cluster_config),
+                  (uint8_t *)&nv_config_buffer);
 }
 
 void basic_cluster_load_attrs_from_nv() {
-  hal_nvm_status_t st = hal_nvm_read(NV_ITEM_BASIC_CLUSTER_DATA,
-                                     sizeof(zigbee_basic_cluster_config),
-                                     (uint8_t *)&nv_config_buffer);
+  hal_nvm_status_t st = nvm_cache_read(NV_ITEM_BASIC_CLUSTER_DATA,
+                                       sizeof(zigbee_basic_cluster_config),
+                                       (uint8_t *)&nv_config_buffer);
 
   if (st != HAL_NVM_SUCCESS) {
     return;
@@ -9,7 +9,7 @@ typedef struct {
   uint8_t deviceEnable;
   char manuName[32];
   char modelId[32];
-  hal_zigbee_attribute attr_infos[13];
+  hal_zigbee_attribute attr_infos[16];
 } zigbee_basic_cluster;
 
 void basic_cluster_add_to_endpoint(zigbee_basic_cluster *cluster,
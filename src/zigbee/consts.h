@@ -13,6 +13,8 @@
 #define ZCL_CLUSTER_LEVEL_CONTROL                     0x0008
 #define ZCL_CLUSTER_GROUPS                            0x0004
 #define ZCL_CLUSTER_OTA_BOOTLOAD                      0x0019
+// Manufacturer specific
+#define ZCL_CLUSTER_SWITCH_DIAGNOSTICS                0xFCA0
 
 
 // Attributes
@@ -40,6 +42,9 @@
 
 #define ZCL_ATTR_BASIC_DEVICE_CONFIG                    0xff00
 #define ZCL_ATTR_BASIC_STATUS_LED_STATE                 0xff01
+#define ZCL_ATTR_BASIC_POLL_SHORT_INTERVAL              0xff02
+#define ZCL_ATTR_BASIC_POLL_LONG_INTERVAL               0xff03
+#define ZCL_ATTR_BASIC_POLL_FAST_TIMEOUT                0xff04
 
 // OnOff cluster
 
@@ -73,6 +78,28 @@
 
 #define ZCL_ATTR_GROUP_NAME_SUPPORT                     0x0000
 
+// Switch diagnostics cluster
+
+#define ZCL_ATTR_DIAGNOSTICS_UPTIME                     0x0000
+#define ZCL_ATTR_DIAGNOSTICS_RESET_REASON               0x0001
+#define ZCL_ATTR_DIAGNOSTICS_BUTTON_EVENTS              0x0002
+#define ZCL_ATTR_DIAGNOSTICS_RELAY_OPERATIONS           0x0003
+#define ZCL_ATTR_DIAGNOSTICS_LATCHING_PULSES            0x0004
+#define ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_RECEIVED          0x0005
+#define ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_SENT              0x0006
+#define ZCL_ATTR_DIAGNOSTICS_SEND_FAILURES              0x0007
+#define ZCL_ATTR_DIAGNOSTICS_REPORTS_SENT               0x0008
+#define ZCL_ATTR_DIAGNOSTICS_NVM_WRITES                 0x0009
+#define ZCL_ATTR_DIAGNOSTICS_TASKS_PEAK                 0x000A
+#define ZCL_ATTR_DIAGNOSTICS_GPIO_INTERRUPTS            0x000B
+#define ZCL_ATTR_DIAGNOSTICS_LOOP_MAX_US                0x000C
+#define ZCL_ATTR_DIAGNOSTICS_LOOP_AVG_US                0x000D
+#define ZCL_ATTR_DIAGNOSTICS_LOOP_SLOW_COUNT            0x000E
+#define ZCL_ATTR_DIAGNOSTICS_LOOP_SLOWEST_STAGE         0x000F
+#define ZCL_ATTR_DIAGNOSTICS_SLEEP_MS                   0x0010
+// Button events of the switch on endpoint ep
+#define ZCL_ATTR_DIAGNOSTICS_BUTTON_EVENTS_EP(ep)       (0x0100 + (ep))
+
 // OTA cluster
 
 #define ZCL_ATTR_OTA_UPGRADE_SERVER_ID                  0x0000
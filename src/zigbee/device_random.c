@@ -0,0 +1,36 @@
+#include "device_random.h"
+
+#include "hal/zigbee.h"
+
+static uint32_t rng_state = 1;
+
+void device_random_init(void) {
+  uint8_t ieee[8];
+  hal_zigbee_get_ieee_address(ieee);
+  // FNV-1a, the low bytes alone are often shared by a whole batch
+  uint32_t seed = 2166136261u;
+  for (int i = 0; i < 8; i++) {
+    seed = (seed ^ ieee[i]) * 16777619u;
+  }
+  rng_state = seed ? seed : 1;
+}
+
+// xorshift32, the sequence only has to differ between devices
+static uint32_t next_random(void) {
+  uint32_t x = rng_state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  rng_state = x;
+  return x;
+}
+
+uint32_t device_random_below(uint32_t bound) {
+  if (bound == 0)
+    return 0;
+  return next_random() % bound;
+}
+
+#ifdef HAL_STUB
+void device_random_reset_state(void) { rng_state = 1; }
+#endif
@@ -0,0 +1,26 @@
+#ifndef _DEVICE_RANDOM_H_
+#define _DEVICE_RANDOM_H_
+
+#include <stdint.h>
+
+// Pseudo random numbers for spreading network traffic of devices that start
+// together. Not suitable for anything security related.
+
+/**
+ * Seeds the generator from the IEEE address, so every device draws its own
+ * sequence. Called from app_init() once the stack is initialized.
+ */
+void device_random_init(void);
+
+/**
+ * @param bound Exclusive upper bound, 0 returns 0
+ * @return Number in [0, bound)
+ */
+uint32_t device_random_below(uint32_t bound);
+
+#ifdef HAL_STUB
+// Host simulator only, see app_reset_state()
+void device_random_reset_state(void);
+#endif
+
+#endif
@@ -0,0 +1,62 @@
+#include "diagnostics_cluster.h"
+#include "base_components/diagnostics.h"
+#include "cluster_common.h"
+#include "consts.h"
+
+void diagnostics_cluster_add_to_endpoint(zigbee_diagnostics_cluster *cluster,
+                                         hal_zigbee_endpoint *endpoint,
+                                         zigbee_switch_cluster *switches,
+                                         uint8_t switches_cnt) {
+  SETUP_ATTR(0, ZCL_ATTR_DIAGNOSTICS_UPTIME, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.uptime_s);
+  SETUP_ATTR(1, ZCL_ATTR_DIAGNOSTICS_RESET_REASON, ZCL_DATA_TYPE_ENUM8,
+             ATTR_READONLY, diagnostics.reset_reason);
+  SETUP_ATTR(2, ZCL_ATTR_DIAGNOSTICS_BUTTON_EVENTS, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.button_events);
+  SETUP_ATTR(3, ZCL_ATTR_DIAGNOSTICS_RELAY_OPERATIONS, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.relay_operations);
+  SETUP_ATTR(4, ZCL_ATTR_DIAGNOSTICS_LATCHING_PULSES, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.latching_pulses);
+  SETUP_ATTR(5, ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_RECEIVED, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.zcl_cmds_received);
+  SETUP_ATTR(6, ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_SENT, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.zcl_cmds_sent);
+  SETUP_ATTR(7, ZCL_ATTR_DIAGNOSTICS_SEND_FAILURES, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.send_failures);
+  SETUP_ATTR(8, ZCL_ATTR_DIAGNOSTICS_REPORTS_SENT, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.reports_sent);
+  SETUP_ATTR(9, ZCL_ATTR_DIAGNOSTICS_NVM_WRITES, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.nvm_writes);
+  SETUP_ATTR(10, ZCL_ATTR_DIAGNOSTICS_TASKS_PEAK, ZCL_DATA_TYPE_UINT16,
+             ATTR_READONLY, diagnostics.tasks_peak);
+  SETUP_ATTR(11, ZCL_ATTR_DIAGNOSTICS_GPIO_INTERRUPTS, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.gpio_interrupts);
+#ifdef LOOP_PROFILE
+  SETUP_ATTR(12, ZCL_ATTR_DIAGNOSTICS_LOOP_MAX_US, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.loop_max_us);
+  SETUP_ATTR(13, ZCL_ATTR_DIAGNOSTICS_LOOP_AVG_US, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.loop_avg_us);
+  SETUP_ATTR(14, ZCL_ATTR_DIAGNOSTICS_LOOP_SLOW_COUNT, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.loop_slow_count);
+  SETUP_ATTR(15, ZCL_ATTR_DIAGNOSTICS_LOOP_SLOWEST_STAGE, ZCL_DATA_TYPE_ENUM8,
+             ATTR_READONLY, diagnostics.loop_slowest_stage);
+  SETUP_ATTR(16, ZCL_ATTR_DIAGNOSTICS_SLEEP_MS, ZCL_DATA_TYPE_UINT32,
+             ATTR_READONLY, diagnostics.sleep_ms);
+#endif
+
+  // Switches take the first endpoints, in order
+  uint8_t attr_cnt = DIAGNOSTICS_COMMON_ATTRS;
+  for (int index = 0; index < switches_cnt; index++) {
+    SETUP_ATTR(attr_cnt, ZCL_ATTR_DIAGNOSTICS_BUTTON_EVENTS_EP(index + 1),
+               ZCL_DATA_TYPE_UINT32, ATTR_READONLY,
+               switches[index].button->events);
+    attr_cnt++;
+  }
+
+  endpoint->clusters[endpoint->cluster_count].cluster_id =
+      ZCL_CLUSTER_SWITCH_DIAGNOSTICS;
+  endpoint->clusters[endpoint->cluster_count].attribute_count = attr_cnt;
+  endpoint->clusters[endpoint->cluster_count].attributes = cluster->attr_infos;
+  endpoint->clusters[endpoint->cluster_count].is_server = 1;
+  endpoint->cluster_count++;
+}
@@ -0,0 +1,32 @@
+#ifndef _DIAGNOSTICS_CLUSTER_H_
+#define _DIAGNOSTICS_CLUSTER_H_
+
+#include "device_config/capacities.h"
+#include "hal/zigbee.h"
+#include "switch_cluster.h"
+
+#ifdef LOOP_PROFILE
+#define DIAGNOSTICS_COMMON_ATTRS 17
+#else
+#define DIAGNOSTICS_COMMON_ATTRS 12
+#endif
+
+typedef struct {
+  hal_zigbee_attribute
+      attr_infos[DIAGNOSTICS_COMMON_ATTRS + DEVICE_CONFIG_MAX_SWITCHES];
+} zigbee_diagnostics_cluster;
+
+/**
+ * Adds the read-only diagnostics cluster, values come from the global
+ * diagnostics counters and the buttons of the switches
+ * @param cluster Cluster storage
+ * @param endpoint Endpoint to add to, endpoint 1
+ * @param switches Switch clusters, for the per endpoint button events
+ * @param switches_cnt Number of switch clusters
+ */
+void diagnostics_cluster_add_to_endpoint(zigbee_diagnostics_cluster *cluster,
+                                         hal_zigbee_endpoint *endpoint,
+                                         zigbee_switch_cluster *switches,
+                                         uint8_t switches_cnt);
+
+#endif
@@ -0,0 +1,170 @@
+#include "fast_rejoin.h"
+
+#include "device_config/nvm_cache.h"
+#include "device_config/nvm_items.h"
+#include "hal/printf_selector.h"
+#include "hal/tasks.h"
+#include "network_steering.h"
+#include <string.h>
+
+static hal_task_t rejoin_task;
+static bool initialized = false;
+static bool in_progress = false;        // Owns the network until joined
+static bool attempt_in_progress = false; // Started, waiting for the outcome
+static bool attempt_was_scan = false;
+static uint8_t fast_attempts = 0;
+static uint8_t failed_scans = 0;
+
+static hal_zigbee_network_info cached;
+static bool cached_valid = false; // Cached network is the commissioned one
+
+static bool channel_valid(uint8_t channel) {
+  return channel < 32 && (HAL_ZIGBEE_ALL_CHANNELS_MASK >> channel) & 1;
+}
+
+static void load_cache(const hal_zigbee_network_info *info) {
+  cached_valid =
+      nvm_cache_read(NV_ITEM_NETWORK_RESTORE_DATA, sizeof(cached),
+                     (uint8_t *)&cached) == HAL_NVM_SUCCESS &&
+      channel_valid(cached.channel) &&
+      // A cache of another network is of no use
+      memcmp(cached.ext_pan_id, info->ext_pan_id, sizeof(cached.ext_pan_id)) ==
+          0;
+}
+
+static void store_cache(void) {
+  hal_zigbee_network_info info;
+  if (!hal_zigbee_get_network_info(&info) || !channel_valid(info.channel))
+    return;
+  if (cached_valid && memcmp(&cached, &info, sizeof(info)) == 0)
+    return;
+  cached = info;
+  cached_valid = true;
+  nvm_cache_write(NV_ITEM_NETWORK_RESTORE_DATA, sizeof(cached),
+                  (uint8_t *)&cached);
+}
+
+static void schedule_attempt(uint32_t delay_ms) {
+  hal_tasks_schedule(&rejoin_task, delay_ms);
+}
+
+static void schedule_scan_retry(void) {
+  if (failed_scans < UINT8_MAX)
+    failed_scans++;
+  schedule_attempt(network_steering_backoff_delay(failed_scans));
+}
+
+static void rejoin_handler(void *arg) {
+  hal_zigbee_network_info info;
+  if (hal_zigbee_get_network_status() != HAL_ZIGBEE_NETWORK_NOT_JOINED)
+    return;
+  if (!hal_zigbee_get_network_info(&info)) {
+    in_progress = false; // Left, the status change let steering take over
+    return;
+  }
+
+  uint32_t channel_mask = HAL_ZIGBEE_ALL_CHANNELS_MASK;
+  attempt_was_scan = true;
+  if (cached_valid && fast_attempts < FAST_REJOIN_ATTEMPTS) {
+    fast_attempts++;
+    channel_mask = 1UL << cached.channel;
+    attempt_was_scan = false;
+    printf("Rejoining on channel %d\r\n", cached.channel);
+  } else {
+    printf("Rejoining, scanning all channels\r\n");
+  }
+
+  attempt_in_progress = true;
+  if (hal_zigbee_rejoin(channel_mask) != HAL_ZIGBEE_OK) {
+    attempt_in_progress = false;
+    schedule_scan_retry();
+  }
+}
+
+static void start(void) {
+  hal_zigbee_network_info info;
+  if (!hal_zigbee_get_network_info(&info))
+    return; // Factory new, a job for network steering
+  load_cache(&info);
+  in_progress = true;
+  fast_attempts = 0;
+  failed_scans = 0;
+  schedule_attempt(0);
+}
+
+void fast_rejoin_init(void) {
+  rejoin_task.handler = rejoin_handler;
+  rejoin_task.arg = NULL;
+  hal_tasks_init(&rejoin_task);
+  initialized = true;
+
+  hal_zigbee_network_info info;
+  if (hal_zigbee_get_network_info(&info))
+    load_cache(&info);
+
+  switch (hal_zigbee_get_network_status()) {
+  case HAL_ZIGBEE_NETWORK_JOINED:
+    store_cache();
+    break;
+  case HAL_ZIGBEE_NETWORK_NOT_JOINED:
+    start();
+    break;
+  case HAL_ZIGBEE_NETWORK_JOINING:
+    break;
+  }
+}
+
+void fast_rejoin_on_network_status_change(
+    hal_zigbee_network_status_t new_status) {
+  // Stacks report the restored status while starting, before app_init()
+  // has finished
+  if (!initialized)
+    return;
+
+  hal_zigbee_network_info info;
+
+  switch (new_status) {
+  case HAL_ZIGBEE_NETWORK_JOINED:
+    in_progress = false;
+    attempt_in_progress = false;
+    hal_tasks_unschedule(&rejoin_task);
+    store_cache();
+    break;
+  case HAL_ZIGBEE_NETWORK_JOINING:
+    break;
+  case HAL_ZIGBEE_NETWORK_NOT_JOINED:
+    if (!hal_zigbee_get_network_info(&info)) {
+      // Left the network, steering takes over
+      in_progress = false;
+      attempt_in_progress = false;
+      hal_tasks_unschedule(&rejoin_task);
+    } else if (attempt_in_progress) {
+      attempt_in_progress = false;
+      // Straight on to the next attempt, full scans that found nothing wait
+      // before the next one
+      if (attempt_was_scan) {
+        schedule_scan_retry();
+      } else {
+        schedule_attempt(0);
+      }
+    } else if (!in_progress) {
+      start(); // Lost the network
+    }
+    break;
+  }
+}
+
+bool fast_rejoin_in_progress(void) { return in_progress; }
+
+#ifdef HAL_STUB
+void fast_rejoin_reset_state(void) {
+  initialized = false;
+  in_progress = false;
+  attempt_in_progress = false;
+  attempt_was_scan = false;
+  fast_attempts = 0;
+  failed_scans = 0;
+  cached_valid = false;
+  memset(&cached, 0, sizeof(cached));
+}
+#endif
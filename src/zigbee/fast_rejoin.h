@@ -0,0 +1,40 @@
+#ifndef _FAST_REJOIN_H_
+#define _FAST_REJOIN_H_
+
+#include "hal/zigbee.h"
+#include <stdbool.h>
+
+// A device that comes back from a power cycle still commissioned but not
+// joined rejoins on the channel it was last joined on, kept in NVM, and only
+// scans all channels when that fails. Failed full scans back off like network
+// steering does. Network steering stays off meanwhile, the stack still holds
+// the network keys.
+
+// Rejoins on the cached channel before falling back to a full scan
+#ifndef FAST_REJOIN_ATTEMPTS
+#define FAST_REJOIN_ATTEMPTS 2
+#endif
+
+/**
+ * Loads the cached channel and starts rejoining if needed, called at the end
+ * of app_init() before network_steering_init()
+ */
+void fast_rejoin_init(void);
+
+/**
+ * Caches the network once joined, moves on to the next attempt after a
+ * failed one. Called on every network status change, before network steering.
+ * @param new_status Status reported by the stack
+ */
+void fast_rejoin_on_network_status_change(
+    hal_zigbee_network_status_t new_status);
+
+/** @return true while rejoining, network steering must wait */
+bool fast_rejoin_in_progress(void);
+
+#ifdef HAL_STUB
+// Host simulator only, see app_reset_state()
+void fast_rejoin_reset_state(void);
+#endif
+
+#endif
@@ -1,13 +1,16 @@
 #include "basic_cluster.h"
 #include "consts.h"
 #include "hal/printf_selector.h"
+#include "hal/tlog.h"
+#include "poll_control.h"
 #include "relay_cluster.h"
 #include "switch_cluster.h"
 
 static void zigbee_on_attr_change(uint8_t endpoint, uint8_t cluster_id,
                                   uint16_t attribute_id) {
-  printf("Attribute changed, ep: %d, cluster: %d, attr: %d\r\n", endpoint,
-         cluster_id, attribute_id);
+  TLOG("Attribute changed, ep: %d, cluster: %d, attr: %d\r\n", endpoint,
+       cluster_id, attribute_id);
+  poll_control_on_activity();
   if (cluster_id == ZCL_CLUSTER_BASIC) {
     basic_cluster_callback_attr_write_trampoline(attribute_id);
   } else if (cluster_id == ZCL_CLUSTER_ON_OFF_SWITCH_CONFIG) {
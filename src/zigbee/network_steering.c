@@ -0,0 +1,113 @@
+#include "network_steering.h"
+
+#include "device_random.h"
+#include "fast_rejoin.h"
+#include "hal/printf_selector.h"
+#include "hal/tasks.h"
+
+// Attempts past this one all wait the capped delay
+#define MAX_BACKOFF_SHIFT 16
+
+static hal_task_t steering_task;
+static bool initialized = false;
+static bool attempt_in_progress = false; // Started, waiting for the outcome
+static bool attempt_scheduled = false;
+static uint8_t failed_attempts = 0;
+
+uint32_t network_steering_backoff_delay(uint8_t failed_attempts) {
+  uint8_t shift = failed_attempts - 1;
+  if (shift > MAX_BACKOFF_SHIFT)
+    shift = MAX_BACKOFF_SHIFT;
+  uint32_t delay = NETWORK_STEERING_BACKOFF_BASE_MS;
+  while (shift-- && delay < NETWORK_STEERING_BACKOFF_CAP_MS) {
+    delay *= 2;
+  }
+  if (delay > NETWORK_STEERING_BACKOFF_CAP_MS)
+    delay = NETWORK_STEERING_BACKOFF_CAP_MS;
+  return delay / 2 + device_random_below(delay / 2 + 1);
+}
+
+static void schedule_attempt(uint32_t delay_ms) {
+  printf("Network steering in %d ms\r\n", delay_ms);
+  attempt_scheduled = true;
+  hal_tasks_schedule(&steering_task, delay_ms);
+}
+
+static void schedule_first_attempt(void) {
+  failed_attempts = 0;
+  schedule_attempt(device_random_below(NETWORK_STEERING_INITIAL_WINDOW_MS));
+}
+
+static void schedule_retry(void) {
+  if (failed_attempts < UINT8_MAX)
+    failed_attempts++;
+  schedule_attempt(network_steering_backoff_delay(failed_attempts));
+}
+
+static void steering_handler(void *arg) {
+  attempt_scheduled = false;
+  // Joined or joining on its own (rejoin) meanwhile
+  if (hal_zigbee_get_network_status() != HAL_ZIGBEE_NETWORK_NOT_JOINED ||
+      fast_rejoin_in_progress())
+    return;
+
+  attempt_in_progress = true;
+  hal_zigbee_start_network_steering();
+  // The stack refused to start, no status change will come for it
+  if (hal_zigbee_get_network_status() == HAL_ZIGBEE_NETWORK_NOT_JOINED) {
+    attempt_in_progress = false;
+    schedule_retry();
+  }
+}
+
+void network_steering_init(void) {
+  steering_task.handler = steering_handler;
+  steering_task.arg = NULL;
+  hal_tasks_init(&steering_task);
+  initialized = true;
+
+  if (hal_zigbee_get_network_status() == HAL_ZIGBEE_NETWORK_NOT_JOINED &&
+      !fast_rejoin_in_progress())
+    schedule_first_attempt();
+}
+
+void network_steering_on_network_status_change(
+    hal_zigbee_network_status_t new_status) {
+  // Stacks report the restored status while starting, before app_init()
+  // has finished
+  if (!initialized)
+    return;
+
+  switch (new_status) {
+  case HAL_ZIGBEE_NETWORK_JOINED:
+    attempt_in_progress = false;
+    failed_attempts = 0;
+    if (attempt_scheduled) {
+      hal_tasks_unschedule(&steering_task);
+      attempt_scheduled = false;
+    }
+    break;
+  case HAL_ZIGBEE_NETWORK_JOINING:
+    break;
+  case HAL_ZIGBEE_NETWORK_NOT_JOINED:
+    if (fast_rejoin_in_progress())
+      break; // Still commissioned, rejoining instead
+    if (attempt_in_progress) {
+      attempt_in_progress = false;
+      schedule_retry();
+    } else if (!attempt_scheduled) {
+      // Left or lost the network
+      schedule_first_attempt();
+    }
+    break;
+  }
+}
+
+#ifdef HAL_STUB
+void network_steering_reset_state(void) {
+  initialized = false;
+  attempt_in_progress = false;
+  attempt_scheduled = false;
+  failed_attempts = 0;
+}
+#endif
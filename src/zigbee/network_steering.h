@@ -0,0 +1,49 @@
+#ifndef _NETWORK_STEERING_H_
+#define _NETWORK_STEERING_H_
+
+#include "hal/zigbee.h"
+
+// Devices that lost the network wait a random part of this window before the
+// first steering attempt, so a building coming back from a power cut does not
+// flood the coordinator with beacon requests at once
+#ifndef NETWORK_STEERING_INITIAL_WINDOW_MS
+#define NETWORK_STEERING_INITIAL_WINDOW_MS 5000
+#endif
+
+// Retry delay after the first failed attempt, doubled after each further one
+#ifndef NETWORK_STEERING_BACKOFF_BASE_MS
+#define NETWORK_STEERING_BACKOFF_BASE_MS 10000
+#endif
+
+#ifndef NETWORK_STEERING_BACKOFF_CAP_MS
+#define NETWORK_STEERING_BACKOFF_CAP_MS (5 * 60 * 1000)
+#endif
+
+/**
+ * Retry delay after failed attempts, also used by fast_rejoin for its full
+ * scans. A random point in [delay / 2, delay], keeps the backoff growing
+ * while still spreading devices that failed together.
+ * @param failed_attempts Failed attempts so far, at least 1
+ * @return Delay in milliseconds
+ */
+uint32_t network_steering_backoff_delay(uint8_t failed_attempts);
+
+/**
+ * Schedules the first attempt when not joined, called once at the end of
+ * app_init(), after device_random_init() and fast_rejoin_init()
+ */
+void network_steering_init(void);
+
+/**
+ * Restarts or backs off steering, called on every network status change
+ * @param new_status Status reported by the stack
+ */
+void network_steering_on_network_status_change(
+    hal_zigbee_network_status_t new_status);
+
+#ifdef HAL_STUB
+// Host simulator only, see app_reset_state()
+void network_steering_reset_state(void);
+#endif
+
+#endif
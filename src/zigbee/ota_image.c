@@ -0,0 +1,474 @@
+#include "ota_image.h"
+
+#include "hal/printf_selector.h"
+#include "hal/zigbee_ota.h"
+#include <string.h>
+
+// Container header fields, little endian. Offsets 6, 8 and 24 are where a
+// Telink image keeps its magic, boot flag and size, they stay invalid.
+#define HDR_MAGIC 0
+#define HDR_VERSION 4
+#define HDR_ALGORITHM 5
+#define HDR_IMAGE_SIZE 12
+#define HDR_IMAGE_CRC 16
+#define HDR_DATA_SIZE 20
+
+// A delta block starts with the size, CRC32 and file version of its base
+#define BASE_INFO_SIZE 12
+
+// Delta ops: kind in the top 2 bits, length - 1 in the others. The maximum
+// means a varint of length - 64 follows.
+#define DELTA_OP_LITERALS 0
+#define DELTA_OP_COPY_BASE 1   // Then a zigzag varint, base cursor move
+#define DELTA_OP_COPY_OUTPUT 2 // Then a varint, distance back in the output
+#define DELTA_SHORT_LEN_MAX 63
+#define DELTA_LONG_LEN_BASE 64
+
+// Flash reads of a copy are done in chunks of this size
+#define COPY_READ_CHUNK 16
+
+typedef enum {
+  STEP_HEADER,
+  // LZ4
+  STEP_TOKEN,
+  STEP_LITERAL_LEN,
+  STEP_LITERALS,
+  STEP_OFFSET_LO,
+  STEP_OFFSET_HI,
+  STEP_MATCH_LEN,
+  // Delta
+  STEP_BASE_INFO,
+  STEP_OP,
+  STEP_OP_LEN,
+  STEP_OP_ARG,
+  STEP_OP_LITERALS,
+} decode_step_t;
+
+static ota_image_state_t state = OTA_IMAGE_IDLE;
+static decode_step_t step;
+static uint32_t in_offset; // Next upgrade image offset expected
+
+static uint8_t header[OTA_IMAGE_HEADER_SIZE];
+static uint8_t algorithm;
+static uint32_t image_size;
+static uint32_t image_crc;
+static uint32_t data_end; // Upgrade image offset after the block
+
+static uint32_t crc;
+static uint32_t out_size;   // Written and buffered
+static uint32_t erased_end; // Slot offset up to which sectors are erased
+
+// Output not yet in the slot, it starts at slot offset page_start
+static uint8_t page[OTA_IMAGE_PAGE_SIZE];
+static uint32_t page_start;
+static uint16_t page_len;
+
+static uint8_t token;
+static uint32_t literal_len;
+static uint32_t match_len;
+static uint16_t match_offset;
+
+static uint8_t base_info[BASE_INFO_SIZE];
+static uint8_t base_info_len;
+static uint32_t base_size;
+static uint32_t base_crc;
+static uint32_t base_hashed; // Running firmware bytes in base_crc so far
+static uint32_t base_cursor;
+static uint8_t op;
+static uint32_t op_len;
+static uint32_t varint;
+static uint8_t varint_shift;
+
+static uint32_t read_u32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// zlib CRC32 without a table, flash is tighter than time here
+static uint32_t crc32_update(uint32_t value, uint8_t byte) {
+  value ^= byte;
+  for (uint8_t i = 0; i < 8; i++)
+    value = (value >> 1) ^ (0xEDB88320 & -(value & 1));
+  return value;
+}
+
+static void fail(const char *reason) {
+  printf("OTA image failed: %s at %d\r\n", reason, in_offset);
+  state = OTA_IMAGE_FAILED;
+  // Whatever got written must never pass for a firmware
+  hal_ota_slot_erase_sector(0);
+}
+
+static void flush_page(void) {
+  if (page_len == 0)
+    return;
+  uint32_t end = page_start + page_len;
+  while (erased_end < end) {
+    hal_ota_slot_erase_sector(erased_end);
+    erased_end += HAL_OTA_SLOT_SECTOR_SIZE;
+  }
+  hal_ota_slot_write(page_start, page, page_len);
+  page_start = end;
+  page_len = 0;
+}
+
+static bool emit(uint8_t byte) {
+  if (out_size >= image_size) {
+    fail("image too long");
+    return false;
+  }
+  crc = crc32_update(crc, byte);
+  page[page_len++] = byte;
+  out_size++;
+  if (page_len == sizeof(page))
+    flush_page();
+  return true;
+}
+
+// Copies len bytes from distance back in the output. Bytes still in the page
+// come from RAM, older ones are read back from the slot.
+static void copy_output(uint32_t distance, uint32_t len) {
+  if (distance == 0 || distance > out_size) {
+    fail("bad copy distance");
+    return;
+  }
+  uint8_t chunk[COPY_READ_CHUNK];
+  while (len > 0) {
+    uint32_t src = out_size - distance;
+    if (src >= page_start) {
+      if (!emit(page[src - page_start]))
+        return;
+      len--;
+      continue;
+    }
+    // Only what is in the slot already, an overlapping copy picks the rest
+    // from the page on the next round
+    uint32_t n = page_start - src;
+    if (n > len)
+      n = len;
+    if (n > sizeof(chunk))
+      n = sizeof(chunk);
+    hal_ota_slot_read(src, chunk, n);
+    for (uint32_t i = 0; i < n; i++) {
+      if (!emit(chunk[i]))
+        return;
+    }
+    len -= n;
+  }
+}
+
+static void copy_base(uint32_t from, uint32_t len) {
+  if (from > base_size || len > base_size - from) {
+    fail("copy past the base");
+    return;
+  }
+  uint8_t chunk[COPY_READ_CHUNK];
+  while (len > 0) {
+    uint32_t n = len < sizeof(chunk) ? len : sizeof(chunk);
+    hal_ota_running_read(from, chunk, n);
+    for (uint32_t i = 0; i < n; i++) {
+      if (!emit(chunk[i]))
+        return;
+    }
+    from += n;
+    len -= n;
+  }
+}
+
+static void start_base(void) {
+  base_size = read_u32(base_info);
+  if (base_size == 0 || base_size > hal_ota_slot_size()) {
+    fail("bad base size");
+    return;
+  }
+  base_crc = 0xFFFFFFFF;
+  base_hashed = 0;
+  base_cursor = 0;
+  step = STEP_OP;
+}
+
+// The base has to be the running firmware, byte for byte. Hashing all of it
+// at once takes too long for one block (bitwise CRC32 of ~200 KB against a
+// 1 s watchdog on Telink), so each block hashes its share and the last one
+// completes it. A patch for another firmware is refused by then, before its
+// result can pass for an image.
+static void hash_base(uint32_t end) {
+  uint8_t chunk[COPY_READ_CHUNK];
+  if (end > base_size)
+    end = base_size;
+  while (base_hashed < end) {
+    uint32_t n = end - base_hashed;
+    if (n > sizeof(chunk))
+      n = sizeof(chunk);
+    hal_ota_running_read(base_hashed, chunk, n);
+    for (uint32_t i = 0; i < n; i++)
+      base_crc = crc32_update(base_crc, chunk[i]);
+    base_hashed += n;
+  }
+  if (base_hashed == base_size && ~base_crc != read_u32(base_info + 4))
+    fail("patch is for another firmware");
+}
+
+// As much of the base as the block data received so far, the whole of it
+// once the block is complete
+static void hash_base_for_input(void) {
+  if (algorithm != OTA_IMAGE_ALGORITHM_DELTA || step == STEP_HEADER ||
+      step == STEP_BASE_INFO)
+    return;
+  hash_base((uint32_t)((uint64_t)base_size * in_offset / data_end));
+}
+
+static void finish(void) {
+  flush_page();
+  if (algorithm == OTA_IMAGE_ALGORITHM_DELTA) {
+    hash_base(base_size);
+    if (state != OTA_IMAGE_RECEIVING)
+      return;
+  }
+  if (out_size != image_size) {
+    fail("image too short");
+  } else if (~crc != image_crc) {
+    fail("CRC mismatch");
+  } else {
+    printf("OTA image decompressed: %d bytes\r\n", out_size);
+    state = OTA_IMAGE_DONE;
+  }
+}
+
+static void parse_header(void) {
+  algorithm = header[HDR_ALGORITHM];
+  if (read_u32(header + HDR_MAGIC) != OTA_IMAGE_MAGIC ||
+      header[HDR_VERSION] != OTA_IMAGE_FORMAT_VERSION ||
+      (algorithm != OTA_IMAGE_ALGORITHM_LZ4 &&
+       algorithm != OTA_IMAGE_ALGORITHM_DELTA)) {
+    fail("unsupported container");
+    return;
+  }
+  image_size = read_u32(header + HDR_IMAGE_SIZE);
+  image_crc = read_u32(header + HDR_IMAGE_CRC);
+  data_end = OTA_IMAGE_HEADER_SIZE + read_u32(header + HDR_DATA_SIZE);
+  if (image_size == 0 || image_size > hal_ota_slot_size()) {
+    fail("bad image size");
+    return;
+  }
+  if (algorithm == OTA_IMAGE_ALGORITHM_DELTA) {
+    base_info_len = 0;
+    step = STEP_BASE_INFO;
+  } else {
+    step = STEP_TOKEN;
+  }
+}
+
+// Long lengths of LZ4 go on in bytes of 255, the first smaller one ends them
+static bool extend_len(uint32_t *len, uint8_t byte) {
+  *len += byte;
+  return byte != 255;
+}
+
+static void lz4_byte(uint8_t byte) {
+  switch (step) {
+  case STEP_TOKEN:
+    token = byte;
+    literal_len = token >> 4;
+    match_len = token & 0x0f;
+    if (literal_len == 15)
+      step = STEP_LITERAL_LEN;
+    else
+      step = literal_len ? STEP_LITERALS : STEP_OFFSET_LO;
+    break;
+  case STEP_LITERAL_LEN:
+    if (extend_len(&literal_len, byte))
+      step = literal_len ? STEP_LITERALS : STEP_OFFSET_LO;
+    break;
+  case STEP_LITERALS:
+    if (!emit(byte))
+      return;
+    if (--literal_len == 0)
+      step = STEP_OFFSET_LO;
+    break;
+  case STEP_OFFSET_LO:
+    match_offset = byte;
+    step = STEP_OFFSET_HI;
+    break;
+  case STEP_OFFSET_HI:
+    match_offset |= byte << 8;
+    match_len += 4; // LZ4 minimum match
+    if ((token & 0x0f) == 15) {
+      step = STEP_MATCH_LEN;
+      break;
+    }
+    copy_output(match_offset, match_len);
+    step = STEP_TOKEN;
+    break;
+  case STEP_MATCH_LEN:
+    if (extend_len(&match_len, byte)) {
+      copy_output(match_offset, match_len);
+      step = STEP_TOKEN;
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+static void run_op(void) {
+  switch (op) {
+  case DELTA_OP_COPY_BASE:
+    // varint is the zigzag encoded cursor move
+    base_cursor += (varint & 1) ? ~(varint >> 1) : (varint >> 1);
+    copy_base(base_cursor, op_len);
+    base_cursor += op_len;
+    break;
+  case DELTA_OP_COPY_OUTPUT:
+    copy_output(varint, op_len);
+    break;
+  default:
+    fail("bad delta op");
+    return;
+  }
+  step = STEP_OP;
+}
+
+// LEB128, false while more bytes follow
+static bool varint_byte(uint8_t byte) {
+  if (varint_shift > 28) {
+    fail("bad varint");
+    return false;
+  }
+  varint |= (uint32_t)(byte & 0x7f) << varint_shift;
+  varint_shift += 7;
+  return !(byte & 0x80);
+}
+
+static void start_varint(decode_step_t next) {
+  varint = 0;
+  varint_shift = 0;
+  step = next;
+}
+
+// Length known, literals follow or the op argument
+static void op_len_done(void) {
+  if (op == DELTA_OP_LITERALS) {
+    step = STEP_OP_LITERALS;
+  } else {
+    start_varint(STEP_OP_ARG);
+  }
+}
+
+static void delta_byte(uint8_t byte) {
+  switch (step) {
+  case STEP_BASE_INFO:
+    base_info[base_info_len++] = byte;
+    if (base_info_len == BASE_INFO_SIZE)
+      start_base();
+    break;
+  case STEP_OP:
+    op = byte >> 6;
+    op_len = (byte & 0x3f) + 1;
+    if (op_len > DELTA_SHORT_LEN_MAX)
+      start_varint(STEP_OP_LEN);
+    else
+      op_len_done();
+    break;
+  case STEP_OP_LEN:
+    if (varint_byte(byte)) {
+      op_len = DELTA_LONG_LEN_BASE + varint;
+      op_len_done();
+    }
+    break;
+  case STEP_OP_ARG:
+    if (varint_byte(byte))
+      run_op();
+    break;
+  case STEP_OP_LITERALS:
+    if (!emit(byte))
+      return;
+    base_cursor++; // Literals mostly stand in for as many base bytes
+    if (--op_len == 0)
+      step = STEP_OP;
+    break;
+  default:
+    break;
+  }
+}
+
+static void decode_byte(uint8_t byte) {
+  if (step == STEP_HEADER) {
+    header[in_offset] = byte;
+    if (in_offset == OTA_IMAGE_HEADER_SIZE - 1)
+      parse_header();
+  } else if (algorithm == OTA_IMAGE_ALGORITHM_DELTA) {
+    delta_byte(byte);
+  } else {
+    lz4_byte(byte);
+  }
+}
+
+// The last byte of the block has to end a sequence or an op
+static bool at_block_end(void) {
+  if (algorithm == OTA_IMAGE_ALGORITHM_DELTA)
+    return step == STEP_OP;
+  // An LZ4 block ends with literals
+  return step == STEP_OFFSET_LO;
+}
+
+bool ota_image_is_compressed(const uint8_t *data, uint32_t len) {
+  return len >= 4 && read_u32(data + HDR_MAGIC) == OTA_IMAGE_MAGIC;
+}
+
+void ota_image_begin(void) {
+  state = OTA_IMAGE_RECEIVING;
+  step = STEP_HEADER;
+  in_offset = 0;
+  crc = 0xFFFFFFFF;
+  out_size = 0;
+  erased_end = 0;
+  page_start = 0;
+  page_len = 0;
+  image_size = 0;
+  data_end = OTA_IMAGE_HEADER_SIZE;
+}
+
+ota_image_state_t ota_image_write(uint32_t offset, const uint8_t *data,
+                                  uint32_t len) {
+  if (state != OTA_IMAGE_RECEIVING)
+    return state;
+  if (offset > in_offset) {
+    fail("gap in the image");
+    return state;
+  }
+  uint32_t skip = in_offset - offset;
+  for (uint32_t i = skip; i < len && state == OTA_IMAGE_RECEIVING; i++) {
+    if (step != STEP_HEADER && in_offset >= data_end) {
+      fail("data after the image");
+      break;
+    }
+    decode_byte(data[i]);
+    in_offset++;
+    // The last byte of the block completes the image
+    if (step != STEP_HEADER && in_offset == data_end &&
+        state == OTA_IMAGE_RECEIVING) {
+      if (!at_block_end())
+        fail("truncated block");
+      else
+        finish();
+    }
+  }
+  // Output of a block goes to the slot before the next block is requested
+  if (state == OTA_IMAGE_RECEIVING) {
+    flush_page();
+    hash_base_for_input();
+  }
+  return state;
+}
+
+ota_image_state_t ota_image_state(void) { return state; }
+
+uint32_t ota_image_output_size(void) { return out_size; }
+
+#ifdef HAL_STUB
+void ota_image_reset_state(void) {
+  state = OTA_IMAGE_IDLE;
+  in_offset = 0;
+  out_size = 0;
+}
+#endif
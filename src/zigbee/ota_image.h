@@ -0,0 +1,70 @@
+#ifndef _OTA_IMAGE_H_
+#define _OTA_IMAGE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Compressed OTA images, made by helper_scripts/ota_compress.py. The upgrade
+// image of such a file is a container: a header with the size and CRC32 of
+// the firmware, then the firmware as an LZ4 block. Blocks are decompressed as
+// they arrive and written straight to the OTA slot. Matches are read back
+// from the slot, so RAM use does not depend on the LZ4 window.
+//
+// Delta images (helper_scripts/ota_delta.py) use the same container with a
+// patch against the running firmware instead of the LZ4 block. The patch
+// names the size and CRC32 of its base, it is refused on any other firmware.
+//
+// Either way the result is only usable once its CRC32 matched. The container
+// is not a valid firmware image on purpose, a device without decompression
+// rejects it instead of booting it.
+
+#define OTA_IMAGE_MAGIC 0x504d435a // "ZCMP"
+#define OTA_IMAGE_FORMAT_VERSION 1
+#define OTA_IMAGE_ALGORITHM_LZ4 1
+#define OTA_IMAGE_ALGORITHM_DELTA 2
+#define OTA_IMAGE_HEADER_SIZE 32
+
+// Output is buffered and written in chunks of this size at most
+#ifndef OTA_IMAGE_PAGE_SIZE
+#define OTA_IMAGE_PAGE_SIZE 256
+#endif
+
+typedef enum {
+  OTA_IMAGE_IDLE = 0,
+  OTA_IMAGE_RECEIVING,
+  OTA_IMAGE_DONE,   // Complete and the CRC matches
+  OTA_IMAGE_FAILED, // Slot invalidated, the download has to restart
+} ota_image_state_t;
+
+/**
+ * Checks the first bytes of an upgrade image for the container magic
+ * @param len Bytes available, images shorter than the magic are plain
+ * @return true if the image has to go through ota_image_write()
+ */
+bool ota_image_is_compressed(const uint8_t *data, uint32_t len);
+
+/** Starts a new compressed image, dropping any unfinished one */
+void ota_image_begin(void);
+
+/**
+ * Decompresses the next part of the upgrade image into the OTA slot. The
+ * slot is erased as the output grows. Parts that were already processed are
+ * skipped, for retransmitted blocks.
+ * @param offset Offset of data in the upgrade image
+ * @return State after the part, the slot is usable once OTA_IMAGE_DONE
+ */
+ota_image_state_t ota_image_write(uint32_t offset, const uint8_t *data,
+                                  uint32_t len);
+
+/** @return State of the current image */
+ota_image_state_t ota_image_state(void);
+
+/** @return Firmware bytes written to the slot so far */
+uint32_t ota_image_output_size(void);
+
+#ifdef HAL_STUB
+// Host simulator only, see app_reset_state()
+void ota_image_reset_state(void);
+#endif
+
+#endif
@@ -0,0 +1,134 @@
+#include "ota_resume.h"
+
+#include "device_config/nvm_cache.h"
+#include "device_config/nvm_items.h"
+#include "hal/printf_selector.h"
+#include "hal/timer.h"
+#include "hal/zigbee_ota.h"
+#include <stdbool.h>
+#include <string.h>
+
+#define CRC_INIT 0xFFFFFFFF
+
+// Stored data is read for the CRC in chunks of this size
+#define HASH_READ_CHUNK 32
+
+typedef struct {
+  hal_ota_image_id_t image;
+  uint32_t offset; // Stored data hashed up to here
+  uint32_t crc;    // Running CRC32 of it, not inverted
+} ota_resume_record_t;
+
+static ota_resume_record_t record; // As in NVM
+static uint32_t hashed = 0;        // Progress, saved to record now and then
+static uint32_t crc = CRC_INIT;
+static uint32_t last_check_ms = 0;
+
+// zlib CRC32 without a table, as in ota_image.c
+static uint32_t crc32_update(uint32_t value, uint8_t byte) {
+  value ^= byte;
+  for (uint8_t i = 0; i < 8; i++)
+    value = (value >> 1) ^ (0xEDB88320 & -(value & 1));
+  return value;
+}
+
+static uint32_t hash_partial(uint32_t value, uint32_t from, uint32_t to) {
+  uint8_t chunk[HASH_READ_CHUNK];
+  while (from < to) {
+    uint32_t n = to - from;
+    if (n > sizeof(chunk))
+      n = sizeof(chunk);
+    hal_ota_partial_read(from, chunk, n);
+    for (uint32_t i = 0; i < n; i++)
+      value = crc32_update(value, chunk[i]);
+    from += n;
+  }
+  return value;
+}
+
+static bool same_image(const hal_ota_image_id_t *a,
+                       const hal_ota_image_id_t *b) {
+  return a->manufacturer_code == b->manufacturer_code &&
+         a->image_type == b->image_type && a->file_version == b->file_version;
+}
+
+static void save(void) {
+  record.offset = hashed;
+  record.crc = crc;
+  nvm_cache_write(NV_ITEM_OTA_RESUME_DATA, sizeof(record), (uint8_t *)&record);
+}
+
+// Starts over for image, an empty record replaces any progress in NVM
+static void restart(const hal_ota_image_id_t *image) {
+  bool had_progress = record.offset > 0;
+  if (image != NULL)
+    record.image = *image;
+  hashed = 0;
+  crc = CRC_INIT;
+  if (had_progress)
+    save();
+}
+
+void ota_resume_init(void) {
+  if (nvm_cache_read(NV_ITEM_OTA_RESUME_DATA, sizeof(record),
+                     (uint8_t *)&record) != HAL_NVM_SUCCESS)
+    memset(&record, 0, sizeof(record));
+  hashed = 0;
+  crc = CRC_INIT;
+  last_check_ms = hal_millis();
+
+  hal_ota_image_id_t image;
+  uint32_t offset;
+  if (!hal_ota_partial_get(&image, &offset)) {
+    restart(NULL);
+    return;
+  }
+  if (record.offset > 0 && same_image(&record.image, &image) &&
+      record.offset <= offset &&
+      // Anything else may have used the storage since
+      hash_partial(CRC_INIT, 0, record.offset) == record.crc) {
+    hashed = record.offset;
+    crc = record.crc;
+    printf("OTA resumes at %d, verified up to %d\r\n", offset, hashed);
+    return;
+  }
+  printf("Dropping partial OTA image, stored data not as recorded\r\n");
+  hal_ota_partial_clear();
+  restart(&image);
+}
+
+void ota_resume_update(void) {
+  uint32_t now = hal_millis();
+  if (now - last_check_ms < OTA_RESUME_CHECK_INTERVAL_MS)
+    return;
+  last_check_ms = now;
+
+  hal_ota_image_id_t image;
+  uint32_t offset;
+  if (!hal_ota_partial_get(&image, &offset)) {
+    // Completed or given up
+    if (hashed > 0 || record.offset > 0)
+      restart(NULL);
+    return;
+  }
+  // Another image, or the client started over
+  if (!same_image(&record.image, &image) || offset < hashed)
+    restart(&image);
+
+  uint32_t end = offset - hashed > OTA_RESUME_HASH_STEP
+                     ? hashed + OTA_RESUME_HASH_STEP
+                     : offset;
+  crc = hash_partial(crc, hashed, end);
+  hashed = end;
+  if (hashed - record.offset >= OTA_RESUME_SAVE_INTERVAL)
+    save();
+}
+
+#ifdef HAL_STUB
+void ota_resume_reset_state(void) {
+  memset(&record, 0, sizeof(record));
+  hashed = 0;
+  crc = CRC_INIT;
+  last_check_ms = 0;
+}
+#endif
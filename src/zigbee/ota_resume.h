@@ -0,0 +1,46 @@
+#ifndef _OTA_RESUME_H_
+#define _OTA_RESUME_H_
+
+#include <stdint.h>
+
+// Resumable OTA downloads. While the OTA client downloads an image, the image
+// id, the offset up to which the stored data has been hashed and a running
+// CRC32 of those bytes are kept in NVM. After a reboot the partial download
+// is only kept if it is the recorded image and its stored data still hashes
+// the same, the client then goes on from where it stopped. Anything else is
+// dropped and the next download starts from zero. The client itself drops it
+// when the server offers a different image.
+//
+// Bytes past the recorded offset are hashed after the reboot. Like the rest
+// of the image they are covered by the verification of the complete image.
+
+// How often the client's progress is looked at, from app_task()
+#ifndef OTA_RESUME_CHECK_INTERVAL_MS
+#define OTA_RESUME_CHECK_INTERVAL_MS 1000
+#endif
+
+// Stored data hashed per check at most, downloads are slower than that
+#ifndef OTA_RESUME_HASH_STEP
+#define OTA_RESUME_HASH_STEP 8192
+#endif
+
+// Progress is saved at most once per this many bytes, to spare the NVM
+#ifndef OTA_RESUME_SAVE_INTERVAL
+#define OTA_RESUME_SAVE_INTERVAL 4096
+#endif
+
+/**
+ * Keeps or drops the partial download of the last boot, called once from
+ * app_init()
+ */
+void ota_resume_init(void);
+
+/** Hashes and records the download progress, called from app_task() */
+void ota_resume_update(void);
+
+#ifdef HAL_STUB
+// Host simulator only, see app_reset_state()
+void ota_resume_reset_state(void);
+#endif
+
+#endif
@@ -0,0 +1,85 @@
+#include "poll_control.h"
+
+#include "device_config/nvm_cache.h"
+#include "device_config/nvm_items.h"
+#include "hal/printf_selector.h"
+#include "hal/timer.h"
+#include "hal/zigbee.h"
+
+poll_control_t poll_control = {
+    .short_interval_ms = POLL_CONTROL_SHORT_INTERVAL_MS,
+    .long_interval_ms = POLL_CONTROL_LONG_INTERVAL_MS,
+    .fast_timeout_ms = POLL_CONTROL_FAST_TIMEOUT_MS,
+};
+
+static uint32_t last_activity_ms = 0;
+static uint32_t applied_interval_ms = 0; // 0 makes the next update apply
+
+static void clamp_bounds(void) {
+  if (poll_control.short_interval_ms < POLL_CONTROL_MIN_INTERVAL_MS)
+    poll_control.short_interval_ms = POLL_CONTROL_MIN_INTERVAL_MS;
+  if (poll_control.long_interval_ms > POLL_CONTROL_MAX_INTERVAL_MS)
+    poll_control.long_interval_ms = POLL_CONTROL_MAX_INTERVAL_MS;
+  if (poll_control.long_interval_ms < poll_control.short_interval_ms)
+    poll_control.long_interval_ms = poll_control.short_interval_ms;
+}
+
+static uint32_t interval_due(uint32_t now) {
+  uint32_t idle = now - last_activity_ms;
+  if (idle < poll_control.fast_timeout_ms)
+    return poll_control.short_interval_ms;
+
+  uint32_t steps =
+      (idle - poll_control.fast_timeout_ms) / POLL_CONTROL_BACKOFF_STEP_MS + 1;
+  uint32_t interval = poll_control.short_interval_ms;
+  while (steps-- && interval < poll_control.long_interval_ms) {
+    interval *= 2;
+  }
+  return interval < poll_control.long_interval_ms
+             ? interval
+             : poll_control.long_interval_ms;
+}
+
+void poll_control_update(void) {
+  uint32_t interval = interval_due(hal_millis());
+  if (interval == applied_interval_ms)
+    return;
+  applied_interval_ms = interval;
+  printf("Poll interval %d ms\r\n", interval);
+  hal_zigbee_set_poll_interval(interval);
+}
+
+void poll_control_on_activity(void) {
+  last_activity_ms = hal_millis();
+  poll_control_update();
+}
+
+void poll_control_init(void) {
+  poll_control_t stored;
+  if (nvm_cache_read(NV_ITEM_POLL_CONTROL_DATA, sizeof(stored),
+                     (uint8_t *)&stored) == HAL_NVM_SUCCESS) {
+    poll_control = stored;
+    clamp_bounds();
+  }
+  applied_interval_ms = 0;
+  poll_control_on_activity();
+}
+
+void poll_control_on_attr_write(void) {
+  clamp_bounds();
+  nvm_cache_write(NV_ITEM_POLL_CONTROL_DATA, sizeof(poll_control),
+                  (uint8_t *)&poll_control);
+  // Bounds apply right away, shortened ones should not wait for the backoff
+  applied_interval_ms = 0;
+  poll_control_update();
+}
+
+#ifdef HAL_STUB
+void poll_control_reset_state(void) {
+  poll_control.short_interval_ms = POLL_CONTROL_SHORT_INTERVAL_MS;
+  poll_control.long_interval_ms = POLL_CONTROL_LONG_INTERVAL_MS;
+  poll_control.fast_timeout_ms = POLL_CONTROL_FAST_TIMEOUT_MS;
+  last_activity_ms = 0;
+  applied_interval_ms = 0;
+}
+#endif
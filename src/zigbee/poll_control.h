@@ -0,0 +1,70 @@
+#ifndef _POLL_CONTROL_H_
+#define _POLL_CONTROL_H_
+
+#include <stdint.h>
+
+#ifdef HAL_SILABS
+#include "silabs_config.h"
+#endif
+
+// Adaptive poll interval of end devices. They poll fast for a while after
+// local activity or an incoming command, then double the interval every
+// POLL_CONTROL_BACKOFF_STEP_MS up to the long interval. Routers never poll,
+// the HAL ignores the interval there.
+//
+// The long interval defaults to the short one, so a switch stays as reactive
+// to commands as with a fixed poll rate. Backoff is opt-in over ZCL.
+
+// Only end devices expose the bounds, the host simulator runs the end device
+// policy so it can be tested
+#if defined(END_DEVICE) || defined(HAL_STUB)
+#define POLL_CONTROL_ATTRS
+#endif
+
+#ifndef POLL_CONTROL_SHORT_INTERVAL_MS
+#define POLL_CONTROL_SHORT_INTERVAL_MS 250
+#endif
+
+#ifndef POLL_CONTROL_LONG_INTERVAL_MS
+#define POLL_CONTROL_LONG_INTERVAL_MS POLL_CONTROL_SHORT_INTERVAL_MS
+#endif
+
+#ifndef POLL_CONTROL_FAST_TIMEOUT_MS
+#define POLL_CONTROL_FAST_TIMEOUT_MS 10000
+#endif
+
+#ifndef POLL_CONTROL_BACKOFF_STEP_MS
+#define POLL_CONTROL_BACKOFF_STEP_MS 5000
+#endif
+
+// Written bounds are clamped to these
+#define POLL_CONTROL_MIN_INTERVAL_MS 50
+#define POLL_CONTROL_MAX_INTERVAL_MS (60 * 60 * 1000)
+
+// Attribute values, writable over ZCL on the basic cluster
+typedef struct {
+  uint16_t short_interval_ms;
+  uint32_t long_interval_ms;
+  uint32_t fast_timeout_ms; // Fast polling after the last activity
+} poll_control_t;
+
+extern poll_control_t poll_control;
+
+/** Loads the bounds from NVM and starts with fast polling */
+void poll_control_init(void);
+
+/** Applies the interval due now, called from the main loop */
+void poll_control_update(void);
+
+/** Restarts fast polling, on local activity or an incoming command */
+void poll_control_on_activity(void);
+
+/** Clamps, stores and applies the bounds after a ZCL write */
+void poll_control_on_attr_write(void);
+
+#ifdef HAL_STUB
+// Host simulator only, see app_reset_state()
+void poll_control_reset_state(void);
+#endif
+
+#endif
@@ -1,9 +1,12 @@
 #include "relay_cluster.h"
+#include "base_components/diagnostics.h"
 #include "cluster_common.h"
 #include "consts.h"
+#include "device_config/capacities.h"
+#include "device_config/nvm_cache.h"
 #include "device_config/nvm_items.h"
-#include "hal/nvm.h"
 #include "hal/printf_selector.h"
+#include "poll_control.h"
 
 hal_zigbee_cmd_result_t relay_cluster_callback(zigbee_relay_cluster *cluster,
                                                uint8_t command_id,
@@ -23,8 +26,11 @@ void relay_cluster_load_attrs_from_nv(zigbee_relay_cluster *cluster);
 void relay_cluster_handle_startup_mode(zigbee_relay_cluster *cluster);
 
 void sync_indicator_led(zigbee_relay_cluster *cluster);
+static void apply_indicator_led(zigbee_relay_cluster *cluster);
 
-zigbee_relay_cluster *relay_cluster_by_endpoint[10];
+// Indexed by endpoint number
+zigbee_relay_cluster
+    *relay_cluster_by_endpoint[DEVICE_CONFIG_MAX_ENDPOINTS + 1];
 
 void relay_cluster_callback_attr_write_trampoline(uint8_t endpoint,
                                                   uint16_t attribute_id) {
@@ -33,13 +39,20 @@ void relay_cluster_callback_attr_write_trampoline(uint8_t endpoint,
 }
 
 void update_relay_clusters() {
-  for (int i = 0; i < 10; i++) {
+  // LEDs only, the state reports after a join are spread by startup_traffic
+  for (int i = 0; i <= DEVICE_CONFIG_MAX_ENDPOINTS; i++) {
     if (relay_cluster_by_endpoint[i] != NULL) {
-      sync_indicator_led(relay_cluster_by_endpoint[i]);
+      apply_indicator_led(relay_cluster_by_endpoint[i]);
     }
   }
 }
 
+zigbee_relay_cluster *relay_cluster_get(uint8_t endpoint) {
+  if (endpoint > DEVICE_CONFIG_MAX_ENDPOINTS)
+    return NULL;
+  return relay_cluster_by_endpoint[endpoint];
+}
+
 void relay_cluster_add_to_endpoint(zigbee_relay_cluster *cluster,
                                    hal_zigbee_endpoint *endpoint) {
   relay_cluster_by_endpoint[endpoint->endpoint] = cluster;
@@ -77,6 +90,8 @@ hal_zigbee_cmd_result_t relay_cluster_callback_trampoline(uint8_t endpoint,
                                                           uint8_t cluster_id,
                                                           uint8_t command_id,
                                                           void *cmd_payload) {
+  diagnostics.zcl_cmds_received++;
+  poll_control_on_activity();
   return relay_cluster_callback(relay_cluster_by_endpoint[endpoint], command_id,
                                 cmd_payload);
 }
@@ -106,7 +121,7 @@ hal_zigbee_cmd_result_t relay_cluster_callback(zigbee_relay_cluster *cluster,
   return HAL_ZIGBEE_CMD_PROCESSED;
 }
 
-void sync_indicator_led(zigbee_relay_cluster *cluster) {
+static void apply_indicator_led(zigbee_relay_cluster *cluster) {
   if (cluster->indicator_led == NULL) {
     return;
   }
@@ -121,11 +136,28 @@ void sync_indicator_led(zigbee_relay_cluster *cluster) {
 
   cluster->indicator_state ? led_on(cluster->indicator_led)
                            : led_off(cluster->indicator_led);
+}
 
+void sync_indicator_led(zigbee_relay_cluster *cluster) {
+  if (cluster->indicator_led == NULL) {
+    return;
+  }
+
+  apply_indicator_led(cluster);
   hal_zigbee_notify_attribute_changed(cluster->endpoint, ZCL_CLUSTER_ON_OFF,
                                       ZCL_ATTR_ONOFF_INDICATOR_STATE);
 }
 
+void relay_cluster_report(zigbee_relay_cluster *cluster) {
+  hal_zigbee_report_attr attrs[2] = {
+      {ZCL_ATTR_ONOFF, ZCL_DATA_TYPE_BOOLEAN, 1, &cluster->relay->on},
+      {ZCL_ATTR_ONOFF_INDICATOR_STATE, ZCL_DATA_TYPE_BOOLEAN, 1,
+       &cluster->indicator_state},
+  };
+  hal_zigbee_send_report_attrs(cluster->endpoint, ZCL_CLUSTER_ON_OFF, attrs,
+                               cluster->indicator_led != NULL ? 2 : 1);
+}
+
 void relay_cluster_on(zigbee_relay_cluster *cluster) {
   relay_on(cluster->relay);
   sync_indicator_led(cluster);
@@ -180,13 +212,13 @@ void relay_cluster_store_attrs_to_nv(zigbee_relay_cluster *cluster) {
     nv_config_buffer.indicator_led_on = cluster->indicator_state;
   }
 
-  hal_nvm_write(NV_ITEM_RELAY_CLUSTER_DATA(cluster->relay_idx),
-                sizeof(zigbee_relay_cluster_config),
-                (uint8_t *)&nv_config_buffer);
+  nvm_cache_write(NV_ITEM_RELAY_CLUSTER_DATA(cluster->relay_idx),
+                  sizeof(zigbee_relay_cluster_config),
+                  (uint8_t *)&nv_config_buffer);
 }
 
 void relay_cluster_load_attrs_from_nv(zigbee_relay_cluster *cluster) {
-  hal_nvm_status_t st = hal_nvm_read(
+  hal_nvm_status_t st = nvm_cache_read(
       NV_ITEM_RELAY_CLUSTER_DATA(cluster->relay_idx),
       sizeof(zigbee_relay_cluster_config), (uint8_t *)&nv_config_buffer);
 
@@ -199,7 +231,7 @@ void relay_cluster_load_attrs_from_nv(zigbee_relay_cluster *cluster) {
 }
 
 void relay_cluster_handle_startup_mode(zigbee_relay_cluster *cluster) {
-  hal_nvm_status_t st = hal_nvm_read(
+  hal_nvm_status_t st = nvm_cache_read(
       NV_ITEM_RELAY_CLUSTER_DATA(cluster->relay_idx),
       sizeof(zigbee_relay_cluster_config), (uint8_t *)&nv_config_buffer);
 
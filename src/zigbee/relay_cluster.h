@@ -25,10 +25,15 @@ void relay_cluster_on(zigbee_relay_cluster *cluster);
 void relay_cluster_off(zigbee_relay_cluster *cluster);
 void relay_cluster_toggle(zigbee_relay_cluster *cluster);
 
+/** Sends the on/off and indicator state in one report frame */
 void relay_cluster_report(zigbee_relay_cluster *cluster);
 
+/** Restores the indicator LEDs, after the network indicator used them */
 void update_relay_clusters();
 
+/** @return Relay cluster of the endpoint, NULL if it has none */
+zigbee_relay_cluster *relay_cluster_get(uint8_t endpoint);
+
 void relay_cluster_callback_attr_write_trampoline(uint8_t endpoint,
                                                   uint16_t attribute_id);
 
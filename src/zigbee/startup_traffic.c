@@ -0,0 +1,110 @@
+#include "startup_traffic.h"
+
+#include "device_config/capacities.h"
+#include "device_random.h"
+#include "hal/tasks.h"
+#include "relay_cluster.h"
+
+static hal_task_t announce_task;
+static hal_task_t report_task;
+static bool initialized = false;
+static bool announce_sent = false; // Once per boot
+static bool announce_scheduled = false;
+
+// Report round state, endpoints are reported in ascending order
+static uint8_t next_endpoint = 0;
+static uint32_t slot_ms = 0;
+static uint32_t slot_offset_ms = 0; // Where in its slot the last report went
+
+static void announce_handler(void *arg) {
+  announce_scheduled = false;
+  if (hal_zigbee_get_network_status() != HAL_ZIGBEE_NETWORK_JOINED)
+    return;
+  hal_zigbee_send_announce();
+  announce_sent = true;
+}
+
+static zigbee_relay_cluster *find_relay_cluster(uint8_t from_endpoint) {
+  for (uint8_t ep = from_endpoint; ep <= DEVICE_CONFIG_MAX_ENDPOINTS; ep++) {
+    zigbee_relay_cluster *cluster = relay_cluster_get(ep);
+    if (cluster != NULL)
+      return cluster;
+  }
+  return NULL;
+}
+
+static void report_handler(void *arg) {
+  if (hal_zigbee_get_network_status() != HAL_ZIGBEE_NETWORK_JOINED)
+    return;
+  zigbee_relay_cluster *cluster = find_relay_cluster(next_endpoint);
+  if (cluster == NULL)
+    return;
+  relay_cluster_report(cluster);
+
+  next_endpoint = cluster->endpoint + 1;
+  if (find_relay_cluster(next_endpoint) == NULL)
+    return;
+  // Rest of this slot, then a random point of the next one
+  uint32_t offset = device_random_below(slot_ms);
+  hal_tasks_schedule(&report_task, slot_ms - slot_offset_ms + offset);
+  slot_offset_ms = offset;
+}
+
+static void start_report_round(void) {
+  uint8_t relays = 0;
+  for (uint8_t ep = 0; ep <= DEVICE_CONFIG_MAX_ENDPOINTS; ep++) {
+    if (relay_cluster_get(ep) != NULL)
+      relays++;
+  }
+  hal_tasks_unschedule(&report_task);
+  if (relays == 0)
+    return;
+
+  next_endpoint = 0;
+  slot_ms = STARTUP_REPORT_WINDOW_MS / relays;
+  slot_offset_ms = device_random_below(slot_ms);
+  hal_tasks_schedule(&report_task, slot_offset_ms);
+}
+
+static void on_joined(void) {
+  if (!announce_sent && !announce_scheduled) {
+    announce_scheduled = true;
+    hal_tasks_schedule(&announce_task,
+                       device_random_below(BOOT_ANNOUNCE_WINDOW_MS));
+  }
+  start_report_round();
+}
+
+void startup_traffic_init(void) {
+  announce_task.handler = announce_handler;
+  announce_task.arg = NULL;
+  hal_tasks_init(&announce_task);
+  report_task.handler = report_handler;
+  report_task.arg = NULL;
+  hal_tasks_init(&report_task);
+  initialized = true;
+
+  if (hal_zigbee_get_network_status() == HAL_ZIGBEE_NETWORK_JOINED)
+    on_joined();
+}
+
+void startup_traffic_on_network_status_change(
+    hal_zigbee_network_status_t new_status) {
+  // Stacks report the restored status while starting, app_init() schedules
+  // from the status it finds at its end
+  if (!initialized)
+    return;
+  if (new_status == HAL_ZIGBEE_NETWORK_JOINED)
+    on_joined();
+}
+
+#ifdef HAL_STUB
+void startup_traffic_reset_state(void) {
+  initialized = false;
+  announce_sent = false;
+  announce_scheduled = false;
+  next_endpoint = 0;
+  slot_ms = 0;
+  slot_offset_ms = 0;
+}
+#endif
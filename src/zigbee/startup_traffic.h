@@ -0,0 +1,40 @@
+#ifndef _STARTUP_TRAFFIC_H_
+#define _STARTUP_TRAFFIC_H_
+
+#include "hal/zigbee.h"
+
+// Spreads the traffic a device sends once it is on the network, so a whole
+// building coming back from a power cut does not hit the coordinator within
+// the same second.
+
+// The boot announce goes out at a random point of this window
+#ifndef BOOT_ANNOUNCE_WINDOW_MS
+#define BOOT_ANNOUNCE_WINDOW_MS 3000
+#endif
+
+// Relay state reports get one slot of this window each, and go out at a
+// random point of their slot
+#ifndef STARTUP_REPORT_WINDOW_MS
+#define STARTUP_REPORT_WINDOW_MS 10000
+#endif
+
+/**
+ * Starts shaping when already joined, called once at the end of app_init(),
+ * after device_random_init()
+ */
+void startup_traffic_init(void);
+
+/**
+ * Schedules the announce and state reports after a join, called on every
+ * network status change
+ * @param new_status Status reported by the stack
+ */
+void startup_traffic_on_network_status_change(
+    hal_zigbee_network_status_t new_status);
+
+#ifdef HAL_STUB
+// Host simulator only, see app_reset_state()
+void startup_traffic_reset_state(void);
+#endif
+
+#endif
@@ -1,14 +1,18 @@
 
 #include "switch_cluster.h"
+#include "base_components/diagnostics.h"
 #include "base_components/relay.h"
 #include "cluster_common.h"
 #include "consts.h"
+#include "device_config/capacities.h"
+#include "device_config/nvm_cache.h"
 #include "device_config/nvm_items.h"
-#include "hal/nvm.h"
 
 #include "hal/printf_selector.h"
 #include "hal/system.h"
 #include "hal/tasks.h"
+#include "hal/tlog.h"
+#include "poll_control.h"
 #include "relay_cluster.h"
 #include "zigbee_commands.h"
 
@@ -33,7 +37,17 @@ void switch_cluster_on_button_long_press(zigbee_switch_cluster *cluster);
 void switch_cluster_on_button_multi_press(zigbee_switch_cluster *cluster,
                                           uint8_t press_count);
 
-zigbee_switch_cluster *switch_cluster_by_endpoint[10];
+// Indexed by endpoint number
+zigbee_switch_cluster
+    *switch_cluster_by_endpoint[DEVICE_CONFIG_MAX_ENDPOINTS + 1];
+
+static void send_cmd_to_bindings(const hal_zigbee_cmd *cmd) {
+  if (hal_zigbee_send_cmd_to_bindings(cmd) == HAL_ZIGBEE_OK) {
+    diagnostics.zcl_cmds_sent++;
+  } else {
+    diagnostics.send_failures++;
+  }
+}
 
 void switch_cluster_store_attrs_to_nv(zigbee_switch_cluster *cluster);
 void switch_cluster_load_attrs_from_nv(zigbee_switch_cluster *cluster);
@@ -217,7 +231,7 @@ void switch_cluster_binding_action_on(zigbee_switch_cluster *cluster) {
   }
 
   hal_zigbee_cmd c = build_onoff_cmd(cluster->endpoint, cmd_id);
-  hal_zigbee_send_cmd_to_bindings(&c);
+  send_cmd_to_bindings(&c);
 }
 
 // Send OnOff command to binded device based on OFF position (position 2 in
@@ -258,7 +272,7 @@ void switch_cluster_binding_action_off(zigbee_switch_cluster *cluster) {
   }
 
   hal_zigbee_cmd c = build_onoff_cmd(cluster->endpoint, cmd_id);
-  hal_zigbee_send_cmd_to_bindings(&c);
+  send_cmd_to_bindings(&c);
 }
 
 void switch_cluster_level_stop(zigbee_switch_cluster *cluster) {
@@ -267,7 +281,7 @@ void switch_cluster_level_stop(zigbee_switch_cluster *cluster) {
   }
 
   hal_zigbee_cmd c = build_level_stop_onoff_cmd(cluster->endpoint);
-  hal_zigbee_send_cmd_to_bindings(&c);
+  send_cmd_to_bindings(&c);
 }
 
 void switch_cluster_level_control(zigbee_switch_cluster *cluster) {
@@ -278,7 +292,7 @@ void switch_cluster_level_control(zigbee_switch_cluster *cluster) {
   hal_zigbee_cmd c = build_level_move_onoff_cmd(cluster->endpoint,
                                                 cluster->level_move_direction,
                                                 cluster->level_move_rate);
-  hal_zigbee_send_cmd_to_bindings(&c);
+  send_cmd_to_bindings(&c);
 
   if (cluster->level_move_direction == ZCL_LEVEL_MOVE_DOWN) {
     cluster->level_move_direction = ZCL_LEVEL_MOVE_UP;
@@ -288,6 +302,7 @@ void switch_cluster_level_control(zigbee_switch_cluster *cluster) {
 }
 
 void switch_cluster_on_button_press(zigbee_switch_cluster *cluster) {
+  poll_control_on_activity();
 
   if (cluster->mode == ZCL_ONOFF_CONFIGURATION_SWITCH_TYPE_TOGGLE) {
     // Toggle does not support modes (RISE, SHORT, LONG)
@@ -317,6 +332,7 @@ void switch_cluster_on_button_press(zigbee_switch_cluster *cluster) {
 }
 
 void switch_cluster_on_button_release(zigbee_switch_cluster *cluster) {
+  poll_control_on_activity();
 
   if (cluster->mode == ZCL_ONOFF_CONFIGURATION_SWITCH_TYPE_TOGGLE) {
     // Toggle does not support modes (RISE, SHORT, LONG)
@@ -408,7 +424,7 @@ void synchronize_multistate_state(zigbee_switch_cluster *cluster) {
 
 void switch_cluster_on_write_attr(zigbee_switch_cluster *cluster,
                                   uint16_t attribute_id) {
-  printf("Index at write attr: %d\r\n", cluster->switch_idx);
+  TLOG("Index at write attr: %d\r\n", cluster->switch_idx);
   if (attribute_id == ZCL_ATTR_ONOFF_CONFIGURATION_SWITCH_RELAY_INDEX) {
     if (cluster->relay_index < 1 || cluster->relay_index > relay_clusters_cnt) {
       cluster->relay_index = 1;
@@ -437,13 +453,13 @@ void switch_cluster_store_attrs_to_nv(zigbee_switch_cluster *cluster) {
       cluster->button->long_press_duration_ms;
   nv_config_buffer.level_move_rate = cluster->level_move_rate;
   nv_config_buffer.binded_mode = cluster->binded_mode;
-  hal_nvm_write(NV_ITEM_SWITCH_CLUSTER_DATA(cluster->switch_idx),
-                sizeof(zigbee_switch_cluster_config),
-                (uint8_t *)&nv_config_buffer);
+  nvm_cache_write(NV_ITEM_SWITCH_CLUSTER_DATA(cluster->switch_idx),
+                  sizeof(zigbee_switch_cluster_config),
+                  (uint8_t *)&nv_config_buffer);
 }
 
 void switch_cluster_load_attrs_from_nv(zigbee_switch_cluster *cluster) {
-  hal_nvm_status_t st = hal_nvm_read(
+  hal_nvm_status_t st = nvm_cache_read(
       NV_ITEM_SWITCH_CLUSTER_DATA(cluster->switch_idx),
       sizeof(zigbee_switch_cluster_config), (uint8_t *)&nv_config_buffer);
 
@@ -1,5 +1,7 @@
+import os
 import queue
 import re
+import struct
 import subprocess
 import sys
 import threading
@@ -8,6 +10,12 @@ from typing import Callable
 
 _RES_RE = re.compile(r"^RES\s+(OK|ERR)\s*(.*)?$")
 _EVT_RE = re.compile(r"^EVT\s+(\w+)\s*(.*)$")
+_LOG_DUMPED_RE = re.compile(r"^\[LOG\] \d+ lines dumped$")
+
+# Binary framed protocol, see src/stub/machine_proto.h
+_FRAME_BATCH = 0x01
+_FRAME_RESULT = 0x81
+_FRAME_EVENT = 0x82
 
 
 @dataclass
@@ -29,25 +37,58 @@ class StubProc:
         joined: bool = True,
         freeze_time: bool = True,
         device_config: str | None = None,
+        nvm_dir: str | None = None,
+        protocol: str | None = None,
+        log_level: str | None = None,
+        log_ring: int | None = None,
     ) -> None:
         self.cmd = [*cmd]
         if device_config:
             self.cmd += ["--device-config", device_config]
+        if nvm_dir:
+            self.cmd += ["--nvm-dir", nvm_dir]
         if not joined:
             self.cmd += ["--not-joined"]
         if freeze_time:
             self.cmd += ["--freeze-time"]
+        # "text" lines or "binary" frames, STUB_PROTOCOL picks it for a test run
+        self.protocol = protocol or os.environ.get("STUB_PROTOCOL", "text")
+        # Logs are kept in a ring and only dumped for failures, STUB_LOG_RING=0
+        # streams them to stderr instead
+        self.log_ring = (
+            log_ring
+            if log_ring is not None
+            else int(os.environ.get("STUB_LOG_RING", "512"))
+        )
+        self.cmd += [
+            "--log-level",
+            log_level or os.environ.get("STUB_LOG_LEVEL", "debug"),
+            "--log-ring",
+            str(self.log_ring),
+        ]
         self.proc: subprocess.Popen | None = None
         self._res_q: queue.Queue[CmdResult] = queue.Queue()
         self._evt_q: queue.Queue[Event] = queue.Queue()
         self._reader_thread: threading.Thread | None = None
         self._stderr_forward_thread: threading.Thread | None = None
         self.on_event: list[Callable[[Event], None]] = []
+        self.forward_stderr = True  # Firmware logs to our stderr
+        self._binary = False
+        self._binary_pending = False
+        self._seq = 0
+        self._last_seq: int | None = None  # Batch of the last send(), if any
+        self._batches: dict[int, tuple[int, list[CmdResult]]] = {}
+        self._batches_cond = threading.Condition()
+        self._exited = False
+        self._log_dump: list[str] | None = None
+        self._log_dumped = threading.Event()
 
     def __enter__(self) -> "StubProc":
         return self.start()
 
     def __exit__(self, exc_type, exc_value, traceback) -> None:
+        if exc_type is not None and self.is_running():
+            print(self.dump_log(), file=sys.stderr)
         self.stop()
 
     def start(self) -> "StubProc":
@@ -56,8 +97,6 @@ class StubProc:
             stdin=subprocess.PIPE,
             stdout=subprocess.PIPE,
             stderr=subprocess.PIPE,
-            text=True,
-            bufsize=1,
         )
         self._reader_thread = threading.Thread(target=self._read_loop, daemon=True)
         self._reader_thread.start()
@@ -67,6 +106,10 @@ class StubProc:
         self._stderr_forward_thread.start()
         # enter machine mode; ignore output but ensure we’re synced
         self.exec("machine on", timeout=2.0)
+        if self.protocol == "binary":
+            self._binary_pending = True
+            res = self.exec("machine bin", timeout=2.0)
+            assert res.ok, f"Binary protocol unavailable: {res.payload}"
         return self
 
     def stop(self, kill_after: float = 0.02) -> None:
@@ -83,6 +126,31 @@ class StubProc:
             self.proc.wait()
         self.proc = None
 
+    def reset(
+        self,
+        device_config: str | None = None,
+        joined: bool = True,
+        freeze_time: bool = True,
+        keep_nvm: bool = False,
+    ) -> None:
+        """Restarts the device in place, as if the process had just started.
+
+        NVM is wiped unless keep_nvm. Event callbacks of the previous user are
+        dropped.
+        """
+        args = ["reset"]
+        if device_config:
+            args += ["--config", device_config]
+        if not joined:
+            args += ["--not-joined"]
+        if freeze_time:
+            args += ["--freeze-time"]
+        if keep_nvm:
+            args += ["--keep-nvm"]
+        self.on_event.clear()
+        res = self.exec(" ".join(args), timeout=2.0)
+        assert res.ok, f"Reset failed: {res.payload}"
+
     def is_running(self) -> bool:
         return self.proc is not None and self.proc.poll() is None
 
@@ -95,17 +163,34 @@ class StubProc:
         except subprocess.TimeoutExpired:
             return False
 
+    def dump_log(self, timeout: float = 1.0) -> str:
+        """Returns the captured log lines of the stub and empties its ring."""
+        if self.log_ring == 0:
+            return ""
+        self._log_dumped.clear()
+        self._log_dump = []
+        self.exec("log dump")
+        self._log_dumped.wait(timeout)
+        lines, self._log_dump = self._log_dump, None
+        return "\n".join(lines)
+
     def _stderr_forward(self):
         assert self.proc and self.proc.stderr
 
-        for line in self.proc.stderr:
-            print(line.rstrip(), file=sys.stderr)
+        for raw in self.proc.stderr:
+            line = raw.decode(errors="replace").rstrip()
+            if self._log_dump is not None:
+                self._log_dump.append(line)
+                if _LOG_DUMPED_RE.match(line):
+                    self._log_dumped.set()
+            elif self.forward_stderr:
+                print(line, file=sys.stderr)
 
     def _read_loop(self) -> None:
         assert self.proc and self.proc.stdout and self.proc.stderr
 
         for raw in self.proc.stdout:
-            line = raw.rstrip("\n")
+            line = raw.decode(errors="replace").rstrip("\n")
             print(line.rstrip(), file=sys.stdout)
             if "RES" in line:
                 print("!")  # mark RES lines in output
@@ -113,11 +198,17 @@ class StubProc:
             if m:
                 ok = m.group(1) == "OK"
                 payload = m.group(2)
+                if self._binary_pending:
+                    # The stub sends frames right after acknowledging
+                    self._binary = True
                 self._res_q.put(
                     CmdResult(
                         ok=ok, payload=self._parse_kw_from_firmware(payload or "")
                     )
                 )
+                if self._binary:
+                    self._read_frames()
+                    return
                 continue
             m = _EVT_RE.match(line)
             if m:
@@ -129,6 +220,50 @@ class StubProc:
                     cb(event)
                 continue
             # Ignore unknown lines
+        # The device exited (e.g. rebooted) before answering the pending command
+        self._res_q.put(CmdResult(ok=False, payload={"exited": ""}))
+
+    def _read_frames(self) -> None:
+        assert self.proc and self.proc.stdout
+
+        while True:
+            header = self.proc.stdout.read(5)
+            if len(header) < 5:
+                break
+            length, kind, seq = struct.unpack("<HBH", header)
+            body = self.proc.stdout.read(length - 3)
+            if len(body) < length - 3:
+                break
+            if kind == _FRAME_EVENT:
+                text = body.decode(errors="replace")
+                print(f"EVT {text}", file=sys.stdout)
+                name, _, rest = text.partition(" ")
+                event = Event(kind=name, payload=self._parse_kw_from_firmware(rest))
+                for cb in self.on_event:
+                    cb(event)
+            elif kind == _FRAME_RESULT:
+                self._add_results(seq, body)
+
+        with self._batches_cond:
+            self._exited = True
+            self._batches_cond.notify_all()
+
+    def _add_results(self, seq: int, body: bytes) -> None:
+        results = []
+        offset = 0
+        while offset < len(body):
+            ok, length = struct.unpack_from("<BH", body, offset)
+            offset += 3
+            text = body[offset : offset + length].decode(errors="replace")
+            offset += length
+            print(f"RES {'OK' if ok else 'ERR'} {text}\n!", file=sys.stdout)
+            results.append(
+                CmdResult(ok=bool(ok), payload=self._parse_kw_from_firmware(text))
+            )
+        with self._batches_cond:
+            if seq in self._batches:
+                self._batches[seq][1].extend(results)
+                self._batches_cond.notify_all()
 
     def _parse_kw_from_firmware(self, data: str) -> dict[str, str]:
         result = {}
@@ -142,16 +277,80 @@ class StubProc:
         return result
 
     def exec(self, cmd: str, timeout: float = 1.0) -> CmdResult:
+        self.send(cmd)
+        return self.wait_result(cmd, timeout=timeout)
+
+    def send(self, cmd: str) -> None:
+        """Sends a command without waiting, pair with wait_result()."""
         if not self.proc or not self.proc.stdin:
             raise RuntimeError("Process not running")
+        if self._binary:
+            self._last_seq = self.send_batch([cmd])
+            return
+        self._last_seq = None
         while not self._res_q.empty():
             try:
                 self._res_q.get_nowait()
             except queue.Empty:
                 break
-        self.proc.stdin.write(cmd + "\n")
+        self.proc.stdin.write(cmd.encode() + b"\n")
         self.proc.stdin.flush()
+
+    def wait_result(self, cmd: str, timeout: float = 1.0) -> CmdResult:
+        if self._last_seq is not None:
+            return self.wait_batch(self._last_seq, timeout=timeout)[0]
         try:
             return self._res_q.get(timeout=timeout)
         except queue.Empty:
             raise TimeoutError(f"Timeout waiting for response to: {cmd}")
+
+    # --- Batches, one round trip with the binary protocol ---
+
+    def exec_batch(self, cmds: list[str], timeout: float = 1.0) -> list[CmdResult]:
+        if not self._binary:
+            return [self.exec(cmd, timeout=timeout) for cmd in cmds]
+        return self.wait_batch(self.send_batch(cmds), timeout=timeout)
+
+    def send_batch(self, cmds: list[str]) -> int:
+        """Sends commands as one frame, returns its sequence number.
+
+        Several batches may be in flight, collect them with wait_batch().
+        """
+        assert self._binary, "Batches need the binary protocol"
+        if not self.proc or not self.proc.stdin:
+            raise RuntimeError("Process not running")
+        self._seq = self._seq % 0xFFFF + 1  # 0 marks unsolicited events
+        payload = b""
+        for cmd in cmds:
+            data = cmd.encode()
+            assert len(data) < 256, f"Command too long: {cmd}"
+            payload += bytes([len(data)]) + data
+        with self._batches_cond:
+            self._batches[self._seq] = (len(cmds), [])
+        self.proc.stdin.write(
+            struct.pack("<HBH", len(payload) + 3, _FRAME_BATCH, self._seq) + payload
+        )
+        self.proc.stdin.flush()
+        return self._seq
+
+    def wait_batch(self, seq: int, timeout: float = 1.0) -> list[CmdResult]:
+        with self._batches_cond:
+            count, results = self._batches[seq]
+            done = self._batches_cond.wait_for(
+                lambda: len(results) >= count or self._exited, timeout=timeout
+            )
+            del self._batches[seq]
+        if not done:
+            raise TimeoutError(f"Timeout waiting for batch {seq}")
+        # The device exited (e.g. rebooted) before answering every command
+        missing = count - len(results)
+        return results + [CmdResult(ok=False, payload={"exited": ""})] * missing
+
+    def subscribe(self, kinds: list[str] | None = None) -> None:
+        """Limits events to the given kinds, all events for None."""
+        if kinds is None:
+            arg = "all"
+        else:
+            arg = " ".join(kinds) if kinds else "none"
+        res = self.exec(f"subscribe {arg}")
+        assert res.ok, f"Subscribe failed: {res.payload}"
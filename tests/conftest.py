@@ -108,11 +108,82 @@ def relay_button_pair(relay_button_pairs: list[RelayButtonPair]) -> RelayButtonP
     return relay_button_pairs[0]
 
 
+class StubPool:
+    """Hands out one stub process per test worker, reset in place between tests.
+
+    A process that exited (e.g. rebooted) is replaced by a fresh one. Set
+    STUB_REUSE=0 to start a new process for every test instead.
+    """
+
+    def __init__(self, nvm_dir: str) -> None:
+        self.nvm_dir = nvm_dir
+        self.reuse = os.environ.get("STUB_REUSE", "1") != "0"
+        self._proc: StubProc | None = None
+
+    def get(
+        self,
+        device_config: str | None = None,
+        joined: bool = True,
+        freeze_time: bool = True,
+    ) -> StubProc:
+        if self._proc is not None and self._proc.is_running():
+            self._proc.forward_stderr = True
+            self._proc.exec("log clear")
+            self._proc.reset(device_config, joined=joined, freeze_time=freeze_time)
+            return self._proc
+        # Nothing may survive from a process that went away
+        shutil.rmtree(self.nvm_dir, ignore_errors=True)
+        self._proc = StubProc(
+            device_config=device_config,
+            joined=joined,
+            freeze_time=freeze_time,
+            nvm_dir=self.nvm_dir,
+        ).start()
+        return self._proc
+
+    def release(self) -> None:
+        if self._proc is None:
+            return
+        if self.reuse:
+            # Late logs belong to a finished test, keep them out of the report
+            self._proc.forward_stderr = False
+            self._proc.on_event.clear()
+        else:
+            self.close()
+
+    def dump_log(self) -> str:
+        if self._proc is None or not self._proc.is_running():
+            return ""
+        return self._proc.dump_log()
+
+    def close(self) -> None:
+        if self._proc is not None:
+            self._proc.stop()
+            self._proc = None
+
+
+@pytest.hookimpl(hookwrapper=True)
+def pytest_runtest_makereport(item: pytest.Item, call: pytest.CallInfo):
+    report = (yield).get_result()
+    # Captured stub logs only show up for a failing test
+    pool = getattr(item, "funcargs", {}).get("stub_pool")
+    if report.when == "call" and report.failed and pool is not None:
+        log = pool.dump_log()
+        if log:
+            report.sections.append(("Captured stub log", log))
+
+
+@pytest.fixture(scope="session")
+def stub_pool(tmp_path_factory: pytest.TempPathFactory) -> Iterator[StubPool]:
+    pool = StubPool(str(tmp_path_factory.mktemp("stub_nvm")))
+    yield pool
+    pool.close()
+
+
 @pytest.fixture()
-def stub_proc(device_config: str) -> Iterator[StubProc]:
-    proc = StubProc(device_config=device_config).start()
-    yield proc
-    proc.stop()
+def stub_proc(stub_pool: StubPool, device_config: str) -> Iterator[StubProc]:
+    yield stub_pool.get(device_config)
+    stub_pool.release()
 
 
 @dataclass
@@ -206,7 +277,8 @@ class Device:
 
     def step_time(self, ms: int) -> None:
         res = self.p.exec(f"step_time {ms}")
-        assert res.ok, f"Step time failed: {res.payload}"
+        # Tasks run while time advances, a scheduled reboot ends the process
+        assert res.ok or "exited" in res.payload, f"Step time failed: {res.payload}"
 
     def _evt_parser(self, evt: Event) -> None:
         if evt.kind == "gpio":
@@ -0,0 +1,409 @@
+"""Simulated Zigbee network of several stub devices.
+
+Every node is a separate stub process with frozen time and its own NVM
+directory. The medium keeps all nodes on the same virtual clock and moves
+frames between them:
+
+- commands sent to bindings are routed to the bound node endpoints, or to
+  every member of a group for group bindings,
+- attribute changes are reported to the coordinator.
+
+Each frame takes `hop_latency_ms` per hop and is dropped by each hop with
+probability `loss`. Nodes are advanced in windows no longer than one hop, so
+a frame sent inside a window is never due before the window ends.
+
+Run `python3 -m tests.mesh` for the multi-switch benchmarks.
+"""
+
+import contextlib
+import heapq
+import os
+import random
+import tempfile
+from collections import deque
+from dataclasses import dataclass, field
+
+from tests.client import Event, StubProc
+from tests.zcl_consts import ZCL_CLUSTER_ON_OFF
+
+COORDINATOR = "coordinator"
+DEBOUNCE_MS = 50
+
+
+@dataclass(order=True)
+class Frame:
+    due_at: int
+    seq: int
+    kind: str = field(compare=False)  # "cmd" or "report"
+    src: str = field(compare=False)
+    dst: str = field(compare=False)
+    ep: int = field(compare=False)  # Target for commands, source for reports
+    cluster: int = field(compare=False)
+    cmd_or_attr: int = field(compare=False)
+    data: bytes = field(compare=False)
+    sent_at: int = field(compare=False)
+
+
+@dataclass
+class MeshStats:
+    sent: int = 0  # Messages emitted by devices
+    frames: int = 0  # Radio transmissions, one per hop and relaying router
+    delivered: int = 0
+    lost: int = 0
+
+
+@dataclass
+class Report:
+    src: str
+    ep: int
+    cluster: int
+    attr: int
+    sent_at: int
+    received_at: int
+
+
+class MeshNode:
+    def __init__(self, name: str, proc: StubProc) -> None:
+        self.name = name
+        self.proc = proc
+        self.events: list[Event] = []
+        # Filled by the reader thread, popleft() keeps the handover lock free
+        self._pending: deque[Event] = deque()
+        proc.on_event.append(self._pending.append)
+
+    def take_pending(self) -> list[Event]:
+        pending = []
+        while self._pending:
+            pending.append(self._pending.popleft())
+        self.events += pending
+        return pending
+
+    def exec(self, cmd: str) -> None:
+        res = self.proc.exec(cmd)
+        assert res.ok, f"{self.name}: {cmd} failed: {res.payload}"
+
+    def gpio_changes(self, pin: int, since: int = 0) -> list[tuple[int, int]]:
+        """Returns (time, value) of every output change of the pin."""
+        return [
+            (event_time(e), int(e.payload["value"]))
+            for e in self.events
+            if e.kind == "gpio"
+            and int(e.payload["pin"]) == pin
+            and event_time(e) >= since
+        ]
+
+
+def event_time(event: Event) -> int:
+    return int(event.payload["t"])
+
+
+class Mesh:
+    def __init__(
+        self,
+        hop_latency_ms: int = 10,
+        loss: float = 0.0,
+        seed: int = 0,
+        workdir: str | None = None,
+    ) -> None:
+        self.hop_latency_ms = hop_latency_ms
+        self.loss = loss
+        self.now = 0
+        self.stats = MeshStats()
+        self.reports: list[Report] = []
+        self.nodes: dict[str, MeshNode] = {}
+        self._rng = random.Random(seed)
+        self._hops: dict[frozenset[str], int] = {}
+        self._bindings: dict[tuple[str, int, int], list[tuple[str, int]]] = {}
+        self._group_bindings: dict[tuple[str, int, int], list[int]] = {}
+        self._groups: dict[int, list[tuple[str, int]]] = {}
+        self._queue: list[Frame] = []
+        self._inputs: dict[tuple[str, int], int] = {}
+        self._seq = 0
+        self._tmpdir = None
+        if workdir is None:
+            self._tmpdir = tempfile.TemporaryDirectory(prefix="mesh_")
+            workdir = self._tmpdir.name
+        self.workdir = workdir
+
+    def __enter__(self) -> "Mesh":
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback) -> None:
+        self.close()
+
+    def close(self) -> None:
+        for node in self.nodes.values():
+            node.proc.stop()
+        self.nodes.clear()
+        if self._tmpdir is not None:
+            self._tmpdir.cleanup()
+            self._tmpdir = None
+
+    # --- Topology ---
+
+    def add_node(self, name: str, device_config: str) -> MeshNode:
+        assert name not in self.nodes and name != COORDINATOR
+        nvm_dir = os.path.join(self.workdir, name)
+        proc = StubProc(
+            device_config=device_config, nvm_dir=nvm_dir, protocol="binary"
+        ).start()
+        proc.subscribe(["gpio", "zcl_cmd_send", "zcl_attr_change"])
+        node = MeshNode(name, proc)
+        self.nodes[name] = node
+        if self.now:
+            node.exec(f"step_time {self.now}")
+        node.take_pending()
+        return node
+
+    def set_hops(self, a: str, b: str, hops: int) -> None:
+        """Sets the route length between two nodes, 1 (neighbours) by default."""
+        assert hops >= 1
+        self._hops[frozenset((a, b))] = hops
+
+    def hops(self, a: str, b: str) -> int:
+        return self._hops.get(frozenset((a, b)), 1)
+
+    def bind(self, src: str, src_ep: int, cluster: int, dst: str, dst_ep: int):
+        self._bindings.setdefault((src, src_ep, cluster), []).append((dst, dst_ep))
+
+    def bind_group(self, src: str, src_ep: int, cluster: int, group: int):
+        self._group_bindings.setdefault((src, src_ep, cluster), []).append(group)
+
+    def add_to_group(self, group: int, node: str, ep: int) -> None:
+        self._groups.setdefault(group, []).append((node, ep))
+
+    # --- Stimulus ---
+
+    def set_pin(self, node: str, pin: int, value: int) -> int:
+        """Drives an input of a node, returns the virtual time it happened."""
+        self.nodes[node].exec(f"set_pin {pin} {value}")
+        self._inputs[(node, pin)] = value
+        self._collect(self.nodes[node])
+        return self.now
+
+    def flip(self, node: str, pin: int) -> int:
+        """Flips a toggle switch and runs the network until it settles."""
+        # Inputs idle high, pulled up
+        value = self._inputs.get((node, pin), 1) ^ 1
+        at = self.set_pin(node, pin, value)
+        self.advance(DEBOUNCE_MS)
+        self.settle()
+        return at
+
+    def send_from_coordinator(
+        self, dst: str, ep: int, cluster: int, cmd: int, data: bytes = b""
+    ) -> int:
+        """Sends a ZCL command over the medium, returns the time it was sent."""
+        self.stats.sent += 1
+        self._transmit("cmd", COORDINATOR, dst, ep, cluster, cmd, data, self.now)
+        return self.now
+
+    # --- Time ---
+
+    def advance(self, ms: int) -> None:
+        target = self.now + ms
+        window = max(1, self.hop_latency_ms)
+        while self.now < target:
+            until = min(target, self.now + window)
+            if self._queue and self.now < self._queue[0].due_at < until:
+                until = self._queue[0].due_at
+            self._step_all(until - self.now)
+            self.now = until
+            self._deliver_due()
+
+    def settle(self, max_ms: int = 10_000) -> None:
+        """Advances time until no frame is in flight."""
+        deadline = self.now + max_ms
+        while self._queue and self.now < deadline:
+            self.advance(max(1, self._queue[0].due_at - self.now))
+        assert not self._queue, "Network did not settle"
+
+    def _step_all(self, ms: int) -> None:
+        cmd = f"step_time {ms}"
+        # All stubs advance in parallel, the window bounds what they can emit
+        for node in self.nodes.values():
+            node.proc.send(cmd)
+        for node in self.nodes.values():
+            res = node.proc.wait_result(cmd, timeout=5.0)
+            assert res.ok, f"{node.name}: {cmd} failed: {res.payload}"
+        for node in self.nodes.values():
+            self._collect(node)
+
+    # --- Medium ---
+
+    def _collect(self, node: MeshNode) -> None:
+        for event in node.take_pending():
+            sent_at = event_time(event)
+            if event.kind == "zcl_cmd_send":
+                self._route_cmd(node.name, event, sent_at)
+            elif event.kind == "zcl_attr_change":
+                self.stats.sent += 1
+                self._transmit(
+                    "report",
+                    node.name,
+                    COORDINATOR,
+                    int(event.payload["ep"]),
+                    int(event.payload["cluster"], 16),
+                    int(event.payload["attr"], 16),
+                    b"",
+                    sent_at,
+                )
+
+    def _route_cmd(self, src: str, event: Event, sent_at: int) -> None:
+        ep = int(event.payload["ep"])
+        cluster = int(event.payload["cluster"], 16)
+        cmd = int(event.payload["cmd"], 16)
+        data = bytes.fromhex(event.payload.get("data_hex", ""))
+        key = (src, ep, cluster)
+        for dst, dst_ep in self._bindings.get(key, []):
+            self.stats.sent += 1
+            self._transmit("cmd", src, dst, dst_ep, cluster, cmd, data, sent_at)
+        for group in self._group_bindings.get(key, []):
+            self.stats.sent += 1
+            # A group cast is a broadcast, every router relays it once
+            self.stats.frames += len(self.nodes)
+            for dst, dst_ep in self._groups.get(group, []):
+                self._transmit(
+                    "cmd", src, dst, dst_ep, cluster, cmd, data, sent_at, False
+                )
+
+    def _transmit(
+        self,
+        kind: str,
+        src: str,
+        dst: str,
+        ep: int,
+        cluster: int,
+        cmd_or_attr: int,
+        data: bytes,
+        sent_at: int,
+        count_frames: bool = True,
+    ) -> None:
+        hops = self.hops(src, dst)
+        for _ in range(hops):
+            if count_frames:
+                self.stats.frames += 1
+            if self._rng.random() < self.loss:
+                self.stats.lost += 1
+                return
+        self._seq += 1
+        heapq.heappush(
+            self._queue,
+            Frame(
+                due_at=max(sent_at + hops * self.hop_latency_ms, self.now),
+                seq=self._seq,
+                kind=kind,
+                src=src,
+                dst=dst,
+                ep=ep,
+                cluster=cluster,
+                cmd_or_attr=cmd_or_attr,
+                data=data,
+                sent_at=sent_at,
+            ),
+        )
+
+    def _deliver_due(self) -> None:
+        while self._queue and self._queue[0].due_at <= self.now:
+            frame = heapq.heappop(self._queue)
+            self.stats.delivered += 1
+            if frame.kind == "report":
+                self.reports.append(
+                    Report(
+                        src=frame.src,
+                        ep=frame.ep,
+                        cluster=frame.cluster,
+                        attr=frame.cmd_or_attr,
+                        sent_at=frame.sent_at,
+                        received_at=self.now,
+                    )
+                )
+                continue
+            node = self.nodes[frame.dst]
+            payload = " ".join(f"{b:02X}" for b in frame.data)
+            node.exec(
+                f"zcl_cmd {frame.ep} 0x{frame.cluster:04X} "
+                f"0x{frame.cmd_or_attr:02X} {payload}".rstrip()
+            )
+            self._collect(node)
+
+
+# --- Benchmarks ---
+
+SWITCH_CONFIG = "Mesh;Switch;SA0u;"
+LAMP_CONFIG = "Mesh;Lamp;SA0u;RB0;"
+RELAY_CONFIG = "Mesh;Relay;RB0;"
+SWITCH_PIN = 0  # A0
+RELAY_PIN = 16  # B0
+
+
+@dataclass
+class BenchResult:
+    name: str
+    latencies_ms: list[int]
+    stats: MeshStats
+    reports: int
+
+
+def bench_staircase(hop_latency_ms: int = 10, hops: int = 2) -> BenchResult:
+    """One lamp switched from three places: its own switch and two remotes."""
+    with Mesh(hop_latency_ms=hop_latency_ms) as mesh:
+        mesh.add_node("lamp", LAMP_CONFIG)
+        for remote in ("upstairs", "downstairs"):
+            mesh.add_node(remote, SWITCH_CONFIG)
+            mesh.set_hops(remote, "lamp", hops)
+            mesh.bind(remote, 1, ZCL_CLUSTER_ON_OFF, "lamp", 2)
+        mesh.settle()
+        mesh.stats = MeshStats()
+        mesh.reports.clear()
+
+        latencies = []
+        for place in ("lamp", "upstairs", "downstairs"):
+            at = mesh.flip(place, SWITCH_PIN)
+            changes = mesh.nodes["lamp"].gpio_changes(RELAY_PIN, since=at)
+            latencies.append(changes[0][0] - at)
+        return BenchResult("staircase", latencies, mesh.stats, len(mesh.reports))
+
+
+def bench_group(relays: int = 20, hop_latency_ms: int = 10) -> BenchResult:
+    """One switch driving a group of relays with a single group cast."""
+    with Mesh(hop_latency_ms=hop_latency_ms) as mesh:
+        mesh.add_node("switch", SWITCH_CONFIG)
+        mesh.bind_group("switch", 1, ZCL_CLUSTER_ON_OFF, 0x0001)
+        for i in range(relays):
+            name = f"relay{i}"
+            mesh.add_node(name, RELAY_CONFIG)
+            mesh.set_hops("switch", name, 1 + i % 3)
+            mesh.add_to_group(0x0001, name, 1)
+        mesh.settle()
+        mesh.stats = MeshStats()
+        mesh.reports.clear()
+
+        at = mesh.flip("switch", SWITCH_PIN)
+        latencies = [
+            changes[0][0] - at
+            for node in mesh.nodes.values()
+            if (changes := node.gpio_changes(RELAY_PIN, since=at))
+        ]
+        return BenchResult("group", latencies, mesh.stats, len(mesh.reports))
+
+
+def main() -> None:
+    # Keep the stub output out of the benchmark summary
+    with open(os.devnull, "w") as devnull:
+        with contextlib.redirect_stdout(devnull), contextlib.redirect_stderr(
+            devnull
+        ):
+            results = [bench_staircase(), bench_group()]
+    for result in results:
+        print(
+            f"{result.name}: latency min/max "
+            f"{min(result.latencies_ms)}/{max(result.latencies_ms)} ms, "
+            f"sent={result.stats.sent} frames={result.stats.frames} "
+            f"delivered={result.stats.delivered} lost={result.stats.lost} "
+            f"reports={result.reports}"
+        )
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,231 @@
+"""ctypes binding of build/stub/libswitchcore.so (src/stub/switchcore.h).
+
+Drives the firmware core in this process, without the stub REPL, pipes or
+text responses. There is one device per process.
+
+A quick throughput check of the library against the stub process:
+
+    python3 -m tests.switchcore
+"""
+
+import ctypes
+import os
+import sys
+import time
+
+from tests.client import Event, StubProc
+
+LIB_PATH = "./build/stub/libswitchcore.so"
+
+_EVENT_CB = ctypes.CFUNCTYPE(
+    None, ctypes.c_char_p, ctypes.c_char_p, ctypes.c_uint32, ctypes.c_void_p
+)
+
+
+def _parse_args(args: str) -> dict[str, str]:
+    result = {}
+    for token in args.split():
+        key, _, value = token.partition("=")
+        result[key] = value
+    return result
+
+
+class SwitchCore:
+    def __init__(self, path: str = LIB_PATH) -> None:
+        self.lib = ctypes.CDLL(path)
+        self._declare()
+        self.events: list[Event] = []
+        # Kept referenced, the library holds the pointer
+        self._cb = _EVENT_CB(self._on_event)
+        self.lib.switchcore_set_event_callback(self._cb, None)
+
+    def _declare(self) -> None:
+        lib = self.lib
+        u8, u16, u32 = ctypes.c_uint8, ctypes.c_uint16, ctypes.c_uint32
+        lib.switchcore_create.argtypes = [
+            ctypes.c_char_p,
+            ctypes.c_char_p,
+            ctypes.c_bool,
+        ]
+        lib.switchcore_reset.argtypes = [ctypes.c_char_p, ctypes.c_bool, ctypes.c_bool]
+        lib.switchcore_set_event_callback.argtypes = [_EVENT_CB, ctypes.c_void_p]
+        lib.switchcore_set_gpio.argtypes = [u8, u8]
+        lib.switchcore_get_gpio.argtypes = [u8]
+        lib.switchcore_zcl_cmd.argtypes = [
+            u8,
+            u16,
+            u8,
+            ctypes.c_char_p,
+            ctypes.c_size_t,
+        ]
+        lib.switchcore_set_network.argtypes = [u8]
+        lib.switchcore_set_ieee_address.argtypes = [ctypes.c_uint64]
+        lib.switchcore_set_coordinator_channel.argtypes = [u8]
+        lib.switchcore_set_send_fail.argtypes = [ctypes.c_bool]
+        lib.switchcore_ota_serve.argtypes = [ctypes.c_char_p, ctypes.c_size_t]
+        lib.switchcore_ota_set_running_image.argtypes = [
+            ctypes.c_char_p,
+            ctypes.c_size_t,
+        ]
+        lib.switchcore_ota_read_slot.argtypes = [
+            u32,
+            ctypes.c_char_p,
+            ctypes.c_size_t,
+        ]
+        lib.switchcore_write_attr.argtypes = [u8, u16, u16, ctypes.c_char_p]
+        lib.switchcore_read_attr.argtypes = [
+            u8,
+            u16,
+            u16,
+            ctypes.c_char_p,
+            ctypes.c_size_t,
+        ]
+        lib.switchcore_advance.argtypes = [u32]
+        lib.switchcore_advance.restype = u32
+        lib.switchcore_millis.restype = u32
+        lib.switchcore_set_log_level.argtypes = [ctypes.c_char_p, ctypes.c_char_p]
+
+    def _on_event(self, kind: bytes, args: bytes, t_ms: int, _user) -> None:
+        payload = _parse_args(args.decode())
+        payload["t"] = str(t_ms)
+        self.events.append(Event(kind=kind.decode(), payload=payload))
+
+    def __enter__(self) -> "SwitchCore":
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback) -> None:
+        self.destroy()
+
+    # --- Lifecycle ---
+
+    def create(
+        self,
+        device_config: str | None = None,
+        nvm_dir: str | None = None,
+        joined: bool = True,
+    ) -> "SwitchCore":
+        res = self.lib.switchcore_create(
+            device_config.encode() if device_config else None,
+            nvm_dir.encode() if nvm_dir else None,
+            joined,
+        )
+        assert res == 0, "Device already created in this process"
+        return self
+
+    def reset(
+        self,
+        device_config: str | None = None,
+        joined: bool = True,
+        keep_nvm: bool = False,
+    ) -> None:
+        self.events.clear()
+        res = self.lib.switchcore_reset(
+            device_config.encode() if device_config else None, joined, keep_nvm
+        )
+        assert res == 0, "No device"
+
+    def destroy(self) -> None:
+        self.lib.switchcore_destroy()
+
+    # --- Inputs ---
+
+    def set_gpio(self, pin: int, value: int) -> None:
+        assert self.lib.switchcore_set_gpio(pin, value) == 0
+
+    def zcl_cmd(self, ep: int, cluster: int, cmd: int, payload: bytes = b"") -> int:
+        return self.lib.switchcore_zcl_cmd(ep, cluster, cmd, payload, len(payload))
+
+    def set_network(self, status: int) -> None:
+        assert self.lib.switchcore_set_network(status) == 0
+
+    def set_ieee_address(self, addr: int) -> None:
+        """Applies from the next create() or reset()."""
+        self.lib.switchcore_set_ieee_address(addr)
+
+    def set_coordinator_channel(self, channel: int) -> None:
+        """Channel of the simulated coordinator, 0 turns it off."""
+        self.lib.switchcore_set_coordinator_channel(channel)
+
+    def set_send_fail(self, fail: bool) -> None:
+        """Makes sends to bindings fail, as with a full APS queue."""
+        self.lib.switchcore_set_send_fail(fail)
+
+    def ota_serve(self, file: bytes | None) -> None:
+        """Offers an OTA file from the simulated server, None withdraws it."""
+        res = self.lib.switchcore_ota_serve(file, len(file) if file else 0)
+        assert res == 0, "Not an OTA file with an upgrade image"
+
+    def ota_set_running_image(self, image: bytes | None) -> None:
+        """Sets the firmware delta OTA images are made against."""
+        res = self.lib.switchcore_ota_set_running_image(
+            image, len(image) if image else 0
+        )
+        assert res == 0, "Running image larger than the slot"
+
+    def write_attr(self, ep: int, cluster: int, attr: int, value: int | str) -> None:
+        res = self.lib.switchcore_write_attr(ep, cluster, attr, str(value).encode())
+        assert res == 0, f"Write failed: ep={ep} 0x{cluster:04X}/0x{attr:04X}"
+
+    def advance(self, ms: int) -> int:
+        """Advances virtual time, returns the number of reboots on the way."""
+        return self.lib.switchcore_advance(ms)
+
+    # --- Outputs ---
+
+    def get_gpio(self, pin: int) -> int:
+        return self.lib.switchcore_get_gpio(pin)
+
+    def read_attr(self, ep: int, cluster: int, attr: int) -> str:
+        buf = ctypes.create_string_buffer(256)
+        res = self.lib.switchcore_read_attr(ep, cluster, attr, buf, len(buf))
+        assert res == 0, f"Attribute not found: ep={ep} 0x{cluster:04X}/0x{attr:04X}"
+        return buf.value.decode()
+
+    def read_ota_slot(self, offset: int, size: int) -> bytes:
+        buf = ctypes.create_string_buffer(size)
+        assert self.lib.switchcore_ota_read_slot(offset, buf, size) == 0
+        return buf.raw
+
+    def millis(self) -> int:
+        return self.lib.switchcore_millis()
+
+    def set_log_level(self, level: str, category: str | None = None) -> None:
+        res = self.lib.switchcore_set_log_level(
+            category.encode() if category else None, level.encode()
+        )
+        assert res == 0, f"Bad log level: {level}"
+
+
+def main() -> None:
+    config = "Bench;Switch;SA0u;RB0;"
+    clicks = 2000
+    os.makedirs("build/bench", exist_ok=True)
+    # Logs would dominate both measurements
+    with SwitchCore() as core:
+        core.create(config, nvm_dir="build/bench/lib")
+        core.set_log_level("off")
+        start = time.perf_counter()
+        for i in range(clicks):
+            core.set_gpio(0, i % 2)
+            core.advance(60)
+        lib_s = time.perf_counter() - start
+
+    with StubProc(
+        device_config=config,
+        nvm_dir="build/bench/proc",
+        protocol="binary",
+        log_level="off",
+    ) as proc:
+        start = time.perf_counter()
+        for i in range(clicks // 10):
+            proc.exec_batch([f"set_pin 0 {i % 2}", "step_time 60"])
+        proc_s = (time.perf_counter() - start) * 10
+
+    print(f"{clicks} edges + 60 ms each")
+    print(f"  libswitchcore  {lib_s * 1000:8.1f} ms")
+    print(f"  stub process   {proc_s * 1000:8.1f} ms (extrapolated)")
+    print(f"  speedup        {proc_s / lib_s:8.1f}x")
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,92 @@
+import os
+
+import pytest
+
+from tests.client import StubProc
+from tests.conftest import Device
+from tests.zcl_consts import (
+    ZCL_ATTR_BASIC_DEVICE_CONFIG,
+    ZCL_ATTR_BASIC_MFR_NAME,
+    ZCL_ATTR_ONOFF,
+    ZCL_CLUSTER_BASIC,
+    ZCL_CLUSTER_ON_OFF,
+)
+
+COMPILED_CONFIG_ITEM_FILE = os.path.join("./stub_nvm_data", "item_21.bin")
+
+INVALID_CONFIGS = [
+    pytest.param("M" * 32 + ";B;SA0u;RB0;", id="manufacturer_too_long"),
+    pytest.param("A;B;SZ99u;RB0;", id="invalid_pin"),
+    pytest.param("A;B;RA0Z99;", id="invalid_latching_off_pin"),
+]
+
+# Fine for a build with bigger tables, too big for the generic stub
+TOO_BIG_CONFIG = "A;B;RA0;RA1;RA2;RA3;RA4;"
+
+
+def _read_manufacturer(device: Device) -> str:
+    return device.read_zigbee_attr(1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_MFR_NAME)
+
+
+def test_compiled_config_reused_on_next_boot(capsys):
+    # Firmware logs streamed to stderr
+    with StubProc(device_config="A;B;SA0u;RB0;", log_ring=0):
+        pass
+    assert os.path.exists(COMPILED_CONFIG_ITEM_FILE)
+    assert "Compiling config" in capsys.readouterr().err
+
+    with StubProc(log_ring=0) as proc:
+        assert _read_manufacturer(Device(proc)) == "A"
+    log = capsys.readouterr().err
+    assert "Using compiled config" in log
+    assert "Compiling config" not in log
+
+
+def test_changed_config_is_compiled_again():
+    with StubProc(device_config="A;B;SA0u;RB0;"):
+        pass
+
+    with StubProc(device_config="C;D;SA0u;RB0;") as proc:
+        assert _read_manufacturer(Device(proc)) == "C"
+
+
+@pytest.mark.parametrize("config", INVALID_CONFIGS)
+def test_invalid_config_falls_back_to_default(config: str):
+    with StubProc(device_config=config) as proc:
+        device = Device(proc)
+        assert proc.is_running()
+        assert _read_manufacturer(device) == "unknown"
+
+
+def test_too_big_stored_config_keeps_entries_that_fit(capsys):
+    with StubProc(device_config=TOO_BIG_CONFIG, log_ring=0) as proc:
+        device = Device(proc)
+        assert _read_manufacturer(device) == "A"
+        # First four relays on ep 1-4, the fifth has no room
+        for ep in range(1, 5):
+            assert device.read_zigbee_attr(ep, ZCL_CLUSTER_ON_OFF, ZCL_ATTR_ONOFF)
+        assert (
+            device.read_zigbee_attr(1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_DEVICE_CONFIG)
+            == TOO_BIG_CONFIG
+        )
+    log = capsys.readouterr().err
+    assert "1 entries left out" in log
+    assert "using default config" not in log
+
+
+@pytest.mark.parametrize(
+    "config",
+    INVALID_CONFIGS + [pytest.param(TOO_BIG_CONFIG, id="too_many_relays")],
+)
+def test_invalid_config_write_is_rejected(config: str):
+    with StubProc(device_config="A;B;SA0u;RB0;") as proc:
+        device = Device(proc)
+        device.write_zigbee_attr(
+            1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_DEVICE_CONFIG, config
+        )
+        device.step_time(300)
+        assert not proc.wait_for_exit(0.2)
+        assert (
+            device.read_zigbee_attr(1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_DEVICE_CONFIG)
+            == "A;B;SA0u;RB0;"
+        )
@@ -0,0 +1,84 @@
+import os
+import struct
+
+from tests.client import StubProc
+from tests.conftest import Device
+from tests.zcl_consts import (
+    ZCL_ATTR_BASIC_DEVICE_CONFIG,
+    ZCL_ATTR_BASIC_MFR_NAME,
+    ZCL_ATTR_ONOFF_CONFIGURATION_SWITCH_MODE,
+    ZCL_ATTR_START_UP_ONOFF,
+    ZCL_CLUSTER_BASIC,
+    ZCL_CLUSTER_ON_OFF,
+    ZCL_CLUSTER_ON_OFF_SWITCH_CONFIG,
+)
+
+NVM_DIR = "./stub_nvm_data"
+CONFIG_ITEM_FILE = os.path.join(NVM_DIR, "item_02.bin")
+CONFIG_HEADER_SIZE = 4
+LEGACY_CONFIG_DATA_SIZE = 128
+
+
+def _write_config_item(data: bytes) -> None:
+    os.makedirs(NVM_DIR, exist_ok=True)
+    with open(CONFIG_ITEM_FILE, "wb") as f:
+        f.write(data)
+
+
+def _read_config(proc: StubProc) -> str:
+    return Device(proc).read_zigbee_attr(
+        1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_DEVICE_CONFIG
+    )
+
+
+def test_config_stored_with_only_used_bytes():
+    config = "A;B;SA0u;RB0;"
+    with StubProc(device_config=config):
+        pass
+
+    assert os.path.getsize(CONFIG_ITEM_FILE) == CONFIG_HEADER_SIZE + len(config)
+
+
+def test_legacy_fixed_size_config_is_read():
+    config = b"Legacy;Model;SA0u;RB0;"
+    legacy = struct.pack("<H", len(config)) + config.ljust(
+        LEGACY_CONFIG_DATA_SIZE, b"\0"
+    )
+    _write_config_item(legacy)
+
+    with StubProc() as proc:
+        assert _read_config(proc) == config.decode()
+        assert (
+            Device(proc).read_zigbee_attr(1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_MFR_NAME)
+            == "Legacy"
+        )
+
+
+def test_corrupted_config_falls_back_to_default():
+    config = "A;B;SA0u;RB0;"
+    with StubProc(device_config=config):
+        pass
+
+    with open(CONFIG_ITEM_FILE, "r+b") as f:
+        f.seek(CONFIG_HEADER_SIZE)
+        f.write(b"X")
+
+    with StubProc() as proc:
+        assert _read_config(proc) != config
+
+
+def test_cluster_settings_use_fixed_item_ids():
+    # Item ids must not depend on build capacities, or settings stored by a
+    # differently sized build would be lost
+    with StubProc(device_config="A;B;SA0u;SA1u;RB0;RB1;") as proc:
+        device = Device(proc)
+        device.write_zigbee_attr(
+            2,
+            ZCL_CLUSTER_ON_OFF_SWITCH_CONFIG,
+            ZCL_ATTR_ONOFF_CONFIGURATION_SWITCH_MODE,
+            "1",
+        )
+        device.write_zigbee_attr(4, ZCL_CLUSTER_ON_OFF, ZCL_ATTR_START_UP_ONOFF, "1")
+
+    assert os.path.exists(os.path.join(NVM_DIR, "item_05.bin"))
+    assert os.path.exists(os.path.join(NVM_DIR, "item_0a.bin"))
@@ -0,0 +1,170 @@
+from typing import Iterator
+
+import pytest
+
+from tests.conftest import Device, StubPool
+from tests.switchcore import SwitchCore
+from tests.test_network_join import HAL_ZIGBEE_NETWORK_NOT_JOINED
+from tests.zcl_consts import (
+    ZCL_ATTR_BASIC_DEVICE_CONFIG,
+    ZCL_ATTR_DIAGNOSTICS_BUTTON_EVENTS,
+    ZCL_ATTR_DIAGNOSTICS_BUTTON_EVENTS_EP_BASE,
+    ZCL_ATTR_DIAGNOSTICS_GPIO_INTERRUPTS,
+    ZCL_ATTR_DIAGNOSTICS_LATCHING_PULSES,
+    ZCL_ATTR_DIAGNOSTICS_NVM_WRITES,
+    ZCL_ATTR_DIAGNOSTICS_RELAY_OPERATIONS,
+    ZCL_ATTR_DIAGNOSTICS_REPORTS_SENT,
+    ZCL_ATTR_DIAGNOSTICS_RESET_REASON,
+    ZCL_ATTR_DIAGNOSTICS_SEND_FAILURES,
+    ZCL_ATTR_DIAGNOSTICS_TASKS_PEAK,
+    ZCL_ATTR_DIAGNOSTICS_UPTIME,
+    ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_RECEIVED,
+    ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_SENT,
+    ZCL_ATTR_ONOFF_CONFIGURATION_SWITCH_MODE,
+    ZCL_ATTR_ONOFF_CONFIGURATION_SWITCH_RELAY_MODE,
+    ZCL_CLUSTER_BASIC,
+    ZCL_CLUSTER_ON_OFF_SWITCH_CONFIG,
+    ZCL_CLUSTER_SWITCH_DIAGNOSTICS,
+    ZCL_ONOFF_CONFIGURATION_RELAY_MODE_DETACHED,
+)
+
+# HAL_RESET_REASON_* of src/hal/system.h
+RESET_REASON_POWER_ON = 1
+RESET_REASON_SOFTWARE = 2
+
+
+def read_counter(device: Device, attr: int) -> int:
+    return int(device.read_zigbee_attr(1, ZCL_CLUSTER_SWITCH_DIAGNOSTICS, attr))
+
+
+def test_uptime_counts_seconds(device: Device):
+    start = read_counter(device, ZCL_ATTR_DIAGNOSTICS_UPTIME)
+    device.freeze_time()
+    device.step_time(5500)
+
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_UPTIME) - start == 5
+
+
+def test_reset_reason_power_on(device: Device):
+    assert (
+        read_counter(device, ZCL_ATTR_DIAGNOSTICS_RESET_REASON)
+        == RESET_REASON_POWER_ON
+    )
+
+
+def test_reset_reason_after_firmware_reboot(tmp_path):
+    with SwitchCore() as core:
+        core.create("A;B;SA0u;RB0;", nvm_dir=str(tmp_path))
+        core.write_attr(
+            1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_DEVICE_CONFIG, "A;B;SA0u;RB0;RB1;"
+        )
+        assert core.advance(3000) == 1
+
+        reason = core.read_attr(
+            1, ZCL_CLUSTER_SWITCH_DIAGNOSTICS, ZCL_ATTR_DIAGNOSTICS_RESET_REASON
+        )
+        assert int(reason) == RESET_REASON_SOFTWARE
+
+
+def test_button_events_total_and_per_endpoint(device: Device, button_pins):
+    device.click_button(button_pins[0])
+    device.click_button(button_pins[0])
+    device.click_button(button_pins[1])
+
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_BUTTON_EVENTS) == 6
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_BUTTON_EVENTS_EP_BASE + 1) == 4
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_BUTTON_EVENTS_EP_BASE + 2) == 2
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_BUTTON_EVENTS_EP_BASE + 3) == 0
+    # Every edge reaches the ISR, debouncing only filters afterwards
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_GPIO_INTERRUPTS) >= 6
+
+
+def test_relay_operations_and_commands_received(device: Device):
+    relay_ep = 5
+    device.zcl_relay_on(relay_ep)
+    device.zcl_relay_off(relay_ep)
+
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_RELAY_OPERATIONS) == 2
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_RECEIVED) == 2
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_REPORTS_SENT) >= 2
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_LATCHING_PULSES) == 0
+
+
+def test_commands_sent(device: Device, button_pin):
+    device.write_zigbee_attr(
+        1,
+        ZCL_CLUSTER_ON_OFF_SWITCH_CONFIG,
+        ZCL_ATTR_ONOFF_CONFIGURATION_SWITCH_RELAY_MODE,
+        ZCL_ONOFF_CONFIGURATION_RELAY_MODE_DETACHED,
+    )
+    device.click_button(button_pin)
+    sent = read_counter(device, ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_SENT)
+    assert sent > 0
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_SEND_FAILURES) == 0
+
+    # Not joined, the switch does not even try
+    device.set_network(HAL_ZIGBEE_NETWORK_NOT_JOINED)
+    device.click_button(button_pin)
+
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_SENT) == sent
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_SEND_FAILURES) == 0
+
+
+def test_send_failures(tmp_path):
+    with SwitchCore() as core:
+        core.create("A;B;SA0u;RB0;", nvm_dir=str(tmp_path))
+        core.write_attr(
+            1,
+            ZCL_CLUSTER_ON_OFF_SWITCH_CONFIG,
+            ZCL_ATTR_ONOFF_CONFIGURATION_SWITCH_RELAY_MODE,
+            ZCL_ONOFF_CONFIGURATION_RELAY_MODE_DETACHED,
+        )
+
+        def click() -> None:
+            for value in (0, 1):
+                core.set_gpio(0, value)  # A0
+                core.advance(100)
+
+        def counter(attr: int) -> int:
+            return int(core.read_attr(1, ZCL_CLUSTER_SWITCH_DIAGNOSTICS, attr))
+
+        core.set_send_fail(True)
+        click()
+        failures = counter(ZCL_ATTR_DIAGNOSTICS_SEND_FAILURES)
+        assert failures > 0
+        assert counter(ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_SENT) == 0
+
+        core.set_send_fail(False)
+        click()
+        assert counter(ZCL_ATTR_DIAGNOSTICS_SEND_FAILURES) == failures
+        assert counter(ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_SENT) > 0
+
+
+def test_nvm_writes_count_config_changes(device: Device):
+    before = read_counter(device, ZCL_ATTR_DIAGNOSTICS_NVM_WRITES)
+    device.write_zigbee_attr(
+        1, ZCL_CLUSTER_ON_OFF_SWITCH_CONFIG, ZCL_ATTR_ONOFF_CONFIGURATION_SWITCH_MODE, 1
+    )
+
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_NVM_WRITES) == before + 1
+
+
+def test_tasks_peak_tracks_scheduled_tasks(device: Device, button_pin):
+    device.freeze_time()
+    device.set_gpio(button_pin, 0)
+
+    assert read_counter(device, ZCL_ATTR_DIAGNOSTICS_TASKS_PEAK) >= 1
+
+
+@pytest.fixture()
+def latching_device(stub_pool: StubPool) -> Iterator[Device]:
+    yield Device(stub_pool.get("X;Y;RB0C0;"))
+    stub_pool.release()
+
+
+def test_latching_pulses(latching_device: Device):
+    latching_device.zcl_relay_on(1)
+    latching_device.zcl_relay_off(1)
+
+    assert read_counter(latching_device, ZCL_ATTR_DIAGNOSTICS_LATCHING_PULSES) == 2
+    assert read_counter(latching_device, ZCL_ATTR_DIAGNOSTICS_RELAY_OPERATIONS) == 2
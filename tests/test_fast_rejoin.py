@@ -0,0 +1,148 @@
+from tests.switchcore import SwitchCore
+from tests.test_network_join import (
+    HAL_ZIGBEE_NETWORK_JOINED,
+    HAL_ZIGBEE_NETWORK_NOT_JOINED,
+    NETWORK_STEERING_BACKOFF_BASE_MS,
+    NETWORK_STEERING_BACKOFF_CAP_MS,
+    NETWORK_STEERING_INITIAL_WINDOW_MS,
+)
+from tests.zcl_consts import (
+    ZCL_ATTR_DIAGNOSTICS_NVM_WRITES,
+    ZCL_CLUSTER_SWITCH_DIAGNOSTICS,
+)
+
+CONFIG = "A;B;SA0u;RB0;"
+
+# src/zigbee/fast_rejoin.h
+FAST_REJOIN_ATTEMPTS = 2
+
+# Simulated rejoin timing of src/stub/hal/zigbee.c
+CHANNEL_SCAN_MS = 138
+REJOIN_EXCHANGE_MS = 50
+ALL_CHANNELS = 16
+
+COORDINATOR_CHANNEL = 15
+
+
+def scan_times(core: SwitchCore) -> list[int]:
+    return [
+        int(e.payload["t"])
+        for e in core.events
+        if e.kind == "zdo_rejoin"
+        and bin(int(e.payload["channels"], 16)).count("1") == ALL_CHANNELS
+    ]
+
+
+def rejoin_masks(core: SwitchCore) -> list[int]:
+    return [
+        int(e.payload["channels"], 16) for e in core.events if e.kind == "zdo_rejoin"
+    ]
+
+
+def joined_at(core: SwitchCore) -> int | None:
+    for e in core.events:
+        if (
+            e.kind == "network_status"
+            and int(e.payload["status"]) == HAL_ZIGBEE_NETWORK_JOINED
+        ):
+            return int(e.payload["t"])
+    return None
+
+
+def power_cycle(core: SwitchCore) -> None:
+    """Boots again still commissioned, but without a parent yet.
+
+    The first rejoin starts in the boot loop, before events are reported.
+    """
+    core.reset(CONFIG, joined=False, keep_nvm=True)
+
+
+def test_power_cycle_rejoins_on_cached_channel(tmp_path) -> None:
+    with SwitchCore() as core:
+        core.create(CONFIG, nvm_dir=str(tmp_path))
+        power_cycle(core)
+        core.advance(1000)
+
+        # Power on to relay controllable over Zigbee, one channel scanned
+        assert joined_at(core) <= CHANNEL_SCAN_MS + REJOIN_EXCHANGE_MS
+        assert rejoin_masks(core) == []
+
+
+def test_moved_coordinator_is_found_by_full_scan(tmp_path) -> None:
+    with SwitchCore() as core:
+        core.create(CONFIG, nvm_dir=str(tmp_path))
+        core.set_coordinator_channel(20)
+        power_cycle(core)
+        core.advance(5000)
+
+        masks = rejoin_masks(core)
+        assert len(masks) == FAST_REJOIN_ATTEMPTS
+        assert masks[0] == 1 << COORDINATOR_CHANNEL
+        assert bin(masks[1]).count("1") == ALL_CHANNELS
+        fast = FAST_REJOIN_ATTEMPTS * (CHANNEL_SCAN_MS + REJOIN_EXCHANGE_MS)
+        scan = ALL_CHANNELS * CHANNEL_SCAN_MS + REJOIN_EXCHANGE_MS
+        assert joined_at(core) <= fast + scan
+
+        # The new channel is cached for the next power cycle
+        power_cycle(core)
+        core.advance(1000)
+        assert joined_at(core) <= CHANNEL_SCAN_MS + REJOIN_EXCHANGE_MS
+
+
+def test_no_steering_while_commissioned(tmp_path) -> None:
+    with SwitchCore() as core:
+        core.create(CONFIG, nvm_dir=str(tmp_path))
+        core.set_coordinator_channel(0)
+        power_cycle(core)
+        core.advance(NETWORK_STEERING_BACKOFF_CAP_MS)
+
+        assert len(rejoin_masks(core)) > FAST_REJOIN_ATTEMPTS
+        assert joined_at(core) is None
+        assert not any(e.kind == "zcl_start_network_steering" for e in core.events)
+
+        # Left the network, joining a new one is up to steering
+        core.set_network(HAL_ZIGBEE_NETWORK_NOT_JOINED)
+        core.advance(NETWORK_STEERING_INITIAL_WINDOW_MS)
+        assert any(e.kind == "zcl_start_network_steering" for e in core.events)
+
+
+def test_full_scans_back_off_like_steering(tmp_path) -> None:
+    with SwitchCore() as core:
+        # Kept across instances, the first full scan must come after the
+        # cached channel attempts to be seen
+        core.set_coordinator_channel(COORDINATOR_CHANNEL)
+        core.create(CONFIG, nvm_dir=str(tmp_path))
+        core.set_coordinator_channel(0)
+        power_cycle(core)
+        core.advance(8 * NETWORK_STEERING_BACKOFF_CAP_MS)
+
+        times = scan_times(core)
+        assert len(times) > 8
+        scan = ALL_CHANNELS * CHANNEL_SCAN_MS
+        for attempt, (prev, nxt) in enumerate(zip(times[:8], times[1:])):
+            delay = min(
+                NETWORK_STEERING_BACKOFF_BASE_MS << attempt,
+                NETWORK_STEERING_BACKOFF_CAP_MS,
+            )
+            assert delay // 2 <= nxt - prev - scan <= delay
+
+
+def nvm_writes(core: SwitchCore) -> int:
+    return int(
+        core.read_attr(
+            1, ZCL_CLUSTER_SWITCH_DIAGNOSTICS, ZCL_ATTR_DIAGNOSTICS_NVM_WRITES
+        )
+    )
+
+
+def test_cached_network_is_written_once(tmp_path) -> None:
+    with SwitchCore() as core:
+        core.create(CONFIG, nvm_dir=str(tmp_path))
+        assert nvm_writes(core) > 0
+
+        core.reset(CONFIG, keep_nvm=True)
+        core.advance(1000)
+        assert nvm_writes(core) == 0
+        power_cycle(core)
+        core.advance(1000)
+        assert nvm_writes(core) == 0
@@ -0,0 +1,76 @@
+from tests.client import StubProc
+from tests.conftest import Device
+from tests.zcl_consts import (
+    ZCL_ATTR_BASIC_DEVICE_CONFIG,
+    ZCL_ATTR_BASIC_MFR_NAME,
+    ZCL_ATTR_ONOFF_CONFIGURATION_SWITCH_MODE,
+    ZCL_CLUSTER_BASIC,
+    ZCL_CLUSTER_ON_OFF_SWITCH_CONFIG,
+    ZCL_ONOFF_CONFIGURATION_SWITCH_TYPE_MOMENTARY,
+)
+
+BASE_CONFIG = "A;B;LC0;SA0u;RB0;"
+
+
+def _write_config(proc: StubProc, config: str) -> bool:
+    """Writes config, returns True if the device rebooted to apply it"""
+    device = Device(proc)
+    device.write_zigbee_attr(1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_DEVICE_CONFIG, config)
+    device.step_time(300)  # Reboot would happen after small delay
+    return proc.wait_for_exit(0.2)
+
+
+def test_led_pin_change_applied_in_place():
+    with StubProc(device_config=BASE_CONFIG) as proc:
+        device = Device(proc)
+        assert device.get_gpio("C0", refresh=True)
+
+        assert not _write_config(proc, "A;B;LC1;SA0u;RB0;")
+        assert device.get_gpio("C1", refresh=True)
+        assert not device.get_gpio("C0", refresh=True)
+
+
+def test_names_and_momentary_mode_applied_in_place():
+    with StubProc(device_config=BASE_CONFIG) as proc:
+        device = Device(proc)
+
+        assert not _write_config(proc, "X;Y;LC0;SA0d;RB0;M;SLP;")
+        assert (
+            device.read_zigbee_attr(1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_MFR_NAME)
+            == "X"
+        )
+        assert device.read_zigbee_attr(
+            1,
+            ZCL_CLUSTER_ON_OFF_SWITCH_CONFIG,
+            ZCL_ATTR_ONOFF_CONFIGURATION_SWITCH_MODE,
+        ) == str(ZCL_ONOFF_CONFIGURATION_SWITCH_TYPE_MOMENTARY)
+
+
+def test_extra_indicator_applied_in_place():
+    with StubProc(device_config="A;B;SA0u;RB0;IC0;") as proc:
+        assert not _write_config(proc, "A;B;SA0u;RB0;IC0;IC1;")
+
+
+def test_live_config_persists_after_reboot():
+    config = "A;B;LC1;SA0u;RB0;"
+    with StubProc(device_config=BASE_CONFIG) as proc:
+        assert not _write_config(proc, config)
+
+    with StubProc() as proc:
+        device = Device(proc)
+        assert (
+            device.read_zigbee_attr(1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_DEVICE_CONFIG)
+            == config
+        )
+        assert device.get_gpio("C1", refresh=True)
+
+
+def test_endpoint_layout_change_reboots():
+    with StubProc(device_config=BASE_CONFIG) as proc:
+        assert _write_config(proc, "A;B;LC0;SA0u;RB0;RB1;")
+
+
+def test_first_relay_indicator_reboots():
+    # Indicator adds On/Off attributes to the relay endpoint
+    with StubProc(device_config=BASE_CONFIG) as proc:
+        assert _write_config(proc, "A;B;LC0;SA0u;RB0;IC1;")
@@ -0,0 +1,100 @@
+import pytest
+
+from tests.client import StubProc
+from tests.conftest import DEBOUNCE_MS, Device
+
+CONFIG = "A;B;SA0u;RB0;"
+RELAY_PIN = 16  # B0
+
+
+@pytest.fixture
+def device_config() -> str:
+    return CONFIG
+
+
+def _wave(proc: StubProc, kind: str, **options: int) -> dict[str, int]:
+    args = " ".join(f"{key}={value}" for key, value in options.items())
+    res = proc.exec(f"wave A0 {kind} {args}")
+    assert res.ok, f"Waveform failed: {res.payload}"
+    return {key: int(value) for key, value in res.payload.items()}
+
+
+def _relay_changes(device: Device) -> list[int]:
+    return [
+        int(e.payload["value"])
+        for e in device._events
+        if e.kind == "gpio" and int(e.payload["pin"]) == RELAY_PIN
+    ]
+
+
+@pytest.mark.parametrize("count", [1, 4, 12])
+def test_bounce_burst_is_one_press(stub_proc: StubProc, count: int):
+    device = Device(stub_proc)
+    device.clear_events()
+
+    stats = _wave(stub_proc, "bounce", level=0, count=count, seed=count)
+
+    assert stats["edges"] == 1 + 2 * count
+    assert stats["callbacks"] == stats["edges"]
+    # Every edge after the first restarts the pending debounce
+    assert stats["reschedules"] == 2 * count
+    assert (stats["debounced"], stats["false_presses"], stats["missed"]) == (
+        1,
+        0,
+        0,
+    )
+    assert _relay_changes(device) == [1]
+
+
+def test_jitter_is_repeatable_per_seed(stub_proc: StubProc):
+    first = _wave(stub_proc, "bounce", level=0, jitter_us=900, seed=7)
+    stub_proc.reset(CONFIG)
+    second = _wave(stub_proc, "bounce", level=0, jitter_us=900, seed=7)
+
+    first.pop("cpu_us")
+    second.pop("cpu_us")
+    assert first == second
+
+
+def test_glitch_shorter_than_debounce_is_ignored(stub_proc: StubProc):
+    device = Device(stub_proc)
+    device.clear_events()
+
+    stats = _wave(stub_proc, "glitch", width_us=(DEBOUNCE_MS - 1) * 1000)
+
+    assert (stats["edges"], stats["false_presses"]) == (2, 0)
+    assert _relay_changes(device) == []
+
+
+def test_glitch_longer_than_debounce_is_a_false_press(stub_proc: StubProc):
+    stats = _wave(stub_proc, "glitch", width_us=(DEBOUNCE_MS + 10) * 1000)
+
+    assert stats["false_presses"] == 2  # Press and release
+
+
+def test_mains_hum_never_settles_into_a_press(stub_proc: StubProc):
+    device = Device(stub_proc)
+    device.clear_events()
+
+    stats = _wave(stub_proc, "hum", duration_ms=1000, jitter_us=300)
+
+    assert stats["edges"] == 200
+    assert stats["false_presses"] == 0
+    assert _relay_changes(device) == []
+    # The debounce is restarted by every edge and runs only after the hum
+    assert stats["reschedules"] == stats["edges"] - 1
+
+
+def test_stats_count_callbacks_and_reschedules(stub_proc: StubProc):
+    stub_proc.exec("stats reset")
+    _wave(stub_proc, "bounce", level=0, count=3)
+
+    stats = stub_proc.exec("stats").payload
+    assert int(stats["gpio_callbacks"]) == 7
+    assert int(stats["task_reschedules"]) == 6
+
+
+def test_bad_waveform_options(stub_proc: StubProc):
+    assert "usage" in stub_proc.exec("wave A0 sine").payload
+    assert not stub_proc.exec("wave A0 bounce level=2").ok
+    assert not stub_proc.exec("wave A0 hum period=10").ok
@@ -4,7 +4,7 @@ from typing import Iterator
 import pytest
 
 from tests.client import StubProc
-from tests.conftest import Device, wait_for
+from tests.conftest import Device, StubPool, wait_for
 from tests.zcl_consts import ZCL_CLUSTER_ON_OFF
 
 
@@ -26,17 +26,17 @@ def pins_config() -> list[LatchingRelayTestConfig]:
 
 
 @pytest.fixture()
-def latching_device(pins_config: list[LatchingRelayTestConfig]) -> Iterator[Device]:
+def latching_device(
+    stub_pool: StubPool, pins_config: list[LatchingRelayTestConfig]
+) -> Iterator[Device]:
     cfg = "X;Y;" + ";".join(f"R{cfg.on_pin}{cfg.off_pin}" for cfg in pins_config) + ";"
-    p = StubProc(device_config=cfg).start()
-    try:
-        yield Device(p)
-    finally:
-        p.stop()
+    yield Device(stub_pool.get(cfg))
+    stub_pool.release()
 
 
 @pytest.fixture()
 def latching_simultenious_device(
+    stub_pool: StubPool,
     pins_config: list[LatchingRelayTestConfig],
 ) -> Iterator[Device]:
     cfg = (
@@ -44,11 +44,8 @@ def latching_simultenious_device(
         + ";".join(f"R{cfg.on_pin}{cfg.off_pin}" for cfg in pins_config)
         + ";"
     )
-    p = StubProc(device_config=cfg).start()
-    try:
-        yield Device(p)
-    finally:
-        p.stop()
+    yield Device(stub_pool.get(cfg))
+    stub_pool.release()
 
 
 def count_pins_high(device: Device, pins_config: list[LatchingRelayTestConfig]) -> int:
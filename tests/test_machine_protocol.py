@@ -0,0 +1,71 @@
+import pytest
+
+from tests.client import StubProc
+from tests.conftest import Device
+from tests.zcl_consts import ZCL_ATTR_ONOFF, ZCL_CLUSTER_ON_OFF
+
+CONFIG = "A;B;SA0u;RB0;"
+RELAY_PIN = 16  # B0
+
+
+def test_batch_runs_commands_in_order():
+    with StubProc(device_config=CONFIG, protocol="binary") as proc:
+        results = proc.exec_batch(
+            [
+                "set_pin 0 0",
+                "step_time 60",
+                f"zcl_read 2 0x{ZCL_CLUSTER_ON_OFF:04X} 0x{ZCL_ATTR_ONOFF:04X}",
+                f"read_pin {RELAY_PIN}",
+                "no_such_command",
+            ]
+        )
+
+    assert [r.ok for r in results] == [True, True, True, True, False]
+    assert results[1].payload["stepped_ms"] == "60"
+    assert results[2].payload["value"] == "1"
+    assert results[3].payload["value"] == "1"
+    assert "unknown_cmd" in results[4].payload
+
+
+def test_pipelined_batches_are_matched_by_sequence_number():
+    with StubProc(device_config=CONFIG, protocol="binary") as proc:
+        first = proc.send_batch(["step_time 10", "s"])
+        second = proc.send_batch(["step_time 5", "s"])
+
+        assert proc.wait_batch(second)[1].payload["uptime_ms"] == "15"
+        assert proc.wait_batch(first)[1].payload["uptime_ms"] == "10"
+
+
+@pytest.mark.parametrize("protocol", ["text", "binary"])
+def test_subscription_filters_events_by_kind(protocol: str):
+    with StubProc(device_config=CONFIG, protocol=protocol) as proc:
+        device = Device(proc)
+        proc.subscribe(["gpio"])
+        device.clear_events()
+
+        device.zcl_relay_on(2)
+        device.step_time(1)
+
+        assert {e.kind for e in device._events} == {"gpio"}
+
+        proc.subscribe([])
+        device.clear_events()
+        device.zcl_relay_off(2)
+        device.step_time(1)
+
+        assert device._events == []
+
+
+def test_batch_reports_reboot():
+    with StubProc(device_config=CONFIG, protocol="binary") as proc:
+        results = proc.exec_batch(
+            [
+                "zcl_write 1 0x0000 0xFF00 C;D;",
+                "step_time 300",  # Device reboots after the config change
+                "s",
+            ]
+        )
+
+        assert results[0].ok
+        assert "exited" in results[2].payload
+        assert proc.wait_for_exit(1.0)
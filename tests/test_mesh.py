@@ -0,0 +1,100 @@
+import os
+
+from tests.mesh import (
+    COORDINATOR,
+    DEBOUNCE_MS,
+    RELAY_CONFIG,
+    RELAY_PIN,
+    SWITCH_CONFIG,
+    SWITCH_PIN,
+    Mesh,
+    MeshStats,
+    bench_group,
+    bench_staircase,
+)
+from tests.zcl_consts import ZCL_ATTR_ONOFF, ZCL_CLUSTER_ON_OFF, ZCL_CMD_ONOFF_ON
+
+
+def test_staircase_latency_and_message_count():
+    result = bench_staircase(hop_latency_ms=10, hops=2)
+
+    # Local switch only debounces, remote ones add two hops
+    assert result.latencies_ms == [DEBOUNCE_MS, DEBOUNCE_MS + 20, DEBOUNCE_MS + 20]
+    # Two remote toggles of two hops each, plus one-hop reports of the lamp
+    # relay (3) and of every switch (3)
+    assert result.stats == MeshStats(sent=8, frames=10, delivered=8, lost=0)
+    assert result.reports == 6
+
+
+def test_group_cast_reaches_twenty_relays():
+    result = bench_group(relays=20, hop_latency_ms=10)
+
+    assert len(result.latencies_ms) == 20
+    assert sorted(set(result.latencies_ms)) == [
+        DEBOUNCE_MS + 10,
+        DEBOUNCE_MS + 20,
+        DEBOUNCE_MS + 30,
+    ]
+    # A single group cast relayed once by each of the 21 nodes, plus a report
+    # from every relay and from the switch
+    assert result.stats == MeshStats(sent=22, frames=42, delivered=41, lost=0)
+
+
+def test_reports_reach_coordinator_after_hop_latency():
+    with Mesh(hop_latency_ms=15) as mesh:
+        mesh.add_node("relay", RELAY_CONFIG)
+        mesh.set_hops("relay", COORDINATOR, 3)
+        mesh.settle()
+        mesh.reports.clear()
+
+        at = mesh.send_from_coordinator(
+            "relay", 1, ZCL_CLUSTER_ON_OFF, ZCL_CMD_ONOFF_ON
+        )
+        mesh.settle()
+
+        assert mesh.nodes["relay"].gpio_changes(RELAY_PIN) == [(at + 45, 1)]
+        assert len(mesh.reports) == 1
+        report = mesh.reports[0]
+        assert (report.src, report.ep, report.cluster, report.attr) == (
+            "relay",
+            1,
+            ZCL_CLUSTER_ON_OFF,
+            ZCL_ATTR_ONOFF,
+        )
+        assert (report.sent_at, report.received_at) == (at + 45, at + 90)
+
+
+def _lossy_group_run(seed: int) -> tuple[MeshStats, list[str]]:
+    with Mesh(hop_latency_ms=5, loss=0.3, seed=seed) as mesh:
+        mesh.add_node("switch", SWITCH_CONFIG)
+        mesh.bind_group("switch", 1, ZCL_CLUSTER_ON_OFF, 0x0002)
+        for i in range(10):
+            mesh.add_node(f"relay{i}", RELAY_CONFIG)
+            mesh.add_to_group(0x0002, f"relay{i}", 1)
+        mesh.flip("switch", SWITCH_PIN)
+        switched = [
+            name
+            for name, node in mesh.nodes.items()
+            if node.gpio_changes(RELAY_PIN)
+        ]
+        return mesh.stats, switched
+
+
+def test_loss_is_reproducible_per_seed():
+    stats, switched = _lossy_group_run(seed=7)
+
+    assert stats.lost > 0
+    assert 0 < len(switched) < 10
+    assert _lossy_group_run(seed=7) == (stats, switched)
+
+
+def test_nodes_keep_separate_nvm(tmp_path):
+    with Mesh(workdir=str(tmp_path)) as mesh:
+        mesh.add_node("a", SWITCH_CONFIG)
+        mesh.add_node("b", RELAY_CONFIG)
+
+    with open(os.path.join(tmp_path, "a", "item_02.bin"), "rb") as f:
+        assert SWITCH_CONFIG.encode() in f.read()
+    with open(os.path.join(tmp_path, "b", "item_02.bin"), "rb") as f:
+        assert RELAY_CONFIG.encode() in f.read()
+    assert not os.path.exists("./stub_nvm_data")
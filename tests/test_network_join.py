@@ -1,14 +1,25 @@
 from tests.client import StubProc
 from tests.conftest import Device
+from tests.switchcore import SwitchCore
 
 HAL_ZIGBEE_NETWORK_NOT_JOINED = 0
 HAL_ZIGBEE_NETWORK_JOINED = 1
 HAL_ZIGBEE_NETWORK_JOINING = 2
 
+# src/zigbee/network_steering.h
+NETWORK_STEERING_INITIAL_WINDOW_MS = 5000
+NETWORK_STEERING_BACKOFF_BASE_MS = 10000
+NETWORK_STEERING_BACKOFF_CAP_MS = 5 * 60 * 1000
+
+# src/zigbee/startup_traffic.h
+BOOT_ANNOUNCE_WINDOW_MS = 3000
+STARTUP_REPORT_WINDOW_MS = 10000
+
 
 def test_tries_to_join_on_startup_not_joined() -> None:
     with StubProc(device_config="A;B;LB0;", joined=False) as proc:
         device = Device(proc)
+        device.step_time(NETWORK_STEERING_INITIAL_WINDOW_MS)
 
         data = device.status()
         assert data["joined"] == str(HAL_ZIGBEE_NETWORK_JOINING)
@@ -42,6 +53,7 @@ def test_auto_joining_after_kicked() -> None:
         device = Device(proc)
 
         device.set_network(HAL_ZIGBEE_NETWORK_NOT_JOINED)
+        device.step_time(NETWORK_STEERING_INITIAL_WINDOW_MS)
 
         data = device.status()
         assert data["joined"] == str(HAL_ZIGBEE_NETWORK_JOINING)
@@ -80,7 +92,8 @@ def test_leaves_on_onboard_button_long_press() -> None:
         device.press_button("A0")
         device.step_time(3000)
 
-        assert device.status()["joined"] != str(HAL_ZIGBEE_NETWORK_JOINING)
+        assert any(e.kind == "zcl_leave_network" for e in device._events)
+        assert device.status()["joined"] != str(HAL_ZIGBEE_NETWORK_JOINED)
 
 
 def test_announces_after_join() -> None:
@@ -88,5 +101,77 @@ def test_announces_after_join() -> None:
         device = Device(proc)
 
         device.set_network(HAL_ZIGBEE_NETWORK_JOINED)
+        device.step_time(BOOT_ANNOUNCE_WINDOW_MS)
 
         device.wait_for_announce()
+
+
+def steering_times(core: SwitchCore) -> list[int]:
+    return [
+        int(e.payload["t"])
+        for e in core.events
+        if e.kind == "zcl_start_network_steering"
+    ]
+
+
+def first_steering_delay(ieee: int, tmp_path) -> int:
+    with SwitchCore() as core:
+        core.set_ieee_address(ieee)
+        core.create("A;B;LB0;", nvm_dir=str(tmp_path), joined=False)
+        core.advance(NETWORK_STEERING_INITIAL_WINDOW_MS)
+        times = steering_times(core)
+        assert len(times) == 1
+        return times[0]
+
+
+def test_first_steering_delay_is_seeded_by_ieee_address(tmp_path) -> None:
+    delays = {
+        first_steering_delay(0xA4C1380000000000 + i, tmp_path) for i in range(4)
+    }
+
+    assert all(0 <= d < NETWORK_STEERING_INITIAL_WINDOW_MS for d in delays)
+    assert len(delays) > 1
+    # Same device, same delay
+    assert first_steering_delay(0xA4C1380000000000, tmp_path) in delays
+
+
+def test_steering_backs_off_after_failures(tmp_path) -> None:
+    with SwitchCore() as core:
+        core.create("A;B;LB0;", nvm_dir=str(tmp_path), joined=False)
+        core.advance(NETWORK_STEERING_INITIAL_WINDOW_MS)
+
+        failed_at = []
+        for _ in range(8):
+            failed_at.append(core.millis())
+            core.set_network(HAL_ZIGBEE_NETWORK_NOT_JOINED)
+            core.advance(NETWORK_STEERING_BACKOFF_CAP_MS)
+
+        retries = steering_times(core)[1:]
+        assert len(retries) == len(failed_at)
+        for attempt, (failed, retry) in enumerate(zip(failed_at, retries)):
+            delay = min(
+                NETWORK_STEERING_BACKOFF_BASE_MS << attempt,
+                NETWORK_STEERING_BACKOFF_CAP_MS,
+            )
+            assert delay // 2 <= retry - failed <= delay
+
+
+def test_steering_backoff_resets_after_join(tmp_path) -> None:
+    with SwitchCore() as core:
+        core.create("A;B;LB0;", nvm_dir=str(tmp_path), joined=False)
+        core.advance(NETWORK_STEERING_INITIAL_WINDOW_MS)
+        for _ in range(4):
+            core.set_network(HAL_ZIGBEE_NETWORK_NOT_JOINED)
+            core.advance(NETWORK_STEERING_BACKOFF_CAP_MS)
+
+        core.set_network(HAL_ZIGBEE_NETWORK_JOINED)
+        core.advance(NETWORK_STEERING_BACKOFF_CAP_MS)
+        assert len(steering_times(core)) == 5
+
+        # Kicked: a fresh start within the initial window
+        kicked_at = core.millis()
+        core.set_network(HAL_ZIGBEE_NETWORK_NOT_JOINED)
+        core.advance(NETWORK_STEERING_INITIAL_WINDOW_MS)
+        times = steering_times(core)
+        assert len(times) == 6
+        assert times[-1] - kicked_at < NETWORK_STEERING_INITIAL_WINDOW_MS
@@ -0,0 +1,48 @@
+import re
+
+from tests.client import StubProc
+
+# Every lookup hits flash: reads, size queries and misses
+NVM_ACCESS_RE = re.compile(
+    r"\[NVM\] (?:Read \d+ bytes from item ([0-9a-f]{2})"
+    r"|Item ([0-9a-f]{2}) (?:has \d+ bytes|not found))"
+)
+NVM_SIZE_RE = re.compile(r"\[NVM\] Item ([0-9a-f]{2}) has \d+ bytes")
+
+# Config string and compiled config are stored at a variable size, their
+# readers need the size first
+VARIABLE_SIZE_ITEMS = {"02", "21"}
+
+
+def _boot_nvm_log(capsys, config: str) -> str:
+    with StubProc(device_config=config):
+        pass
+    capsys.readouterr()
+
+    with StubProc(log_level="trace", log_ring=0) as proc:
+        proc.exec("help")
+    return capsys.readouterr().err
+
+
+def _accesses(log: str) -> list[str]:
+    return [a or b for a, b in NVM_ACCESS_RE.findall(log)]
+
+
+def test_each_item_read_once_at_boot(capsys):
+    log = _boot_nvm_log(capsys, "A;B;SA0u;SA1u;RB0;RB1;")
+    accesses = _accesses(log)
+
+    assert accesses
+    assert set(NVM_SIZE_RE.findall(log)) <= VARIABLE_SIZE_ITEMS
+    counts = {item: accesses.count(item) for item in accesses}
+    counts["02"] -= 1  # stub_app_init() looks for a stored config first
+    for item, count in counts.items():
+        assert count == (2 if item in VARIABLE_SIZE_ITEMS else 1), item
+
+
+def test_unused_slots_are_not_looked_up(capsys):
+    accesses = _accesses(_boot_nvm_log(capsys, "A;B;SA0u;RB0;"))
+
+    # Switch 1 is item 05, relay 1 item 0a
+    assert "04" in accesses and "09" in accesses
+    assert "05" not in accesses and "0a" not in accesses
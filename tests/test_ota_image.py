@@ -0,0 +1,245 @@
+import os
+import random
+import struct
+import sys
+from pathlib import Path
+
+from tests.switchcore import SwitchCore
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), "..", "helper_scripts"))
+import make_z2m_ota_index  # noqa: E402
+import ota_compress  # noqa: E402
+import ota_delta  # noqa: E402
+
+CONFIG = "A;B;SA0u;RB0;"
+
+# Simulated download of src/stub/hal/ota.c
+BLOCK_SIZE = 50
+BLOCK_INTERVAL_MS = 10
+SECTOR_SIZE = 4096
+
+
+def make_firmware(size: int = 24 * 1024) -> bytes:
+    """Code-like data: repeats near and far, so matches reach back into the
+    slot, with random bytes between them."""
+    rng = random.Random(1)
+    words = [rng.randbytes(rng.randint(2, 12)) for _ in range(64)]
+    out = bytearray()
+    while len(out) < size:
+        if rng.random() < 0.2 and len(out) > 2048:
+            start = rng.randrange(len(out) - 1024)
+            out += out[start : start + rng.randint(16, 600)]
+        else:
+            out += rng.choice(words)
+    return bytes(out[:size])
+
+
+def make_ota_file(firmware: bytes, version: int = 0x01020304) -> bytes:
+    header = struct.pack(
+        "<I5HIH32sI",
+        ota_compress.OTA_MAGIC,
+        0x0100,
+        56,
+        0,
+        0x1141,
+        0xD3A3,
+        version,
+        2,
+        b"Test image",
+        56 + 6 + len(firmware),
+    )
+    return header + struct.pack("<HI", 0, len(firmware)) + firmware
+
+
+def edit_firmware(firmware: bytes) -> bytes:
+    """A small release: a few changed bytes, an inserted and a removed range."""
+    out = bytearray(firmware)
+    out[100:104] = b"\x01\x02\x03\x04"
+    out[5000:5000] = random.Random(2).randbytes(300)
+    del out[15000:15200]
+    return bytes(out)
+
+
+def download_time_ms(file: bytes) -> int:
+    blocks = (len(file) + BLOCK_SIZE - 1) // BLOCK_SIZE
+    return (blocks + 1) * BLOCK_INTERVAL_MS
+
+
+def ota_results(core: SwitchCore) -> list[tuple[int, int]]:
+    return [
+        (int(e.payload["status"]), int(e.payload["size"]))
+        for e in core.events
+        if e.kind == "ota_complete"
+    ]
+
+
+def test_compressed_image_is_decompressed_into_the_slot(tmp_path) -> None:
+    firmware = make_firmware()
+    plain = make_ota_file(firmware)
+    compressed = ota_compress.compress_ota_file(plain)
+    assert len(compressed) < len(plain) * 3 // 4
+
+    with SwitchCore() as core:
+        core.create(CONFIG, nvm_dir=str(tmp_path))
+        core.ota_serve(compressed)
+        core.advance(download_time_ms(compressed))
+
+        assert ota_results(core) == [(0, len(firmware))]
+        assert core.read_ota_slot(0, len(firmware)) == firmware
+
+
+def test_plain_image_is_written_as_is(tmp_path) -> None:
+    firmware = make_firmware()
+    plain = make_ota_file(firmware)
+
+    with SwitchCore() as core:
+        core.create(CONFIG, nvm_dir=str(tmp_path))
+        core.ota_serve(plain)
+        core.advance(download_time_ms(plain))
+
+        assert ota_results(core) == [(0, len(firmware))]
+        assert core.read_ota_slot(0, len(firmware)) == firmware
+
+
+def test_corrupt_image_invalidates_the_slot(tmp_path) -> None:
+    firmware = make_firmware()
+    compressed = bytearray(ota_compress.compress_ota_file(make_ota_file(firmware)))
+    # A literal in the middle of the LZ4 block, the CRC catches it at the end
+    compressed[len(compressed) // 2] ^= 0x01
+
+    with SwitchCore() as core:
+        core.create(CONFIG, nvm_dir=str(tmp_path))
+        core.ota_serve(bytes(compressed))
+        core.advance(download_time_ms(compressed))
+
+        [(status, _)] = ota_results(core)
+        assert status != 0
+        assert core.read_ota_slot(0, SECTOR_SIZE) == b"\xff" * SECTOR_SIZE
+
+
+def completed_at(core: SwitchCore) -> int:
+    [t] = [int(e.payload["t"]) for e in core.events if e.kind == "ota_complete"]
+    return t
+
+
+def interrupted_download(core: SwitchCore, file: bytes, tmp_path) -> None:
+    """Boots, downloads about half of file and reboots."""
+    core.create(CONFIG, nvm_dir=str(tmp_path))
+    core.ota_serve(file)
+    core.advance(download_time_ms(file) // 2)
+    assert ota_results(core) == []
+
+
+def test_interrupted_download_resumes_after_reboot(tmp_path) -> None:
+    firmware = make_firmware()
+    plain = make_ota_file(firmware)
+
+    with SwitchCore() as core:
+        interrupted_download(core, plain, tmp_path)
+        core.reset(CONFIG, keep_nvm=True)
+        rebooted_at = core.millis()
+        core.advance(download_time_ms(plain))
+
+        assert ota_results(core) == [(0, len(firmware))]
+        # Only the second half was downloaded again
+        assert completed_at(core) - rebooted_at < download_time_ms(plain) * 3 // 4
+        assert core.read_ota_slot(0, len(firmware)) == firmware
+
+
+def test_partial_download_without_record_starts_over(tmp_path) -> None:
+    firmware = make_firmware()
+    plain = make_ota_file(firmware)
+
+    with SwitchCore() as core:
+        interrupted_download(core, plain, tmp_path)
+        core.reset(CONFIG, keep_nvm=False)  # The record goes with the NVM
+        rebooted_at = core.millis()
+        core.advance(download_time_ms(plain))
+
+        assert ota_results(core) == [(0, len(firmware))]
+        assert completed_at(core) - rebooted_at >= download_time_ms(plain) - 100
+        assert core.read_ota_slot(0, len(firmware)) == firmware
+
+
+def test_partial_download_of_another_image_is_dropped(tmp_path) -> None:
+    old = make_firmware()
+    new = edit_firmware(old)
+    new_file = make_ota_file(new, 0x01020305)
+
+    with SwitchCore() as core:
+        interrupted_download(core, make_ota_file(old), tmp_path)
+        core.reset(CONFIG, keep_nvm=True)
+        core.ota_serve(new_file)
+        core.advance(download_time_ms(new_file))
+
+        assert ota_results(core) == [(0, len(new))]
+        assert core.read_ota_slot(0, len(new)) == new
+
+
+def test_index_records_both_sizes(tmp_path) -> None:
+    firmware = make_firmware()
+    plain = make_ota_file(firmware)
+    compressed = ota_compress.compress_ota_file(plain)
+    path = Path(tmp_path) / "image.zigbee"
+
+    path.write_bytes(compressed)
+    entry = make_z2m_ota_index.make_ota_index_entry(path, "http://x", None)
+    assert entry["fileSize"] == len(compressed)
+    assert entry["uncompressedSize"] == len(firmware)
+    assert ota_compress.upgrade_image(compressed) == firmware
+
+    path.write_bytes(plain)
+    entry = make_z2m_ota_index.make_ota_index_entry(path, "http://x", None)
+    assert "uncompressedSize" not in entry
+
+
+def test_delta_image_patches_the_running_firmware(tmp_path) -> None:
+    old = make_firmware()
+    new = edit_firmware(old)
+    delta = ota_delta.make_delta_ota_file(
+        make_ota_file(old), make_ota_file(new, 0x01020305)
+    )
+    assert len(delta) < len(new) // 10
+
+    with SwitchCore() as core:
+        core.create(CONFIG, nvm_dir=str(tmp_path))
+        core.ota_set_running_image(old)
+        core.ota_serve(delta)
+        core.advance(download_time_ms(delta))
+
+        assert ota_results(core) == [(0, len(new))]
+        assert core.read_ota_slot(0, len(new)) == new
+
+
+def test_delta_image_for_another_firmware_is_refused(tmp_path) -> None:
+    old = make_firmware()
+    new = edit_firmware(old)
+    delta = ota_delta.make_delta_ota_file(make_ota_file(old), make_ota_file(new))
+    running = bytearray(old)
+    running[len(running) // 2] ^= 0x01
+
+    with SwitchCore() as core:
+        core.create(CONFIG, nvm_dir=str(tmp_path))
+        core.ota_set_running_image(bytes(running))
+        core.ota_serve(delta)
+        core.advance(download_time_ms(delta))
+
+        [(status, _)] = ota_results(core)
+        assert status != 0
+        # Refused once the base is hashed, nothing left that could boot
+        assert core.read_ota_slot(0, SECTOR_SIZE) == b"\xff" * SECTOR_SIZE
+
+
+def test_index_limits_delta_to_its_base_version(tmp_path) -> None:
+    old = make_firmware()
+    new = edit_firmware(old)
+    delta = ota_delta.make_delta_ota_file(
+        make_ota_file(old, 0x01020304), make_ota_file(new, 0x01020305)
+    )
+    path = Path(tmp_path) / "image.zigbee"
+    path.write_bytes(delta)
+
+    entry = make_z2m_ota_index.make_ota_index_entry(path, "http://x", None)
+    assert entry["fileVersion"] == 0x01020305
+    assert entry["minFileVersion"] == entry["maxFileVersion"] == 0x01020304
+    assert entry["uncompressedSize"] == len(new)
@@ -0,0 +1,238 @@
+"""Performance regression suite.
+
+Every scenario measures a few metrics and compares them with the checked-in
+maxima in perf_budgets.json. Latencies, task slots and NVM writes are counted
+in virtual time and are exact, so their budgets are the current values: a
+change that makes them worse fails here with a table of what went over.
+Host CPU time (cpu_ms) is real time spent by the stub process and only
+catches gross regressions, its budgets are generous.
+"""
+
+import json
+from pathlib import Path
+
+import pytest
+
+from tests.client import Event, StubProc
+from tests.conftest import DEBOUNCE_MS, Device
+from tests.zcl_consts import (
+    ZCL_ATTR_MULTISTATE_INPUT_PRESENT_VALUE,
+    ZCL_ATTR_ONOFF_CONFIGURATION_SWITCH_LONG_PRESS_DUR,
+    ZCL_ATTR_START_UP_ONOFF,
+    ZCL_CLUSTER_MULTISTATE_INPUT_BASIC,
+    ZCL_CLUSTER_ON_OFF,
+    ZCL_CLUSTER_ON_OFF_SWITCH_CONFIG,
+    ZCL_CMD_ONOFF_ON,
+    ZCL_ONOFF_CONFIGURATION_SWITCH_TYPE_MOMENTARY,
+)
+
+BUDGETS_FILE = Path(__file__).with_name("perf_budgets.json")
+
+SWITCH_CONFIG = "Perf;Switch;SA0u;RB0;"
+SWITCH_PIN = 0  # A0
+RELAY_PIN = 16  # B0
+LATCHING_PINS = [("B0", "C0"), ("B1", "C1"), ("B2", "C2"), ("B3", "A3")]
+LONG_PRESS_MS = 800
+# STARTUP_REPORT_WINDOW_MS of src/zigbee/startup_traffic.h, the announce and
+# state reports after boot are not part of any scenario
+STARTUP_WINDOW_MS = 10000
+
+
+def load_budgets() -> dict[str, dict[str, float]]:
+    with BUDGETS_FILE.open() as f:
+        return json.load(f)
+
+
+def budget_diff(scenario: str, measured: dict[str, float]) -> str | None:
+    """Compares a scenario with its budgets, returns a readable diff if over."""
+    budgets = load_budgets().get(scenario)
+    if budgets is None:
+        return f"No budgets for scenario '{scenario}' in {BUDGETS_FILE.name}"
+
+    rows = []
+    for metric in sorted(set(budgets) | set(measured)):
+        budget = budgets.get(metric)
+        value = measured.get(metric)
+        if budget is None:
+            rows.append((metric, "-", value, "no budget"))
+        elif value is None:
+            rows.append((metric, budget, "-", "not measured"))
+        elif value > budget:
+            rows.append((metric, budget, value, f"+{value - budget:g}"))
+    if not rows:
+        return None
+
+    lines = [
+        f"Performance budget exceeded for '{scenario}':",
+        f"  {'metric':<20} {'budget':>10} {'measured':>10}  over",
+    ]
+    for metric, budget, value, over in rows:
+        lines.append(f"  {metric:<20} {budget!s:>10} {value!s:>10}  {over}")
+    lines.append(f"Budgets live in tests/{BUDGETS_FILE.name}")
+    return "\n".join(lines)
+
+
+def check_budget(scenario: str, measured: dict[str, float]) -> None:
+    diff = budget_diff(scenario, measured)
+    if diff:
+        pytest.fail(diff, pytrace=False)
+
+
+class Scenario:
+    """Collects the stub usage counters and events of one measured window."""
+
+    def __init__(self, device: Device) -> None:
+        self.device = device
+
+    def __enter__(self) -> "Scenario":
+        self.device.step_time(STARTUP_WINDOW_MS)
+        res = self.device.p.exec("stats reset")
+        assert res.ok, f"Stats reset failed: {res.payload}"
+        self.device.clear_events()
+        self.start = self.now()
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback) -> None:
+        res = self.device.p.exec("stats")
+        assert res.ok, f"Stats failed: {res.payload}"
+        self.stats = res.payload
+
+    def now(self) -> int:
+        return int(self.device.status()["uptime_ms"])
+
+    def events(self, kind: str) -> list[Event]:
+        return [e for e in self.device._events if e.kind == kind]
+
+    def usage(self) -> dict[str, float]:
+        return {
+            "tasks_peak": int(self.stats["tasks_peak"]),
+            "timers_peak": int(self.stats["timers_peak"]),
+            "nvm_writes": int(self.stats["nvm_writes"]),
+            "cpu_ms": round(int(self.stats["cpu_us"]) / 1000, 1),
+        }
+
+
+def gpio_times(events: list[Event], pin: int, value: int) -> list[int]:
+    return [
+        int(e.payload["t"])
+        for e in events
+        if int(e.payload["pin"]) == pin and int(e.payload["value"]) == value
+    ]
+
+
+def _parse_pin(pin: str) -> int:
+    return (ord(pin[0]) - ord("A")) * 16 + int(pin[1:])
+
+
+def test_budget_diff_lists_metrics_over_budget():
+    budgets = load_budgets()["button_to_relay"]
+    measured = dict(budgets, latency_ms=budgets["latency_ms"] + 5)
+
+    diff = budget_diff("button_to_relay", measured)
+
+    assert diff is not None
+    assert "latency_ms" in diff and "+5" in diff
+    assert "nvm_writes" not in diff
+    assert budget_diff("button_to_relay", budgets) is None
+
+
+def test_button_to_relay_latency(tmp_path):
+    with StubProc(device_config=SWITCH_CONFIG, nvm_dir=str(tmp_path)) as proc:
+        device = Device(proc)
+        with Scenario(device) as s:
+            for value in (0, 1, 0, 1):
+                device.set_gpio("A0", value)
+                device.step_time(200)
+
+    relay = [e for e in s.events("gpio") if int(e.payload["pin"]) == RELAY_PIN]
+    assert len(relay) == 4, "Every edge should toggle the relay"
+    edges = [s.start + i * 200 for i in range(4)]
+    latency = max(int(e.payload["t"]) - t for e, t in zip(relay, edges))
+
+    check_budget("button_to_relay", {"latency_ms": latency, **s.usage()})
+
+
+def test_long_press_accuracy(tmp_path):
+    with StubProc(device_config=SWITCH_CONFIG, nvm_dir=str(tmp_path)) as proc:
+        device = Device(proc)
+        device.zcl_switch_mode_set(1, ZCL_ONOFF_CONFIGURATION_SWITCH_TYPE_MOMENTARY)
+        device.write_zigbee_attr(
+            1,
+            ZCL_CLUSTER_ON_OFF_SWITCH_CONFIG,
+            ZCL_ATTR_ONOFF_CONFIGURATION_SWITCH_LONG_PRESS_DUR,
+            LONG_PRESS_MS,
+        )
+        with Scenario(device) as s:
+            device.set_gpio("A0", 0)
+            device.step_time(LONG_PRESS_MS + 200)
+            device.set_gpio("A0", 1)
+            device.step_time(DEBOUNCE_MS + 10)
+
+    reports = [
+        int(e.payload["t"])
+        for e in s.events("zcl_attr_change")
+        if int(e.payload["cluster"], 16) == ZCL_CLUSTER_MULTISTATE_INPUT_BASIC
+        and int(e.payload["attr"], 16) == ZCL_ATTR_MULTISTATE_INPUT_PRESENT_VALUE
+    ]
+    # press, long press, release
+    assert len(reports) == 3, f"Unexpected multistate reports: {reports}"
+    # Long press needs strictly more than the duration
+    error = abs(reports[1] - (s.start + LONG_PRESS_MS + 1))
+
+    check_budget("long_press", {"error_ms": error, **s.usage()})
+
+
+@pytest.mark.parametrize("simultaneous", [False, True], ids=["serial", "slp"])
+def test_latching_pulses_complete(tmp_path, simultaneous: bool):
+    relays = "".join(f"R{on}{off};" for on, off in LATCHING_PINS)
+    config = f"Perf;Latching;{'SLP;' if simultaneous else ''}{relays}"
+
+    with StubProc(device_config=config, nvm_dir=str(tmp_path)) as proc:
+        device = Device(proc)
+        with Scenario(device) as s:
+            proc.exec_batch(
+                [
+                    f"zcl_cmd {ep} 0x{ZCL_CLUSTER_ON_OFF:04X} "
+                    f"0x{ZCL_CMD_ONOFF_ON:02X}"
+                    for ep in range(1, len(LATCHING_PINS) + 1)
+                ]
+            )
+            device.step_time(2000)
+
+    gpio = s.events("gpio")
+    ends = []
+    for on_pin, _ in LATCHING_PINS:
+        pin = _parse_pin(on_pin)
+        assert gpio_times(gpio, pin, 1), f"No pulse on {on_pin}"
+        ends.append(gpio_times(gpio, pin, 0)[-1])
+    completion = max(ends) - s.start
+
+    scenario = "latching_slp" if simultaneous else "latching_serial"
+    check_budget(scenario, {"completion_ms": completion, **s.usage()})
+
+
+def test_relay_toggles_nvm_writes(tmp_path):
+    with StubProc(device_config=SWITCH_CONFIG, nvm_dir=str(tmp_path)) as proc:
+        device = Device(proc)
+        # Restoring the previous state persists every change
+        device.write_zigbee_attr(2, ZCL_CLUSTER_ON_OFF, ZCL_ATTR_START_UP_ONOFF, 0xFF)
+        with Scenario(device) as s:
+            for _ in range(10):
+                device.click_button("A0")
+
+    assert len(gpio_times(s.events("gpio"), RELAY_PIN, 1)) == 10
+    check_budget("relay_toggles_persisted", s.usage())
+
+
+def test_boot(tmp_path):
+    with StubProc(device_config=SWITCH_CONFIG, nvm_dir=str(tmp_path)) as proc:
+        res = proc.exec("stats")
+        assert res.ok
+
+    check_budget(
+        "boot",
+        {
+            "nvm_writes": int(res.payload["nvm_writes"]),
+            "cpu_ms": round(int(res.payload["cpu_us"]) / 1000, 1),
+        },
+    )
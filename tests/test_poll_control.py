@@ -0,0 +1,107 @@
+from tests.switchcore import SwitchCore
+from tests.zcl_consts import (
+    ZCL_ATTR_BASIC_POLL_FAST_TIMEOUT,
+    ZCL_ATTR_BASIC_POLL_LONG_INTERVAL,
+    ZCL_ATTR_BASIC_POLL_SHORT_INTERVAL,
+    ZCL_CLUSTER_BASIC,
+    ZCL_CLUSTER_ON_OFF,
+    ZCL_CMD_ONOFF_ON,
+)
+
+# POLL_CONTROL_* defaults of src/zigbee/poll_control.h
+SHORT_INTERVAL_MS = 250
+# The long interval defaults to the short one, backoff is opt-in
+LONG_INTERVAL_MS = 2000
+FAST_TIMEOUT_MS = 10000
+BACKOFF_STEP_MS = 5000
+MIN_INTERVAL_MS = 50
+
+CONFIG = "A;B;SA0u;RB0;"
+
+
+def intervals(core: SwitchCore) -> list[tuple[int, int]]:
+    return [
+        (int(e.payload["t"]), int(e.payload["ms"]))
+        for e in core.events
+        if e.kind == "poll_interval"
+    ]
+
+
+def create(core: SwitchCore, tmp_path) -> None:
+    """Creates the device with the backoff opted in."""
+    core.create(CONFIG, nvm_dir=str(tmp_path))
+    core.write_attr(
+        1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_POLL_LONG_INTERVAL, LONG_INTERVAL_MS
+    )
+    core.events.clear()
+
+
+def settle(core: SwitchCore) -> int:
+    """Lets the device back off to the long interval, returns the time."""
+    core.advance(FAST_TIMEOUT_MS + 4 * BACKOFF_STEP_MS)
+    core.events.clear()
+    return core.millis()
+
+
+def test_keeps_short_interval_by_default(tmp_path) -> None:
+    with SwitchCore() as core:
+        core.create(CONFIG, nvm_dir=str(tmp_path))
+        core.events.clear()
+        core.advance(FAST_TIMEOUT_MS + 4 * BACKOFF_STEP_MS)
+
+        assert intervals(core) == []
+        assert (
+            int(core.read_attr(1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_POLL_LONG_INTERVAL))
+            == SHORT_INTERVAL_MS
+        )
+
+
+def test_backs_off_to_long_interval(tmp_path) -> None:
+    with SwitchCore() as core:
+        create(core, tmp_path)
+        start = core.millis()  # The write restarts the backoff
+        core.advance(FAST_TIMEOUT_MS + 4 * BACKOFF_STEP_MS)
+        seen = [(t - start, ms) for t, ms in intervals(core)]
+
+    assert seen == [
+        (FAST_TIMEOUT_MS, 2 * SHORT_INTERVAL_MS),
+        (FAST_TIMEOUT_MS + BACKOFF_STEP_MS, 4 * SHORT_INTERVAL_MS),
+        (FAST_TIMEOUT_MS + 2 * BACKOFF_STEP_MS, LONG_INTERVAL_MS),
+    ]
+
+
+def test_incoming_command_restarts_fast_polling(tmp_path) -> None:
+    with SwitchCore() as core:
+        create(core, tmp_path)
+        now = settle(core)
+        core.zcl_cmd(2, ZCL_CLUSTER_ON_OFF, ZCL_CMD_ONOFF_ON)
+
+        assert intervals(core) == [(now, SHORT_INTERVAL_MS)]
+
+
+def test_button_press_restarts_fast_polling(tmp_path) -> None:
+    with SwitchCore() as core:
+        create(core, tmp_path)
+        settle(core)
+        core.set_gpio(0, 0)  # A0 is pin 0, pulled up
+        core.advance(100)
+
+        assert [ms for _, ms in intervals(core)] == [SHORT_INTERVAL_MS]
+
+
+def test_bounds_are_clamped_and_persisted(tmp_path) -> None:
+    with SwitchCore() as core:
+        core.create(CONFIG, nvm_dir=str(tmp_path))
+        core.write_attr(1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_POLL_SHORT_INTERVAL, 10)
+        core.write_attr(1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_POLL_LONG_INTERVAL, 20)
+        core.write_attr(1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_POLL_FAST_TIMEOUT, 0)
+        assert intervals(core)[-1][1] == MIN_INTERVAL_MS
+
+        core.reset(CONFIG, keep_nvm=True)
+
+        def read(attr: int) -> int:
+            return int(core.read_attr(1, ZCL_CLUSTER_BASIC, attr))
+
+        assert read(ZCL_ATTR_BASIC_POLL_SHORT_INTERVAL) == MIN_INTERVAL_MS
+        assert read(ZCL_ATTR_BASIC_POLL_LONG_INTERVAL) == MIN_INTERVAL_MS
+        assert read(ZCL_ATTR_BASIC_POLL_FAST_TIMEOUT) == 0
@@ -3,7 +3,7 @@ from typing import Iterator
 import pytest
 
 from tests.client import StubProc
-from tests.conftest import Device, RelayButtonPair
+from tests.conftest import Device, RelayButtonPair, StubPool
 from tests.test_network_join import (
     HAL_ZIGBEE_NETWORK_JOINED,
     HAL_ZIGBEE_NETWORK_NOT_JOINED,
@@ -78,10 +78,10 @@ def test_relay_toggle_commands(
 
 
 @pytest.fixture()
-def indicator_device() -> Iterator[Device]:
+def indicator_device(stub_pool: StubPool) -> Iterator[Device]:
     cfg = "X;Y;SA0u;RB0;IA1;"  # One switch, one relay, indicator LED on pin A1
-    with StubProc(device_config=cfg) as proc:
-        yield Device(proc)
+    yield Device(stub_pool.get(cfg))
+    stub_pool.release()
 
 
 def test_indicator_mode_same(indicator_device: Device) -> None:
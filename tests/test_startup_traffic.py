@@ -0,0 +1,89 @@
+from tests.switchcore import SwitchCore
+from tests.test_network_join import (
+    BOOT_ANNOUNCE_WINDOW_MS,
+    HAL_ZIGBEE_NETWORK_JOINED,
+    STARTUP_REPORT_WINDOW_MS,
+)
+from tests.zcl_consts import (
+    ZCL_ATTR_ONOFF,
+    ZCL_ATTR_ONOFF_INDICATOR_STATE,
+    ZCL_CLUSTER_ON_OFF,
+)
+
+FOUR_RELAYS = "A;B;RB0;RB1;RC0;RC1;"
+
+
+def event_times(core: SwitchCore, kind: str) -> list[int]:
+    return [int(e.payload["t"]) for e in core.events if e.kind == kind]
+
+
+def reports(core: SwitchCore) -> list[tuple[int, int, list[int]]]:
+    return [
+        (
+            int(e.payload["t"]),
+            int(e.payload["ep"]),
+            [int(a, 16) for a in e.payload["attrs"].split(",")],
+        )
+        for e in core.events
+        if e.kind == "zcl_report"
+        and int(e.payload["cluster"], 16) == ZCL_CLUSTER_ON_OFF
+    ]
+
+
+def boot(core: SwitchCore, tmp_path, ieee: int, config: str = FOUR_RELAYS):
+    core.set_ieee_address(ieee)
+    core.create(config, nvm_dir=str(tmp_path))
+    core.advance(STARTUP_REPORT_WINDOW_MS)
+
+
+def test_boot_announce_is_delayed_per_device(tmp_path) -> None:
+    delays = set()
+    for i in range(4):
+        with SwitchCore() as core:
+            boot(core, tmp_path, 0xA4C1380000000000 + i)
+            announces = event_times(core, "zdo_announce")
+            assert len(announces) == 1
+            delays.add(announces[0])
+
+    assert all(0 <= d < BOOT_ANNOUNCE_WINDOW_MS for d in delays)
+    assert len(delays) > 1
+
+
+def test_state_reports_spread_over_window(tmp_path) -> None:
+    with SwitchCore() as core:
+        boot(core, tmp_path, 0xA4C1380000000001)
+        sent = reports(core)
+
+    slot = STARTUP_REPORT_WINDOW_MS // 4
+    assert [ep for _, ep, _ in sent] == [1, 2, 3, 4]
+    for i, (t, _, attrs) in enumerate(sent):
+        assert i * slot <= t < (i + 1) * slot
+        assert attrs == [ZCL_ATTR_ONOFF]
+
+
+def test_state_report_merges_indicator_state(tmp_path) -> None:
+    with SwitchCore() as core:
+        boot(core, tmp_path, 0xA4C1380000000001, "A;B;RB0;IB1;")
+        sent = reports(core)
+
+    assert len(sent) == 1
+    assert sent[0][2] == [ZCL_ATTR_ONOFF, ZCL_ATTR_ONOFF_INDICATOR_STATE]
+
+
+def test_shaping_starts_on_join(tmp_path) -> None:
+    with SwitchCore() as core:
+        core.create(FOUR_RELAYS, nvm_dir=str(tmp_path), joined=False)
+        core.advance(STARTUP_REPORT_WINDOW_MS)
+        assert reports(core) == []
+        assert event_times(core, "zdo_announce") == []
+
+        joined_at = core.millis()
+        core.set_network(HAL_ZIGBEE_NETWORK_JOINED)
+        core.advance(STARTUP_REPORT_WINDOW_MS)
+
+        times = [t for t, _, _ in reports(core)]
+        assert len(times) == 4
+        assert all(t - joined_at < STARTUP_REPORT_WINDOW_MS for t in times)
+        announces = event_times(core, "zdo_announce")
+        assert len(announces) == 1
+        assert announces[0] - joined_at < BOOT_ANNOUNCE_WINDOW_MS
@@ -0,0 +1,71 @@
+import pytest
+
+from tests.client import StubProc
+
+CONFIG = "A;B;SA0u;RB0;"
+
+
+@pytest.fixture()
+def proc(tmp_path):
+    with StubProc(device_config=CONFIG, nvm_dir=str(tmp_path), log_ring=64) as proc:
+        yield proc
+
+
+def test_category_level_overrides_default(proc: StubProc):
+    assert proc.exec("log level warn").ok
+    assert proc.exec("log level trace GPIO").ok
+    proc.exec("log clear")
+
+    proc.exec("set_pin 0 0")
+    proc.exec("step_time 100")
+    log = proc.dump_log()
+
+    assert "[GPIO] Read pin 0 = 0" in log
+    assert "[TASKS]" not in log
+    assert "[FW]" not in log
+    assert proc.exec("log").payload["level"] == "warn"
+
+
+def test_firmware_printf_is_logged(proc: StubProc):
+    proc.exec("log level info")
+    proc.exec("log clear")
+
+    proc.exec("set_pin 0 0")
+    proc.exec("step_time 100")
+
+    assert "[FW] Press detected" in proc.dump_log().splitlines()
+
+
+def test_ring_keeps_last_lines(proc: StubProc):
+    proc.exec("log level trace")
+    assert proc.exec("log ring 3").ok
+
+    proc.exec("set_pin 0 0")
+    proc.exec("step_time 100")
+    assert proc.exec("log").payload["captured"] == "3"
+
+    lines = proc.dump_log().splitlines()
+    assert len(lines) == 4  # Three lines and the end marker
+    assert lines[-1] == "[LOG] 3 lines dumped"
+    assert proc.dump_log() == "[LOG] 0 lines dumped"
+
+
+def test_log_dumped_when_assertion_fails(tmp_path, capsys):
+    with pytest.raises(AssertionError):
+        with StubProc(device_config=CONFIG, nvm_dir=str(tmp_path)) as proc:
+            proc.exec("set_pin 0 0")
+            proc.exec("step_time 100")
+            assert False
+    err = capsys.readouterr().err
+    assert "[FW] Press detected" in err
+
+    with StubProc(device_config=CONFIG, nvm_dir=str(tmp_path)) as proc:
+        proc.exec("set_pin 0 0")
+        proc.exec("step_time 100")
+    assert "[FW] Press detected" not in capsys.readouterr().err
+
+
+def test_bad_log_arguments(proc: StubProc):
+    assert proc.exec("log level loud").payload == {"bad_level": "loud"}
+    assert not proc.exec("log ring 100000").ok
+    assert not proc.exec("log rotate").ok
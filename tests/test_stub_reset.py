@@ -0,0 +1,104 @@
+from typing import Callable
+
+from tests.client import StubProc
+from tests.conftest import DEBOUNCE_MS, Device
+from tests.zcl_consts import (
+    ZCL_ATTR_ONOFF,
+    ZCL_ATTR_START_UP_ONOFF,
+    ZCL_CLUSTER_ON_OFF,
+    ZCL_CMD_ONOFF_ON,
+    ZCL_ONOFF_CONFIGURATION_SWITCH_TYPE_MOMENTARY,
+)
+
+CONFIG = "A;B;SA0u;RB0;"
+LATCHING_CONFIG = "A;B;RB0C0;RB1C1;"
+
+
+def _timeline(proc: StubProc, scenario: Callable[[Device], None]) -> list[tuple]:
+    device = Device(proc)
+    scenario(device)
+    return [(e.kind, sorted(e.payload.items())) for e in device._events]
+
+
+def _fresh_timeline(tmp_path, config: str, scenario) -> list[tuple]:
+    with StubProc(device_config=config, nvm_dir=str(tmp_path / "fresh")) as proc:
+        return _timeline(proc, scenario)
+
+
+def _click_twice(device: Device) -> None:
+    device.step_time(10)
+    device.click_button("A0")
+    device.click_button("A0")
+    device.status()
+
+
+def _dirty(device: Device) -> None:
+    device.zcl_switch_mode_set(1, ZCL_ONOFF_CONFIGURATION_SWITCH_TYPE_MOMENTARY)
+    device.zcl_relay_on(2)
+    device.set_gpio("A0", 0)  # Left pressed, debounce still pending
+    device.step_time(20)
+
+
+def test_reset_matches_fresh_process(tmp_path):
+    with StubProc(device_config=CONFIG, nvm_dir=str(tmp_path / "reused")) as proc:
+        _dirty(Device(proc))
+        proc.reset(CONFIG)
+        reused = _timeline(proc, _click_twice)
+
+    assert reused == _fresh_timeline(tmp_path, CONFIG, _click_twice)
+
+
+def test_reset_to_other_config(tmp_path):
+    with StubProc(device_config=LATCHING_CONFIG, nvm_dir=str(tmp_path)) as proc:
+        proc.reset(CONFIG)
+        device = Device(proc)
+
+        assert device.read_zigbee_attr(2, ZCL_CLUSTER_ON_OFF, ZCL_ATTR_ONOFF) == "0"
+        assert not proc.exec("zcl_read 3 0x0006 0x0000").ok
+
+
+def test_reset_during_latching_pulse(tmp_path):
+    def switch_both_on(device: Device) -> None:
+        device.zcl_relay_on(1)
+        device.zcl_relay_on(2)
+        device.step_time(500)
+
+    with StubProc(device_config=LATCHING_CONFIG, nvm_dir=str(tmp_path)) as proc:
+        device = Device(proc)
+        device.call_zigbee_cmd(1, ZCL_CLUSTER_ON_OFF, ZCL_CMD_ONOFF_ON)
+        device.step_time(DEBOUNCE_MS)  # Pulse of the first relay still running
+        proc.reset(LATCHING_CONFIG)
+        reused = _timeline(proc, switch_both_on)
+
+    assert reused == _fresh_timeline(tmp_path, LATCHING_CONFIG, switch_both_on)
+
+
+def test_reset_keeps_nvm_only_when_asked(tmp_path):
+    with StubProc(device_config=CONFIG, nvm_dir=str(tmp_path)) as proc:
+        device = Device(proc)
+        device.write_zigbee_attr(2, ZCL_CLUSTER_ON_OFF, ZCL_ATTR_START_UP_ONOFF, 0xFF)
+        device.zcl_relay_on(2)
+
+        proc.reset(keep_nvm=True)
+        assert Device(proc).zcl_relay_get(2) == "1"
+
+        proc.reset()
+        # Wiped NVM, the stub default config with its second relay on ep 6
+        assert Device(proc).zcl_relay_get(6) == "0"
+        assert proc.exec("stats").payload["nvm_writes"] != "0"
+
+
+def test_reset_restarts_clock_and_network(tmp_path):
+    with StubProc(device_config=CONFIG, nvm_dir=str(tmp_path)) as proc:
+        device = Device(proc)
+        device.step_time(1000)
+        device.set_network(0)
+
+        proc.reset(CONFIG, joined=False)
+        status = Device(proc).status()
+
+    with StubProc(
+        device_config=CONFIG, joined=False, nvm_dir=str(tmp_path / "fresh")
+    ) as proc:
+        assert status == Device(proc).status()
+    assert status["uptime_ms"] == "0"
@@ -0,0 +1,89 @@
+from typing import Iterator
+
+import pytest
+
+from tests.client import StubProc
+from tests.conftest import DEBOUNCE_MS, Device
+from tests.switchcore import SwitchCore
+from tests.zcl_consts import (
+    ZCL_ATTR_BASIC_DEVICE_CONFIG,
+    ZCL_ATTR_ONOFF,
+    ZCL_ATTR_START_UP_ONOFF,
+    ZCL_CLUSTER_BASIC,
+    ZCL_CLUSTER_ON_OFF,
+    ZCL_CMD_ONOFF_ON,
+)
+
+CONFIG = "A;B;SA0u;RB0;"
+SWITCH_PIN = 0  # A0
+RELAY_PIN = 16  # B0
+
+
+@pytest.fixture()
+def core(tmp_path) -> Iterator[SwitchCore]:
+    with SwitchCore() as core:
+        yield core.create(CONFIG, nvm_dir=str(tmp_path))
+
+
+def _gpio(core: SwitchCore, pin: int) -> list[tuple[int, int]]:
+    return [
+        (int(e.payload["t"]), int(e.payload["value"]))
+        for e in core.events
+        if e.kind == "gpio" and int(e.payload["pin"]) == pin
+    ]
+
+
+def test_button_edge_toggles_relay(core: SwitchCore):
+    core.set_gpio(SWITCH_PIN, 0)
+    core.advance(100)
+
+    assert _gpio(core, RELAY_PIN) == [(DEBOUNCE_MS, 1)]
+    assert core.get_gpio(RELAY_PIN) == 1
+    assert core.read_attr(2, ZCL_CLUSTER_ON_OFF, ZCL_ATTR_ONOFF) == "1"
+    assert core.millis() == 100
+
+
+def test_zcl_command(core: SwitchCore):
+    core.zcl_cmd(2, ZCL_CLUSTER_ON_OFF, ZCL_CMD_ONOFF_ON)
+
+    assert _gpio(core, RELAY_PIN) == [(0, 1)]
+
+
+def test_same_timeline_as_stub_process(core: SwitchCore, tmp_path):
+    def scenario(set_gpio, advance):
+        for value in (0, 1, 0):
+            set_gpio(value)
+            advance(70)
+
+    scenario(lambda v: core.set_gpio(SWITCH_PIN, v), core.advance)
+    lib = [(e.kind, e.payload) for e in core.events]
+
+    with StubProc(device_config=CONFIG, nvm_dir=str(tmp_path / "proc")) as proc:
+        device = Device(proc)
+        scenario(lambda v: device.set_gpio("A0", v), device.step_time)
+        stub = [(e.kind, e.payload) for e in device._events]
+
+    assert lib == stub
+
+
+def test_firmware_reboot_restarts_in_place(core: SwitchCore):
+    # A different endpoint layout is applied with a reboot
+    core.write_attr(
+        1, ZCL_CLUSTER_BASIC, ZCL_ATTR_BASIC_DEVICE_CONFIG, "A;B;SA0u;RB0;RB1;"
+    )
+
+    assert core.advance(3000) == 1
+    assert [e.kind for e in core.events].count("reboot") == 1
+    assert core.read_attr(3, ZCL_CLUSTER_ON_OFF, ZCL_ATTR_ONOFF) == "0"
+
+
+def test_reset_wipes_nvm_unless_kept(core: SwitchCore):
+    core.write_attr(2, ZCL_CLUSTER_ON_OFF, ZCL_ATTR_START_UP_ONOFF, 0xFF)
+    core.zcl_cmd(2, ZCL_CLUSTER_ON_OFF, ZCL_CMD_ONOFF_ON)
+
+    core.reset(CONFIG, keep_nvm=True)
+    assert core.get_gpio(RELAY_PIN) == 1
+
+    core.reset(CONFIG)
+    assert core.get_gpio(RELAY_PIN) == 0
+    assert core.millis() == 0
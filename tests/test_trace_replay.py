@@ -0,0 +1,120 @@
+import subprocess
+
+from tests.client import Event, StubProc
+from tests.conftest import DEBOUNCE_MS, Device
+from tests.zcl_consts import (
+    ZCL_ATTR_START_UP_ONOFF,
+    ZCL_CLUSTER_ON_OFF,
+    ZCL_CMD_ONOFF_ON,
+)
+
+CONFIG = "A;B;SA0u;RB0;"
+RELAY_PIN = 16  # B0
+LONG_PRESS_MS = 2000
+
+
+def _replay(
+    device: Device, trace_path, settle_ms: int = 0
+) -> tuple[int, list[Event]]:
+    """Replays a trace, returns its start time and the resulting timeline."""
+    start = int(device.status()["uptime_ms"])
+    device.clear_events()
+    res = device.p.exec(f"replay {trace_path} {settle_ms}")
+    assert res.ok, f"Replay failed: {res.payload}"
+    return start, list(device._events)
+
+
+def _relay_changes(timeline: list[Event]) -> list[tuple[int, int]]:
+    return [
+        (int(e.payload["t"]), int(e.payload["value"]))
+        for e in timeline
+        if e.kind == "gpio" and int(e.payload["pin"]) == RELAY_PIN
+    ]
+
+
+def test_bouncing_press_toggles_relay_once(tmp_path):
+    trace = tmp_path / "bounce.trace"
+    # Contact bounce over 3 ms, several edges inside the same millisecond
+    trace.write_text(
+        "# field capture, switch A0\n"
+        "1000 gpio A0 0\n"
+        "1200 gpio A0 1\n"
+        "1700 gpio A0 0\n"
+        "2300 gpio A0 1\n"
+        "3100 gpio A0 0\n"
+    )
+
+    with StubProc(device_config=CONFIG) as proc:
+        start, timeline = _replay(Device(proc), trace, settle_ms=200)
+
+    assert _relay_changes(timeline) == [(start + 3 + DEBOUNCE_MS, 1)]
+
+
+def test_long_press_is_detected_at_configured_duration(tmp_path):
+    trace = tmp_path / "long_press.trace"
+    trace.write_text("500000 gpio A0 0\n3000000 gpio A0 1\n3100000 wait\n")
+
+    with StubProc(device_config="A;B;BA0u;") as proc:
+        start, timeline = _replay(Device(proc), trace)
+
+    leave = [e for e in timeline if e.kind == "zcl_leave_network"]
+    # On the first millisecond past the duration
+    assert [int(e.payload["t"]) for e in leave] == [start + 500 + LONG_PRESS_MS + 1]
+
+
+def test_zcl_records_and_nvm_writes_in_timeline(tmp_path):
+    trace = tmp_path / "zcl.trace"
+    trace.write_text(
+        f"10000 zcl 2 {ZCL_CLUSTER_ON_OFF:04X} {ZCL_CMD_ONOFF_ON:02X}\n"
+        "20000 gpio A0 0\n"
+    )
+
+    with StubProc(device_config=CONFIG) as proc:
+        device = Device(proc)
+        # Relay state is only persisted when restored at startup
+        device.write_zigbee_attr(
+            2, ZCL_CLUSTER_ON_OFF, ZCL_ATTR_START_UP_ONOFF, 0xFF
+        )
+        start, timeline = _replay(device, trace, settle_ms=100)
+
+    assert _relay_changes(timeline) == [
+        (start + 10, 1),
+        (start + 20 + DEBOUNCE_MS, 0),
+    ]
+    nvm_writes = [int(e.payload["t"]) for e in timeline if e.kind == "nvm_write"]
+    assert nvm_writes == [start + 10, start + 20 + DEBOUNCE_MS]
+
+
+def test_bad_record_is_reported_with_line(tmp_path):
+    trace = tmp_path / "bad.trace"
+    trace.write_text("1000 gpio A0 0\n\n500 gpio A0 1\n")
+
+    with StubProc(device_config=CONFIG) as proc:
+        res = proc.exec(f"replay {trace}")
+
+    assert not res.ok
+    assert res.payload["line"] == "3"
+
+
+def test_replay_option_prints_timeline(tmp_path):
+    trace = tmp_path / "cli.trace"
+    trace.write_text("0 gpio A0 0\n100000 wait\n")
+
+    out = subprocess.run(
+        [
+            "./build/stub/stub_device",
+            "--device-config",
+            CONFIG,
+            "--freeze-time",
+            "--nvm-dir",
+            str(tmp_path / "nvm"),
+            "--replay",
+            str(trace),
+        ],
+        capture_output=True,
+        text=True,
+        check=True,
+    ).stdout.splitlines()
+
+    assert f"EVT gpio pin={RELAY_PIN} value=1 t={DEBOUNCE_MS}" in out
+    assert "RES OK records=2 duration_ms=100" in out
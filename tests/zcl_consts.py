@@ -8,6 +8,7 @@ ZCL_CLUSTER_ON_OFF_SWITCH_CONFIG = 0x0007
 ZCL_CLUSTER_MULTISTATE_INPUT_BASIC = 0x0012
 ZCL_CLUSTER_LEVEL_CONTROL = 0x0008
 ZCL_CLUSTER_GROUPS = 0x0004
+ZCL_CLUSTER_SWITCH_DIAGNOSTICS = 0xFCA0
 
 # Attributes - Global
 ZCL_ATTR_GLOBAL_CLUSTER_REVISION = 0xFFFD
@@ -30,6 +31,9 @@ ZCL_ATTR_BASIC_SW_BUILD_ID = 0x4000
 
 ZCL_ATTR_BASIC_DEVICE_CONFIG = 0xFF00
 ZCL_ATTR_BASIC_STATUS_LED_STATE = 0xFF01
+ZCL_ATTR_BASIC_POLL_SHORT_INTERVAL = 0xFF02
+ZCL_ATTR_BASIC_POLL_LONG_INTERVAL = 0xFF03
+ZCL_ATTR_BASIC_POLL_FAST_TIMEOUT = 0xFF04
 
 # Attributes - On/Off cluster
 ZCL_ATTR_ONOFF = 0x0000
@@ -57,6 +61,21 @@ ZCL_ATTR_MULTISTATE_INPUT_STATUS_FLAGS = 0x006F
 # Attributes - Groups cluster
 ZCL_ATTR_GROUP_NAME_SUPPORT = 0x0000
 
+# Attributes - Diagnostics cluster (manufacturer specific)
+ZCL_ATTR_DIAGNOSTICS_UPTIME = 0x0000
+ZCL_ATTR_DIAGNOSTICS_RESET_REASON = 0x0001
+ZCL_ATTR_DIAGNOSTICS_BUTTON_EVENTS = 0x0002
+ZCL_ATTR_DIAGNOSTICS_RELAY_OPERATIONS = 0x0003
+ZCL_ATTR_DIAGNOSTICS_LATCHING_PULSES = 0x0004
+ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_RECEIVED = 0x0005
+ZCL_ATTR_DIAGNOSTICS_ZCL_CMDS_SENT = 0x0006
+ZCL_ATTR_DIAGNOSTICS_SEND_FAILURES = 0x0007
+ZCL_ATTR_DIAGNOSTICS_REPORTS_SENT = 0x0008
+ZCL_ATTR_DIAGNOSTICS_NVM_WRITES = 0x0009
+ZCL_ATTR_DIAGNOSTICS_TASKS_PEAK = 0x000A
+ZCL_ATTR_DIAGNOSTICS_GPIO_INTERRUPTS = 0x000B
+ZCL_ATTR_DIAGNOSTICS_BUTTON_EVENTS_EP_BASE = 0x0100
+
 # Enum values - On/Off cluster
 ZCL_START_UP_ONOFF_SET_ONOFF_TO_OFF = 0x00
 ZCL_START_UP_ONOFF_SET_ONOFF_TO_ON = 0x01
@@ -124,6 +124,57 @@ class OnOffWithIndicatorCluster(CustomCluster, OnOff):
             is_manufacturer_specific=True,
         )
 
+class ResetReason(t.enum8):
+    Unknown = 0x00
+    PowerOn = 0x01
+    Software = 0x02
+    Watchdog = 0x03
+    External = 0x04
+    Crash = 0x05
+
+
+class SwitchDiagnosticsCluster(CustomCluster):
+    """Read-only runtime counters, reset on restart."""
+
+    cluster_id: Final = 0xFCA0
+    name: Final = "Switch diagnostics"
+    ep_attribute: Final = "switch_diagnostics"
+
+    class AttributeDefs(foundation.BaseAttributeDefs):
+        uptime: Final = ZCLAttributeDef(id=0x0000, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        reset_reason: Final = ZCLAttributeDef(id=0x0001, type=ResetReason, access="r", is_manufacturer_specific=True)
+        button_events: Final = ZCLAttributeDef(id=0x0002, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        relay_operations: Final = ZCLAttributeDef(id=0x0003, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        latching_pulses: Final = ZCLAttributeDef(id=0x0004, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        zcl_commands_received: Final = ZCLAttributeDef(id=0x0005, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        zcl_commands_sent: Final = ZCLAttributeDef(id=0x0006, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        send_failures: Final = ZCLAttributeDef(id=0x0007, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        reports_sent: Final = ZCLAttributeDef(id=0x0008, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        nvm_writes: Final = ZCLAttributeDef(id=0x0009, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        tasks_peak: Final = ZCLAttributeDef(id=0x000A, type=t.uint16_t, access="r", is_manufacturer_specific=True)
+        gpio_interrupts: Final = ZCLAttributeDef(id=0x000B, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        # 0x0100 + switch endpoint
+        button_events_1: Final = ZCLAttributeDef(id=0x0101, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        button_events_2: Final = ZCLAttributeDef(id=0x0102, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        button_events_3: Final = ZCLAttributeDef(id=0x0103, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+        button_events_4: Final = ZCLAttributeDef(id=0x0104, type=t.uint32_t, access="r", is_manufacturer_specific=True)
+
+
+DIAGNOSTIC_COUNTERS = [
+    # attribute, name, unit
+    ("uptime", "Uptime", "s"),
+    ("button_events", "Button events", None),
+    ("relay_operations", "Relay operations", None),
+    ("latching_pulses", "Latching pulses", None),
+    ("zcl_commands_received", "ZCL commands received", None),
+    ("zcl_commands_sent", "ZCL commands sent", None),
+    ("send_failures", "Send failures", None),
+    ("reports_sent", "Reports sent", None),
+    ("nvm_writes", "NVM writes", None),
+    ("tasks_peak", "Tasks peak", None),
+    ("gpio_interrupts", "GPIO interrupts", None),
+]
+
 '''``````````````````````````````````````````````````````````````````
   This file (`zha_quirk.py`) is generated. 
   
@@ -263,6 +314,7 @@ CONFIGS = [
     "TS0003-IHS;TS0003-3CH-cus;BC3u;LC2i;SD7u;RD2;SB4u;RD3;SB5u;RC0;",
     "knoj8lpk;TS0004-IHS;BC3u;LC2i;SB5u;RD2;SB4u;RD3;SD7u;RC0;SD4u;RC1;",
     "TS0004-IHS;TS0004-IHS;BC3u;LC2i;SB5u;RD2;SB4u;RD3;SD7u;RC0;SD4u;RC1;",
+    "ju82pu2b;TS0003-IHS-S;LC2i;SC0u;RD2;SB4u;RD3;SB5u;RC0;",
     "tqwydnqn;TS0013-MH;SC4u;RB4A0;ID2;SD7u;RD4B5;IC3;SB7u;RC0C2;IB1;M;",
     "bmzfjnbp;TS0011-MHB;SA4u;RD1D0;IA6i;M;",
     "ugaem1nb;TS0012-MHB;SA3u;RD1D0;IB1i;SB0u;RC2A0;IA5i;M;",
@@ -461,6 +513,35 @@ for config in CONFIGS:
             )
         )
 
+    builder = (
+        builder
+        .replaces(SwitchDiagnosticsCluster, endpoint_id=1)
+        .sensor(
+            SwitchDiagnosticsCluster.AttributeDefs.reset_reason.name,
+            SwitchDiagnosticsCluster.cluster_id,
+            translation_key="reset_reason",
+            fallback_name="Reset reason",
+            endpoint_id=1,
+            entity_type=EntityType.DIAGNOSTIC,
+            device_class=SensorDeviceClass.ENUM,
+            attribute_converter=lambda x: ResetReason(x).name,
+        )
+    )
+    counters = DIAGNOSTIC_COUNTERS + [
+        ("button_events_"+str(endpoint_id), "Button events "+str(endpoint_id), None)
+        for endpoint_id in range(1, switch_cnt + 1)
+    ]
+    for attribute, fallback_name, unit in counters:
+        builder = builder.sensor(
+            attribute,
+            SwitchDiagnosticsCluster.cluster_id,
+            translation_key=attribute,
+            fallback_name=fallback_name,
+            endpoint_id=1,
+            entity_type=EntityType.DIAGNOSTIC,
+            unit=unit,
+        )
+
     if has_dedicated_net_led:
         builder = (
             builder
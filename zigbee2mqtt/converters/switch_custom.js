@@ -5,6 +5,7 @@ const {
     onOff,
     text,
     binary,
+    deviceAddCustomCluster,
 } = require("zigbee-herdsman-converters/lib/modernExtend");
 const {assertString} = require("zigbee-herdsman-converters/lib/utils");
 const reporting = require("zigbee-herdsman-converters/lib/reporting");
@@ -135,6 +136,17 @@ const romasku = {
             description: "State of the network indicator LED",
             access: "ALL",
         }),
+    pollInterval: (name, endpointName, id, type, description, valueMax) =>
+        numeric({
+            name,
+            endpointNames: [endpointName],
+            cluster: "genBasic",
+            attribute: { ID: id, type },
+            description,
+            unit: "ms",
+            valueMin: 0,
+            valueMax,
+        }),
     deviceConfig: (name, endpointName) =>
         text({
             name,
@@ -182,6 +194,50 @@ const romasku = {
                 }
             }
         }),
+    diagnosticsCluster: (switch_cnt) =>
+        deviceAddCustomCluster("manuSwitchDiagnostics", {
+            ID: 0xfca0,
+            attributes: {
+                uptime: { ID: 0x0000, type: 0x23 }, // uint32
+                resetReason: { ID: 0x0001, type: 0x30 }, // Enum8
+                buttonEvents: { ID: 0x0002, type: 0x23 },
+                relayOperations: { ID: 0x0003, type: 0x23 },
+                latchingPulses: { ID: 0x0004, type: 0x23 },
+                zclCommandsReceived: { ID: 0x0005, type: 0x23 },
+                zclCommandsSent: { ID: 0x0006, type: 0x23 },
+                sendFailures: { ID: 0x0007, type: 0x23 },
+                reportsSent: { ID: 0x0008, type: 0x23 },
+                nvmWrites: { ID: 0x0009, type: 0x23 },
+                tasksPeak: { ID: 0x000a, type: 0x21 }, // uint16
+                gpioInterrupts: { ID: 0x000b, type: 0x23 },
+                // 0x0100 + switch endpoint
+                ...Object.fromEntries(
+                    Array.from({ length: switch_cnt }, (_, i) => [`buttonEvents${i + 1}`, { ID: 0x0101 + i, type: 0x23 }])
+                ),
+            },
+            commands: {},
+            commandsResponse: {},
+        }),
+    diagnosticCounter: (name, attribute, description, unit) =>
+        numeric({
+            name,
+            access: "STATE_GET",
+            entityCategory: "diagnostic",
+            cluster: "manuSwitchDiagnostics",
+            attribute,
+            description,
+            unit,
+        }),
+    resetReason: (name) =>
+        enumLookup({
+            name,
+            access: "STATE_GET",
+            entityCategory: "diagnostic",
+            lookup: { unknown: 0, power_on: 1, software: 2, watchdog: 3, external: 4, crash: 5 },
+            cluster: "manuSwitchDiagnostics",
+            attribute: "resetReason",
+            description: "Why the device restarted last time, unknown on Telink",
+        }),
 };
 
 const definitions = [
@@ -197,6 +253,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -206,6 +265,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -258,6 +331,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -335,6 +423,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -437,6 +541,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -532,6 +653,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -584,6 +719,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -662,6 +812,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -740,6 +906,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -786,6 +966,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -840,6 +1034,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -919,6 +1128,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1023,6 +1248,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1110,6 +1352,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -1119,6 +1364,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1155,6 +1414,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -1172,6 +1434,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1224,6 +1501,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -1249,6 +1529,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1329,6 +1625,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1383,6 +1693,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1437,6 +1761,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1501,6 +1839,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1600,6 +1953,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1702,6 +2071,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1737,6 +2120,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -1748,6 +2134,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1791,6 +2191,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -1802,6 +2205,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1846,6 +2263,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -1867,6 +2287,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1936,6 +2371,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -1957,6 +2395,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2025,6 +2478,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -2046,6 +2502,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2114,6 +2585,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -2145,6 +2619,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2249,6 +2739,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2303,6 +2807,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2365,6 +2883,21 @@ const definitions = [
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
             romasku.relayIndicatorMode("relay_left_indicator_mode", "relay_left"),
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2446,6 +2979,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2539,6 +3087,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2633,6 +3197,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2702,6 +3282,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -2733,6 +3316,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2859,6 +3458,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2945,6 +3561,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -2962,6 +3581,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3023,6 +3657,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3075,6 +3723,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3136,6 +3799,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3180,6 +3857,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3233,6 +3924,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3310,6 +4016,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3380,6 +4102,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -3405,6 +4130,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3474,6 +4215,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -3483,6 +4227,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3518,6 +4276,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_0": 1, "switch_1": 2, "switch_2": 3, "switch_3": 4, "relay_0": 5, "relay_1": 6, "relay_2": 7, "relay_3": 8, } }),
             romasku.deviceConfig("device_config", "switch_0"),
             romasku.networkIndicator("network_led", "switch_0"),
+            romasku.pollInterval("poll_short_interval", "switch_0", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_0", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_0", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_0", "relay_1", "relay_2", "relay_3"] }),
             romasku.pressAction("switch_0_press_action", "switch_0"),
             romasku.switchMode("switch_0_mode", "switch_0"),
@@ -3551,6 +4312,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3637,6 +4415,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -3646,6 +4427,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3681,6 +4476,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -3698,6 +4496,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3759,6 +4572,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3820,6 +4647,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3922,6 +4765,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3997,6 +4857,116 @@ const definitions = [
         },
         ota: true,
     },
+    {
+        zigbeeModel: [
+            "TS0003-IHS-S",
+        ],
+        model: "_TZ3000_ju82pu2b",
+        vendor: "Tuya-custom",
+        description: "Custom switch (https://github.com/romasku/tuya-zigbee-switch)",
+        extend: [
+            deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
+            romasku.deviceConfig("device_config", "switch_left"),
+            romasku.networkIndicator("network_led", "switch_left"),
+            onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
+            romasku.pressAction("switch_left_press_action", "switch_left"),
+            romasku.switchMode("switch_left_mode", "switch_left"),
+            romasku.switchAction("switch_left_action_mode", "switch_left"),
+            romasku.relayMode("switch_left_relay_mode", "switch_left"),
+            romasku.relayIndex("switch_left_relay_index", "switch_left", 3),
+            romasku.bindedMode("switch_left_binded_mode", "switch_left"),
+            romasku.longPressDuration("switch_left_long_press_duration", "switch_left"),
+            romasku.levelMoveRate("switch_left_level_move_rate", "switch_left"),
+            romasku.pressAction("switch_middle_press_action", "switch_middle"),
+            romasku.switchMode("switch_middle_mode", "switch_middle"),
+            romasku.switchAction("switch_middle_action_mode", "switch_middle"),
+            romasku.relayMode("switch_middle_relay_mode", "switch_middle"),
+            romasku.relayIndex("switch_middle_relay_index", "switch_middle", 3),
+            romasku.bindedMode("switch_middle_binded_mode", "switch_middle"),
+            romasku.longPressDuration("switch_middle_long_press_duration", "switch_middle"),
+            romasku.levelMoveRate("switch_middle_level_move_rate", "switch_middle"),
+            romasku.pressAction("switch_right_press_action", "switch_right"),
+            romasku.switchMode("switch_right_mode", "switch_right"),
+            romasku.switchAction("switch_right_action_mode", "switch_right"),
+            romasku.relayMode("switch_right_relay_mode", "switch_right"),
+            romasku.relayIndex("switch_right_relay_index", "switch_right", 3),
+            romasku.bindedMode("switch_right_binded_mode", "switch_right"),
+            romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
+            romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
+        ],
+        meta: { multiEndpoint: true },
+        configure: async (device, coordinatorEndpoint, logger) => {
+            const endpoint1 = device.getEndpoint(1);
+            await reporting.bind(endpoint1, coordinatorEndpoint, ["genMultistateInput"]);
+            // switch action:
+            await endpoint1.configureReporting("genMultistateInput", [
+                {
+                    attribute: {ID: 0x0055 /* presentValue */, type: 0x21}, // uint16
+                    minimumReportInterval: 0,
+                    maximumReportInterval: constants.repInterval.MAX,
+                    reportableChange: 1,
+                },
+            ]);
+            const endpoint2 = device.getEndpoint(2);
+            await reporting.bind(endpoint2, coordinatorEndpoint, ["genMultistateInput"]);
+            // switch action:
+            await endpoint2.configureReporting("genMultistateInput", [
+                {
+                    attribute: {ID: 0x0055 /* presentValue */, type: 0x21}, // uint16
+                    minimumReportInterval: 0,
+                    maximumReportInterval: constants.repInterval.MAX,
+                    reportableChange: 1,
+                },
+            ]);
+            const endpoint3 = device.getEndpoint(3);
+            await reporting.bind(endpoint3, coordinatorEndpoint, ["genMultistateInput"]);
+            // switch action:
+            await endpoint3.configureReporting("genMultistateInput", [
+                {
+                    attribute: {ID: 0x0055 /* presentValue */, type: 0x21}, // uint16
+                    minimumReportInterval: 0,
+                    maximumReportInterval: constants.repInterval.MAX,
+                    reportableChange: 1,
+                },
+            ]);
+            const endpoint4 = device.getEndpoint(4);
+            await reporting.onOff(endpoint4, {
+                min: 0,
+                max: constants.repInterval.MAX,
+                change: 1,
+            });
+            const endpoint5 = device.getEndpoint(5);
+            await reporting.onOff(endpoint5, {
+                min: 0,
+                max: constants.repInterval.MAX,
+                change: 1,
+            });
+            const endpoint6 = device.getEndpoint(6);
+            await reporting.onOff(endpoint6, {
+                min: 0,
+                max: constants.repInterval.MAX,
+                change: 1,
+            });
+
+        },
+        ota: true,
+    },
     {
         zigbeeModel: [
             "TS0013-MH",
@@ -4007,6 +4977,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -4038,6 +5011,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4130,6 +5119,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -4141,6 +5133,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4183,6 +5189,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -4204,6 +5213,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4271,6 +5295,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -4302,6 +5329,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4428,6 +5471,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4547,6 +5607,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4633,6 +5710,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -4644,6 +5724,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4687,6 +5781,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -4708,6 +5805,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4776,6 +5888,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -4807,6 +5922,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4899,6 +6030,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_0": 1, "switch_1": 2, "switch_2": 3, "switch_3": 4, "relay_0": 5, "relay_1": 6, "relay_2": 7, "relay_3": 8, } }),
             romasku.deviceConfig("device_config", "switch_0"),
+            romasku.pollInterval("poll_short_interval", "switch_0", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_0", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_0", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_0", "relay_1", "relay_2", "relay_3"] }),
             romasku.pressAction("switch_0_press_action", "switch_0"),
             romasku.switchMode("switch_0_mode", "switch_0"),
@@ -4940,6 +6074,23 @@ const definitions = [
             romasku.relayIndicator("relay_2_indicator", "relay_2"),
             romasku.relayIndicatorMode("relay_3_indicator_mode", "relay_3"),
             romasku.relayIndicator("relay_3_indicator", "relay_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5075,6 +6226,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5151,6 +6317,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5237,6 +6419,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5298,6 +6495,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5350,6 +6561,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5402,6 +6628,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -5411,6 +6640,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5463,6 +6706,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5527,6 +6785,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5602,6 +6874,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5695,6 +6983,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -5712,6 +7003,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5773,6 +7079,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5841,6 +7161,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5936,6 +7273,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5980,6 +7331,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6024,6 +7389,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6068,6 +7447,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6112,6 +7505,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6156,6 +7563,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6208,6 +7629,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6293,6 +7729,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6379,6 +7832,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -6388,6 +7844,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6423,6 +7893,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -6432,6 +7905,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6469,6 +7956,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -6486,6 +7976,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6538,6 +8043,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -6559,6 +8067,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6638,6 +8161,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6681,6 +8218,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -6690,6 +8230,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5,6 +5,7 @@ const {
     onOff,
     text,
     binary,
+    deviceAddCustomCluster,
 } = require("zigbee-herdsman-converters/lib/modernExtend");
 const {assertString} = require("zigbee-herdsman-converters/lib/utils");
 const reporting = require("zigbee-herdsman-converters/lib/reporting");
@@ -136,6 +137,17 @@ const romasku = {
             description: "State of the network indicator LED",
             access: "ALL",
         }),
+    pollInterval: (name, endpointName, id, type, description, valueMax) =>
+        numeric({
+            name,
+            endpointNames: [endpointName],
+            cluster: "genBasic",
+            attribute: { ID: id, type },
+            description,
+            unit: "ms",
+            valueMin: 0,
+            valueMax,
+        }),
     deviceConfig: (name, endpointName) =>
         text({
             name,
@@ -183,6 +195,50 @@ const romasku = {
                 }
             }
         }),
+    diagnosticsCluster: (switch_cnt) =>
+        deviceAddCustomCluster("manuSwitchDiagnostics", {
+            ID: 0xfca0,
+            attributes: {
+                uptime: { ID: 0x0000, type: 0x23 }, // uint32
+                resetReason: { ID: 0x0001, type: 0x30 }, // Enum8
+                buttonEvents: { ID: 0x0002, type: 0x23 },
+                relayOperations: { ID: 0x0003, type: 0x23 },
+                latchingPulses: { ID: 0x0004, type: 0x23 },
+                zclCommandsReceived: { ID: 0x0005, type: 0x23 },
+                zclCommandsSent: { ID: 0x0006, type: 0x23 },
+                sendFailures: { ID: 0x0007, type: 0x23 },
+                reportsSent: { ID: 0x0008, type: 0x23 },
+                nvmWrites: { ID: 0x0009, type: 0x23 },
+                tasksPeak: { ID: 0x000a, type: 0x21 }, // uint16
+                gpioInterrupts: { ID: 0x000b, type: 0x23 },
+                // 0x0100 + switch endpoint
+                ...Object.fromEntries(
+                    Array.from({ length: switch_cnt }, (_, i) => [`buttonEvents${i + 1}`, { ID: 0x0101 + i, type: 0x23 }])
+                ),
+            },
+            commands: {},
+            commandsResponse: {},
+        }),
+    diagnosticCounter: (name, attribute, description, unit) =>
+        numeric({
+            name,
+            access: "STATE_GET",
+            entityCategory: "diagnostic",
+            cluster: "manuSwitchDiagnostics",
+            attribute,
+            description,
+            unit,
+        }),
+    resetReason: (name) =>
+        enumLookup({
+            name,
+            access: "STATE_GET",
+            entityCategory: "diagnostic",
+            lookup: { unknown: 0, power_on: 1, software: 2, watchdog: 3, external: 4, crash: 5 },
+            cluster: "manuSwitchDiagnostics",
+            attribute: "resetReason",
+            description: "Why the device restarted last time, unknown on Telink",
+        }),
 };
 
 const definitions = [
@@ -198,6 +254,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -207,6 +266,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -259,6 +332,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -336,6 +424,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -438,6 +542,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -533,6 +654,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -585,6 +720,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -663,6 +813,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -741,6 +907,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -787,6 +967,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -841,6 +1035,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -920,6 +1129,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1024,6 +1249,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1111,6 +1353,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -1120,6 +1365,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1156,6 +1415,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -1173,6 +1435,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1225,6 +1502,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -1250,6 +1530,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1330,6 +1626,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1384,6 +1694,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1438,6 +1762,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1502,6 +1840,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1601,6 +1954,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1703,6 +2072,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1738,6 +2121,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -1749,6 +2135,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1792,6 +2192,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -1803,6 +2206,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1847,6 +2264,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -1868,6 +2288,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -1937,6 +2372,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -1958,6 +2396,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2026,6 +2479,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -2047,6 +2503,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2115,6 +2586,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -2146,6 +2620,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2250,6 +2740,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2304,6 +2808,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2366,6 +2884,21 @@ const definitions = [
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
             romasku.relayIndicatorMode("relay_left_indicator_mode", "relay_left"),
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2447,6 +2980,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2540,6 +3088,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2634,6 +3198,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2703,6 +3283,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -2734,6 +3317,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2860,6 +3459,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -2946,6 +3562,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -2963,6 +3582,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3024,6 +3658,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3076,6 +3724,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3137,6 +3800,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3181,6 +3858,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3234,6 +3925,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3311,6 +4017,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3381,6 +4103,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -3406,6 +4131,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3475,6 +4216,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -3484,6 +4228,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3519,6 +4277,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_0": 1, "switch_1": 2, "switch_2": 3, "switch_3": 4, "relay_0": 5, "relay_1": 6, "relay_2": 7, "relay_3": 8, } }),
             romasku.deviceConfig("device_config", "switch_0"),
             romasku.networkIndicator("network_led", "switch_0"),
+            romasku.pollInterval("poll_short_interval", "switch_0", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_0", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_0", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_0", "relay_1", "relay_2", "relay_3"] }),
             romasku.pressAction("switch_0_press_action", "switch_0"),
             romasku.switchMode("switch_0_mode", "switch_0"),
@@ -3552,6 +4313,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3638,6 +4416,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -3647,6 +4428,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3682,6 +4477,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -3699,6 +4497,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3760,6 +4573,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3821,6 +4648,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3923,6 +4766,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -3998,6 +4858,116 @@ const definitions = [
         },
         ota: ota.zigbeeOTA,
     },
+    {
+        zigbeeModel: [
+            "TS0003-IHS-S",
+        ],
+        model: "_TZ3000_ju82pu2b",
+        vendor: "Tuya-custom",
+        description: "Custom switch (https://github.com/romasku/tuya-zigbee-switch)",
+        extend: [
+            deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
+            romasku.deviceConfig("device_config", "switch_left"),
+            romasku.networkIndicator("network_led", "switch_left"),
+            onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
+            romasku.pressAction("switch_left_press_action", "switch_left"),
+            romasku.switchMode("switch_left_mode", "switch_left"),
+            romasku.switchAction("switch_left_action_mode", "switch_left"),
+            romasku.relayMode("switch_left_relay_mode", "switch_left"),
+            romasku.relayIndex("switch_left_relay_index", "switch_left", 3),
+            romasku.bindedMode("switch_left_binded_mode", "switch_left"),
+            romasku.longPressDuration("switch_left_long_press_duration", "switch_left"),
+            romasku.levelMoveRate("switch_left_level_move_rate", "switch_left"),
+            romasku.pressAction("switch_middle_press_action", "switch_middle"),
+            romasku.switchMode("switch_middle_mode", "switch_middle"),
+            romasku.switchAction("switch_middle_action_mode", "switch_middle"),
+            romasku.relayMode("switch_middle_relay_mode", "switch_middle"),
+            romasku.relayIndex("switch_middle_relay_index", "switch_middle", 3),
+            romasku.bindedMode("switch_middle_binded_mode", "switch_middle"),
+            romasku.longPressDuration("switch_middle_long_press_duration", "switch_middle"),
+            romasku.levelMoveRate("switch_middle_level_move_rate", "switch_middle"),
+            romasku.pressAction("switch_right_press_action", "switch_right"),
+            romasku.switchMode("switch_right_mode", "switch_right"),
+            romasku.switchAction("switch_right_action_mode", "switch_right"),
+            romasku.relayMode("switch_right_relay_mode", "switch_right"),
+            romasku.relayIndex("switch_right_relay_index", "switch_right", 3),
+            romasku.bindedMode("switch_right_binded_mode", "switch_right"),
+            romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
+            romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
+        ],
+        meta: { multiEndpoint: true },
+        configure: async (device, coordinatorEndpoint, logger) => {
+            const endpoint1 = device.getEndpoint(1);
+            await reporting.bind(endpoint1, coordinatorEndpoint, ["genMultistateInput"]);
+            // switch action:
+            await endpoint1.configureReporting("genMultistateInput", [
+                {
+                    attribute: {ID: 0x0055 /* presentValue */, type: 0x21}, // uint16
+                    minimumReportInterval: 0,
+                    maximumReportInterval: constants.repInterval.MAX,
+                    reportableChange: 1,
+                },
+            ]);
+            const endpoint2 = device.getEndpoint(2);
+            await reporting.bind(endpoint2, coordinatorEndpoint, ["genMultistateInput"]);
+            // switch action:
+            await endpoint2.configureReporting("genMultistateInput", [
+                {
+                    attribute: {ID: 0x0055 /* presentValue */, type: 0x21}, // uint16
+                    minimumReportInterval: 0,
+                    maximumReportInterval: constants.repInterval.MAX,
+                    reportableChange: 1,
+                },
+            ]);
+            const endpoint3 = device.getEndpoint(3);
+            await reporting.bind(endpoint3, coordinatorEndpoint, ["genMultistateInput"]);
+            // switch action:
+            await endpoint3.configureReporting("genMultistateInput", [
+                {
+                    attribute: {ID: 0x0055 /* presentValue */, type: 0x21}, // uint16
+                    minimumReportInterval: 0,
+                    maximumReportInterval: constants.repInterval.MAX,
+                    reportableChange: 1,
+                },
+            ]);
+            const endpoint4 = device.getEndpoint(4);
+            await reporting.onOff(endpoint4, {
+                min: 0,
+                max: constants.repInterval.MAX,
+                change: 1,
+            });
+            const endpoint5 = device.getEndpoint(5);
+            await reporting.onOff(endpoint5, {
+                min: 0,
+                max: constants.repInterval.MAX,
+                change: 1,
+            });
+            const endpoint6 = device.getEndpoint(6);
+            await reporting.onOff(endpoint6, {
+                min: 0,
+                max: constants.repInterval.MAX,
+                change: 1,
+            });
+
+        },
+        ota: ota.zigbeeOTA,
+    },
     {
         zigbeeModel: [
             "TS0013-MH",
@@ -4008,6 +4978,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -4039,6 +5012,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4131,6 +5120,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -4142,6 +5134,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4184,6 +5190,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -4205,6 +5214,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4272,6 +5296,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -4303,6 +5330,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4429,6 +5472,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4548,6 +5608,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4634,6 +5711,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -4645,6 +5725,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4688,6 +5782,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -4709,6 +5806,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4777,6 +5889,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_middle": 2, "switch_right": 3, "relay_left": 4, "relay_middle": 5, "relay_right": 6, } }),
             romasku.deviceConfig("device_config", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_middle", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -4808,6 +5923,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -4900,6 +6031,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_0": 1, "switch_1": 2, "switch_2": 3, "switch_3": 4, "relay_0": 5, "relay_1": 6, "relay_2": 7, "relay_3": 8, } }),
             romasku.deviceConfig("device_config", "switch_0"),
+            romasku.pollInterval("poll_short_interval", "switch_0", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_0", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_0", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_0", "relay_1", "relay_2", "relay_3"] }),
             romasku.pressAction("switch_0_press_action", "switch_0"),
             romasku.switchMode("switch_0_mode", "switch_0"),
@@ -4941,6 +6075,23 @@ const definitions = [
             romasku.relayIndicator("relay_2_indicator", "relay_2"),
             romasku.relayIndicatorMode("relay_3_indicator_mode", "relay_3"),
             romasku.relayIndicator("relay_3_indicator", "relay_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5076,6 +6227,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5152,6 +6318,22 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5238,6 +6420,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5299,6 +6496,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5351,6 +6562,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5403,6 +6629,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -5412,6 +6641,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5464,6 +6707,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5528,6 +6786,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5603,6 +6875,22 @@ const definitions = [
             romasku.relayIndicator("relay_middle_indicator", "relay_middle"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(3),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_middle_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5696,6 +6984,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -5713,6 +7004,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5774,6 +7080,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5842,6 +7162,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5937,6 +7274,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -5981,6 +7332,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6025,6 +7390,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6069,6 +7448,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6113,6 +7506,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6157,6 +7564,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6209,6 +7630,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6294,6 +7730,23 @@ const definitions = [
             romasku.bindedMode("switch_3_binded_mode", "switch_3"),
             romasku.longPressDuration("switch_3_long_press_duration", "switch_3"),
             romasku.levelMoveRate("switch_3_level_move_rate", "switch_3"),
+            romasku.diagnosticsCluster(4),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_0_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_1_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_2_button_events", "buttonEvents3", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_3_button_events", "buttonEvents4", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6380,6 +7833,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -6389,6 +7845,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6424,6 +7894,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -6433,6 +7906,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6470,6 +7957,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
             romasku.networkIndicator("network_led", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -6487,6 +7977,21 @@ const definitions = [
             romasku.bindedMode("switch_right_binded_mode", "switch_right"),
             romasku.longPressDuration("switch_right_long_press_duration", "switch_right"),
             romasku.levelMoveRate("switch_right_level_move_rate", "switch_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6539,6 +8044,9 @@ const definitions = [
         extend: [
             deviceEndpoints({ endpoints: {"switch_left": 1, "switch_right": 2, "relay_left": 3, "relay_right": 4, } }),
             romasku.deviceConfig("device_config", "switch_left"),
+            romasku.pollInterval("poll_short_interval", "switch_left", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch_left", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch_left", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay_left", "relay_right"] }),
             romasku.pressAction("switch_left_press_action", "switch_left"),
             romasku.switchMode("switch_left_mode", "switch_left"),
@@ -6560,6 +8068,21 @@ const definitions = [
             romasku.relayIndicator("relay_left_indicator", "relay_left"),
             romasku.relayIndicatorMode("relay_right_indicator_mode", "relay_right"),
             romasku.relayIndicator("relay_right_indicator", "relay_right"),
+            romasku.diagnosticsCluster(2),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_left_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("switch_right_button_events", "buttonEvents2", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6639,6 +8162,20 @@ const definitions = [
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
             romasku.relayIndicatorMode("relay_indicator_mode", "relay"),
             romasku.relayIndicator("relay_indicator", "relay"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {
@@ -6682,6 +8219,9 @@ const definitions = [
             deviceEndpoints({ endpoints: {"switch": 1, "relay": 2, } }),
             romasku.deviceConfig("device_config", "switch"),
             romasku.networkIndicator("network_led", "switch"),
+            romasku.pollInterval("poll_short_interval", "switch", 0xff02, 0x21, "Parent poll interval right after activity", 65535), // uint16
+            romasku.pollInterval("poll_long_interval", "switch", 0xff03, 0x23, "Parent poll interval when idle", 3600000), // uint32
+            romasku.pollInterval("poll_fast_timeout", "switch", 0xff04, 0x23, "How long to poll fast after activity", 3600000), // uint32
             onOff({ endpointNames: ["relay"] }),
             romasku.pressAction("switch_press_action", "switch"),
             romasku.switchMode("switch_mode", "switch"),
@@ -6691,6 +8231,20 @@ const definitions = [
             romasku.bindedMode("switch_binded_mode", "switch"),
             romasku.longPressDuration("switch_long_press_duration", "switch"),
             romasku.levelMoveRate("switch_level_move_rate", "switch"),
+            romasku.diagnosticsCluster(1),
+            romasku.diagnosticCounter("uptime", "uptime", "Time since the last restart", "s"),
+            romasku.resetReason("reset_reason"),
+            romasku.diagnosticCounter("button_events", "buttonEvents", "Debounced presses and releases of all switches"),
+            romasku.diagnosticCounter("switch_button_events", "buttonEvents1", "Debounced presses and releases of this switch"),
+            romasku.diagnosticCounter("relay_operations", "relayOperations", "Relay switchings"),
+            romasku.diagnosticCounter("latching_pulses", "latchingPulses", "Pulses queued for latching relays"),
+            romasku.diagnosticCounter("zcl_commands_received", "zclCommandsReceived", "Commands received for the relays"),
+            romasku.diagnosticCounter("zcl_commands_sent", "zclCommandsSent", "Commands sent to bound devices"),
+            romasku.diagnosticCounter("send_failures", "sendFailures", "Commands to bound devices the stack refused"),
+            romasku.diagnosticCounter("reports_sent", "reportsSent", "Attribute changes handed to reporting"),
+            romasku.diagnosticCounter("nvm_writes", "nvmWrites", "Writes to flash"),
+            romasku.diagnosticCounter("tasks_peak", "tasksPeak", "Most tasks scheduled at once"),
+            romasku.diagnosticCounter("gpio_interrupts", "gpioInterrupts", "Switch input interrupts, bounces included"),
         ],
         meta: { multiEndpoint: true },
         configure: async (device, coordinatorEndpoint, logger) => {